@@ -0,0 +1,83 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include "Common.hpp"
+#include "internal/core/Factory.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/util/Bytes.hpp"
+
+namespace ottest
+{
+namespace
+{
+// Operands which fit in the native 128 bit representation
+auto small_lhs() noexcept -> ot::Amount { return 1234567890123456789LL; }
+auto small_rhs() noexcept -> ot::Amount { return 987654321LL; }
+// Operands which force the arbitrary precision representation
+auto large_lhs() noexcept(false) -> ot::Amount
+{
+    return ot::factory::Amount(
+        "1606938044258990275541962092341162602522202993782792835301376");
+}
+auto large_rhs() noexcept(false) -> ot::Amount
+{
+    return ot::factory::Amount("340282366920938463463374607431768211457");
+}
+
+auto amount_add(benchmark::State& state, ot::Amount lhs, ot::Amount rhs)
+    -> void
+{
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(lhs + rhs);
+    }
+}
+
+auto amount_multiply(benchmark::State& state, ot::Amount lhs) -> void
+{
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(lhs * 3);
+    }
+}
+
+auto amount_divide(benchmark::State& state, ot::Amount lhs, ot::Amount rhs)
+    -> void
+{
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(lhs / rhs);
+    }
+}
+
+auto amount_compare(benchmark::State& state, ot::Amount lhs, ot::Amount rhs)
+    -> void
+{
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(lhs < rhs);
+    }
+}
+
+auto amount_serialize(benchmark::State& state, ot::Amount value) -> void
+{
+    auto out = ot::Space{};
+
+    for ([[maybe_unused]] auto _ : state) {
+        out.clear();
+        benchmark::DoNotOptimize(value.Serialize(ot::writer(out)));
+    }
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(amount_add, native, small_lhs(), small_rhs());
+BENCHMARK_CAPTURE(amount_add, bignum, large_lhs(), large_rhs());
+BENCHMARK_CAPTURE(amount_multiply, native, small_lhs());
+BENCHMARK_CAPTURE(amount_multiply, bignum, large_lhs());
+BENCHMARK_CAPTURE(amount_divide, native, small_lhs(), small_rhs());
+BENCHMARK_CAPTURE(amount_divide, bignum, large_lhs(), large_rhs());
+BENCHMARK_CAPTURE(amount_compare, native, small_lhs(), small_rhs());
+BENCHMARK_CAPTURE(amount_compare, bignum, large_lhs(), large_rhs());
+BENCHMARK_CAPTURE(amount_serialize, native, small_lhs());
+BENCHMARK_CAPTURE(amount_serialize, bignum, large_lhs());
+}  // namespace ottest
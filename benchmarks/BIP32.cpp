@@ -0,0 +1,78 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <memory>
+
+#include "Common.hpp"
+#include "crypto/Bip32Vectors.hpp"
+#include "opentxs/api/crypto/Seed.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/crypto/Bip32Child.hpp"
+#include "opentxs/crypto/Types.hpp"
+#include "opentxs/crypto/key/HD.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/PasswordPrompt.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+namespace
+{
+using Path = ot::UnallocatedVector<ot::Bip32Index>;
+
+auto make_path(const Child::Path& path) noexcept -> Path
+{
+    static constexpr auto hard =
+        static_cast<ot::Bip32Index>(ot::Bip32Child::HARDENED);
+    auto output = Path{};
+
+    for (const auto& item : path) {
+        if (item.hardened_) {
+            output.emplace_back(item.index_ | hard);
+        } else {
+            output.emplace_back(item.index_);
+        }
+    }
+
+    return output;
+}
+
+// Derives m/0H/1/2H/2/1000000000 from the seed of the first BIP-32 test vector
+// on every iteration
+auto bip32_derive(benchmark::State& state) -> void
+{
+    const auto& api = Client();
+    const auto reason = api.Factory().PasswordPrompt(__func__);
+    const auto& item = bip32_test_cases_.at(0u);
+    const auto path = make_path(item.children_.back().path_);
+    const auto seedID = [&] {
+        const auto bytes = api.Factory().DataFromHex(item.seed_);
+        const auto seed = api.Factory().SecretFromBytes(bytes->Bytes());
+
+        return api.Crypto().Seed().ImportRaw(seed, reason);
+    }();
+
+    if (seedID.empty()) {
+        state.SkipWithError("failed to import seed");
+
+        return;
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+        const auto key = api.Crypto().Seed().GetHDKey(
+            seedID, ot::crypto::EcdsaCurve::secp256k1, path, reason);
+        benchmark::DoNotOptimize(key.get());
+    }
+
+    state.counters["depth"] = static_cast<double>(path.size());
+}
+}  // namespace
+
+BENCHMARK(bip32_derive);
+}  // namespace ottest
@@ -0,0 +1,126 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "1_Internal.hpp"
+#include "Blockchain.hpp"
+#include "blockchain/block/bitcoin/Block.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace ottest
+{
+namespace
+{
+using BlockImp = ot::blockchain::block::bitcoin::implementation::Block;
+
+auto block_parse(benchmark::State& state) -> void
+{
+    const auto& api = Client();
+    const auto bytes = Bip158Block();
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(
+            api.Factory().BitcoinBlock(bip158_chain_, bytes));
+    }
+
+    state.SetBytesProcessed(
+        static_cast<std::int64_t>(state.iterations() * bytes.size()));
+}
+
+auto block_serialize(benchmark::State& state) -> void
+{
+    const auto pBlock = ParseBip158Block();
+
+    if (false == bool(pBlock)) {
+        state.SkipWithError("failed to parse block");
+
+        return;
+    }
+
+    auto out = ot::Space{};
+
+    for ([[maybe_unused]] auto _ : state) {
+        out.clear();
+        benchmark::DoNotOptimize(pBlock->Serialize(ot::writer(out)));
+    }
+
+    state.SetBytesProcessed(
+        static_cast<std::int64_t>(state.iterations() * out.size()));
+}
+
+// Parses every transaction of the block individually
+auto transaction_parse(benchmark::State& state) -> void
+{
+    const auto& api = Client();
+    const auto pBlock = ParseBip158Block();
+
+    if (false == bool(pBlock)) {
+        state.SkipWithError("failed to parse block");
+
+        return;
+    }
+
+    auto transactions = ot::UnallocatedVector<ot::Space>{};
+
+    for (const auto& tx : *pBlock) {
+        auto& out = transactions.emplace_back();
+        tx->Internal().Serialize(ot::writer(out));
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto generation{true};
+
+        for (const auto& bytes : transactions) {
+            benchmark::DoNotOptimize(api.Factory().BitcoinTransaction(
+                bip158_chain_, ot::reader(bytes), generation));
+            generation = false;
+        }
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * transactions.size()));
+}
+
+// Merkle root over a synthetic set of txids, since the test vectors only
+// contain small blocks
+auto merkle_root(benchmark::State& state) -> void
+{
+    const auto& api = Client();
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto txids = BlockImp::TxidIndex{};
+    txids.reserve(count);
+
+    for (auto i = std::uint64_t{0}; i < count; ++i) {
+        auto& txid = txids.emplace_back(32u, std::byte{0x0});
+        std::memcpy(txid.data(), &i, sizeof(i));
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(
+            BlockImp::calculate_merkle_value(api, bip158_chain_, txids));
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * count));
+}
+}  // namespace
+
+BENCHMARK(block_parse);
+BENCHMARK(block_serialize);
+BENCHMARK(transaction_parse);
+BENCHMARK(merkle_root)->RangeMultiplier(16)->Range(16, 16 << 12);
+}  // namespace ottest
@@ -0,0 +1,41 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Blockchain.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <iterator>
+
+#include "blockchain/bip158/Bip158.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+auto Bip158Block() noexcept -> ot::ReadView
+{
+    static const auto block = [] {
+        const auto& vector = *std::max_element(
+            std::begin(bip_158_vectors_),
+            std::end(bip_158_vectors_),
+            [](const auto& lhs, const auto& rhs) {
+                return lhs.block_.size() < rhs.block_.size();
+            });
+
+        return ot::space(vector.Block(Client())->Bytes());
+    }();
+
+    return ot::reader(block);
+}
+
+auto ParseBip158Block() noexcept
+    -> std::shared_ptr<const ot::blockchain::block::bitcoin::Block>
+{
+    return Client().Factory().BitcoinBlock(bip158_chain_, Bip158Block());
+}
+}  // namespace ottest
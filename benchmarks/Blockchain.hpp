@@ -0,0 +1,41 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <memory>
+
+#include "Common.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/util/Bytes.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace blockchain
+{
+namespace block
+{
+namespace bitcoin
+{
+class Block;
+}  // namespace bitcoin
+}  // namespace block
+}  // namespace blockchain
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace ottest
+{
+constexpr auto bip158_chain_ = ot::blockchain::Type::Bitcoin_testnet3;
+
+// Serialized form of the largest block in the BIP-158 test vectors
+auto Bip158Block() noexcept -> ot::ReadView;
+auto ParseBip158Block() noexcept
+    -> std::shared_ptr<const ot::blockchain::block::bitcoin::Block>;
+}  // namespace ottest
@@ -0,0 +1,20 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Common.hpp"  // IWYU pragma: associated
+
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+
+namespace ottest
+{
+auto Client() noexcept -> const ot::api::session::Client&
+{
+    static const auto& client = ot::Context().StartClientSession(0);
+
+    return client;
+}
+}  // namespace ottest
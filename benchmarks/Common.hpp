@@ -0,0 +1,31 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Basic.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace api
+{
+namespace session
+{
+class Client;
+}  // namespace session
+}  // namespace api
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace ottest
+{
+// Client session shared by every benchmark. Started on first use, so it must
+// not be called before the context has been initialized.
+auto Client() noexcept -> const ot::api::session::Client&;
+}  // namespace ottest
@@ -0,0 +1,86 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include "Common.hpp"
+#include "opentxs/api/crypto/Blockchain.hpp"
+#include "opentxs/api/crypto/Encode.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/crypto/AddressStyle.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+namespace
+{
+using Chain = ot::blockchain::Type;
+using Style = ot::blockchain::crypto::AddressStyle;
+
+// BIP-173 test vector
+constexpr auto pubkey_hash_{"751e76e8199196d454941c45d1b3a323f1433bd6"};
+constexpr auto identifier_{
+    "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"};
+
+auto address_encode(benchmark::State& state, Style style) -> void
+{
+    const auto& api = Client();
+    const auto& blockchain = api.Crypto().Blockchain();
+    const auto hash = api.Factory().DataFromHex(pubkey_hash_);
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(
+            blockchain.EncodeAddress(style, Chain::Bitcoin, hash));
+    }
+}
+
+auto address_decode(benchmark::State& state, Style style) -> void
+{
+    const auto& api = Client();
+    const auto& blockchain = api.Crypto().Blockchain();
+    const auto address = blockchain.EncodeAddress(
+        style, Chain::Bitcoin, api.Factory().DataFromHex(pubkey_hash_));
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(blockchain.DecodeAddress(address));
+    }
+}
+
+auto identifier_encode(benchmark::State& state) -> void
+{
+    const auto& api = Client();
+    const auto& encode = api.Crypto().Encode();
+    const auto id = api.Factory().DataFromHex(identifier_);
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(encode.IdentifierEncode(id));
+    }
+}
+
+auto identifier_decode(benchmark::State& state) -> void
+{
+    const auto& api = Client();
+    const auto& encode = api.Crypto().Encode();
+    const auto id =
+        encode.IdentifierEncode(api.Factory().DataFromHex(identifier_));
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(encode.IdentifierDecode(id));
+    }
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(address_encode, base58, Style::P2PKH);
+BENCHMARK_CAPTURE(address_encode, bech32, Style::P2WPKH);
+BENCHMARK_CAPTURE(address_decode, base58, Style::P2PKH);
+BENCHMARK_CAPTURE(address_decode, bech32, Style::P2WPKH);
+BENCHMARK(identifier_encode);
+BENCHMARK(identifier_decode);
+}  // namespace ottest
@@ -0,0 +1,285 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+
+#include "Blockchain.hpp"
+#include "blockchain/bip158/bch_filter_1307544.hpp"
+#include "internal/blockchain/Blockchain.hpp"
+#include "internal/blockchain/block/Block.hpp"
+#include "internal/blockchain/p2p/bitcoin/message/Message.hpp"
+#include "internal/network/zeromq/message/Message.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/FilterType.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/network/zeromq/message/Frame.hpp"
+#include "opentxs/network/zeromq/message/Message.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+namespace
+{
+using FilterType = ot::blockchain::cfilter::Type;
+
+// Hash of mainnet BCH block 1307544
+constexpr auto filter_block_{
+    "a9df8e8b72336137aaf70ac0d390c2a57b2afc826201e9f78b00000000000000"};
+
+auto encoded_filter() noexcept -> ot::ReadView
+{
+    const auto& filter = bch_filter_1307544_;
+
+    return {reinterpret_cast<const char*>(filter.data()), filter.size()};
+}
+
+auto decode_filter() noexcept -> ot::blockchain::GCS
+{
+    const auto& api = Client();
+    const auto hash = api.Factory().DataFromHex(filter_block_);
+
+    return ot::factory::GCS(
+        api,
+        FilterType::Basic_BCHVariant,
+        ot::blockchain::internal::BlockHashToFilterKey(hash->Bytes()),
+        encoded_filter(),
+        {});
+}
+
+// P2PKH output scripts with synthetic hashes, which are expected to miss
+auto make_targets(std::size_t count) noexcept
+    -> ot::UnallocatedVector<ot::Space>
+{
+    auto output = ot::UnallocatedVector<ot::Space>{};
+    output.reserve(count);
+
+    for (auto i = std::uint64_t{0}; i < count; ++i) {
+        auto& script = output.emplace_back(25u, std::byte{0x0});
+        script.at(0) = std::byte{0x76};
+        script.at(1) = std::byte{0xa9};
+        script.at(2) = std::byte{0x14};
+        std::memcpy(std::next(script.data(), 3), &i, sizeof(i));
+        script.at(23) = std::byte{0x88};
+        script.at(24) = std::byte{0xac};
+    }
+
+    return output;
+}
+
+auto gcs_decode(benchmark::State& state) -> void
+{
+    auto elements = std::uint32_t{};
+
+    for ([[maybe_unused]] auto _ : state) {
+        const auto cfilter = decode_filter();
+        elements = cfilter.ElementCount();
+        benchmark::DoNotOptimize(elements);
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * elements));
+}
+
+auto gcs_encode(benchmark::State& state) -> void
+{
+    const auto cfilter = decode_filter();
+
+    if (false == cfilter.IsValid()) {
+        state.SkipWithError("failed to decode filter");
+
+        return;
+    }
+
+    auto out = ot::Space{};
+
+    for ([[maybe_unused]] auto _ : state) {
+        out.clear();
+        benchmark::DoNotOptimize(cfilter.Encode(ot::writer(out)));
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(
+        state.iterations() * cfilter.ElementCount()));
+}
+
+auto gcs_match(benchmark::State& state) -> void
+{
+    const auto cfilter = decode_filter();
+
+    if (false == cfilter.IsValid()) {
+        state.SkipWithError("failed to decode filter");
+
+        return;
+    }
+
+    const auto scripts =
+        make_targets(static_cast<std::size_t>(state.range(0)));
+    auto targets = ot::blockchain::GCS::Targets{};
+    targets.reserve(scripts.size());
+
+    for (const auto& script : scripts) {
+        targets.emplace_back(ot::reader(script));
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(cfilter.Match(targets));
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * targets.size()));
+}
+
+auto gcs_test(benchmark::State& state) -> void
+{
+    const auto cfilter = decode_filter();
+
+    if (false == cfilter.IsValid()) {
+        state.SkipWithError("failed to decode filter");
+
+        return;
+    }
+
+    const auto scripts = make_targets(1u);
+    const auto target = ot::reader(scripts.front());
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(cfilter.Test(target));
+    }
+}
+
+auto bip158_elements(
+    const ot::blockchain::block::bitcoin::Block& block) noexcept
+    -> ot::Vector<ot::OTData>
+{
+    const auto& api = Client();
+    auto output = ot::Vector<ot::OTData>{};
+
+    for (const auto& bytes :
+         block.Internal().ExtractElements(FilterType::Basic_BIP158)) {
+        output.emplace_back(api.Factory().DataFromBytes(ot::reader(bytes)));
+    }
+
+    return output;
+}
+
+// Builds the BIP-158 basic filter from the elements of the largest test block
+auto gcs_build(benchmark::State& state) -> void
+{
+    const auto& api = Client();
+    const auto pBlock = ParseBip158Block();
+
+    if (false == bool(pBlock)) {
+        state.SkipWithError("failed to parse block");
+
+        return;
+    }
+
+    const auto& block = *pBlock;
+    const auto [bits, fpRate] =
+        ot::blockchain::internal::GetFilterParams(FilterType::Basic_BIP158);
+    const auto key =
+        ot::blockchain::internal::BlockHashToFilterKey(block.ID().Bytes());
+    const auto elements = bip158_elements(block);
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(
+            ot::factory::GCS(api, bits, fpRate, key, elements, {}));
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * elements.size()));
+}
+
+// Replies to a maximum size getcfilters request, either by decoding each
+// stored filter into a GCS and serializing a cfilter message (state.range(0)
+// is zero) or by framing the stored encoding directly (state.range(0) is one)
+auto gcs_cfilter_batch(benchmark::State& state) -> void
+{
+    constexpr auto count = std::size_t{1000};
+    const auto& api = Client();
+    const auto pBlock = ParseBip158Block();
+
+    if (false == bool(pBlock)) {
+        state.SkipWithError("failed to parse block");
+
+        return;
+    }
+
+    const auto& block = *pBlock;
+    const auto& hash = block.ID();
+    const auto key =
+        ot::blockchain::internal::BlockHashToFilterKey(hash.Bytes());
+    const auto [bits, fpRate] =
+        ot::blockchain::internal::GetFilterParams(FilterType::Basic_BIP158);
+    const auto encoded = [&] {
+        auto out = ot::Space{};
+        ot::factory::GCS(api, bits, fpRate, key, bip158_elements(block), {})
+            .Encode(ot::writer(out));
+
+        return out;
+    }();
+    const auto direct = (0 != state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto batch = ot::network::zeromq::Message{};
+        batch.Internal().Reserve(2u * count);
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            if (direct) {
+                ot::factory::BitcoinP2PCfilterFrames(
+                    api,
+                    bip158_chain_,
+                    FilterType::Basic_BIP158,
+                    hash,
+                    ot::reader(encoded),
+                    batch);
+            } else {
+                const auto cfilter = ot::factory::GCS(
+                    api,
+                    FilterType::Basic_BIP158,
+                    key,
+                    ot::reader(encoded),
+                    {});
+                const auto message = std::unique_ptr<
+                    ot::blockchain::p2p::bitcoin::message::internal::Cfilter>{
+                    ot::factory::BitcoinP2PCfilter(
+                        api,
+                        bip158_chain_,
+                        FilterType::Basic_BIP158,
+                        hash,
+                        cfilter)};
+                auto [header, payload] = message->Transmit();
+                batch.AddFrame(std::move(header));
+                batch.AddFrame(std::move(payload));
+            }
+        }
+
+        benchmark::DoNotOptimize(batch);
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * count));
+    state.SetBytesProcessed(static_cast<std::int64_t>(
+        state.iterations() * count * encoded.size()));
+}
+}  // namespace
+
+BENCHMARK(gcs_decode);
+BENCHMARK(gcs_encode);
+BENCHMARK(gcs_match)->RangeMultiplier(8)->Range(1, 4096);
+BENCHMARK(gcs_test);
+BENCHMARK(gcs_build);
+BENCHMARK(gcs_cfilter_batch)->Arg(0)->Arg(1);
+}  // namespace ottest
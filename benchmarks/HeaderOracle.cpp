@@ -0,0 +1,117 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+
+#include "Blockchain.hpp"
+#include "opentxs/api/network/Blockchain.hpp"
+#include "opentxs/api/network/Network.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/Header.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/node/HeaderOracle.hpp"
+#include "opentxs/blockchain/node/Manager.hpp"
+
+namespace ottest
+{
+namespace
+{
+using Chain = ot::blockchain::Type;
+using HeaderOracle = ot::blockchain::node::HeaderOracle;
+
+constexpr auto chain_ = Chain::Bitcoin;
+
+// The chain is started without peers, so only the genesis block is present.
+// Every query is either a hit on the genesis block or a miss on the hash of
+// the largest BIP-158 test block.
+auto oracle() noexcept -> const HeaderOracle*
+{
+    static const auto* output = []() -> const HeaderOracle* {
+        constexpr auto seednode{"do not init peers"};
+        const auto& network = Client().Network().Blockchain();
+
+        if (false == network.Start(chain_, seednode)) { return nullptr; }
+
+        return &network.GetChain(chain_).HeaderOracle();
+    }();
+
+    return output;
+}
+
+auto header_oracle_best_hash(benchmark::State& state) -> void
+{
+    const auto* pOracle = oracle();
+
+    if (nullptr == pOracle) {
+        state.SkipWithError("failed to start chain");
+
+        return;
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(pOracle->BestHash(0));
+    }
+}
+
+auto header_oracle_load_header(benchmark::State& state) -> void
+{
+    const auto* pOracle = oracle();
+
+    if (nullptr == pOracle) {
+        state.SkipWithError("failed to start chain");
+
+        return;
+    }
+
+    const auto& hash = HeaderOracle::GenesisBlockHash(chain_);
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(pOracle->LoadHeader(hash));
+    }
+}
+
+auto header_oracle_load_header_miss(benchmark::State& state) -> void
+{
+    const auto* pOracle = oracle();
+    const auto pBlock = ParseBip158Block();
+
+    if ((nullptr == pOracle) || (false == bool(pBlock))) {
+        state.SkipWithError("failed to start chain or parse block");
+
+        return;
+    }
+
+    const auto& hash = pBlock->ID();
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(pOracle->LoadHeader(hash));
+    }
+}
+
+auto header_oracle_is_in_best_chain(benchmark::State& state) -> void
+{
+    const auto* pOracle = oracle();
+
+    if (nullptr == pOracle) {
+        state.SkipWithError("failed to start chain");
+
+        return;
+    }
+
+    const auto& hash = HeaderOracle::GenesisBlockHash(chain_);
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(pOracle->IsInBestChain(hash));
+    }
+}
+}  // namespace
+
+BENCHMARK(header_oracle_best_hash);
+BENCHMARK(header_oracle_load_header);
+BENCHMARK(header_oracle_load_header_miss);
+BENCHMARK(header_oracle_is_in_best_chain);
+}  // namespace ottest
@@ -0,0 +1,106 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Common.hpp"
+#include "internal/api/session/FactoryAPI.hpp"
+#include "internal/otx/Types.hpp"
+#include "internal/otx/common/Message.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/api/session/Wallet.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/identity/Nym.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/PasswordPrompt.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+namespace
+{
+// Signed registerNym request carrying size bytes of payload
+auto message(const std::size_t size) noexcept -> std::unique_ptr<ot::Message>
+{
+    const auto& api = Client();
+    const auto reason = api.Factory().PasswordPrompt(__func__);
+    static const auto nym = api.Wallet().Nym(reason);
+    auto out = api.Factory().InternalSession().Message();
+    const auto payload = [&] {
+        auto rng = std::mt19937{};
+        auto dist = std::uniform_int_distribution<int>{'a', 'z'};
+        auto data = ot::UnallocatedCString{};
+        data.reserve(size);
+
+        while (data.size() < size) {
+            data.push_back(static_cast<char>(dist(rng)));
+        }
+
+        return ot::String::Factory(data);
+    }();
+    out->m_strCommand = ot::String::Factory(
+        ot::Message::Command(ot::MessageType::registerNym));
+    out->m_strNymID = ot::String::Factory(nym->ID());
+    out->m_strRequestNum = ot::String::Factory("1");
+    out->m_ascPayload->SetString(payload);
+    out->SignContract(*nym, reason);
+    out->SaveContract();
+
+    return out;
+}
+
+// Serializes a signed message for the wire. The first argument selects the
+// binary encoding.
+auto legacy_message_encode(benchmark::State& state) -> void
+{
+    const auto binary = (0 != state.range(0));
+    const auto request = message(static_cast<std::size_t>(state.range(1)));
+    auto bytes = std::int64_t{0};
+
+    for ([[maybe_unused]] auto _ : state) {
+        const auto encoded = request->Encode(binary);
+        bytes += static_cast<std::int64_t>(encoded.size());
+        benchmark::DoNotOptimize(encoded.data());
+    }
+
+    state.SetBytesProcessed(bytes);
+}
+
+// Parses a signed message received from the wire. The first argument selects
+// the binary encoding.
+auto legacy_message_decode(benchmark::State& state) -> void
+{
+    const auto binary = (0 != state.range(0));
+    const auto encoded =
+        message(static_cast<std::size_t>(state.range(1)))->Encode(binary);
+    const auto& factory = Client().Factory().InternalSession();
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto copy = factory.Message();
+        benchmark::DoNotOptimize(copy->Decode(encoded, binary));
+    }
+
+    state.SetBytesProcessed(
+        state.iterations() * static_cast<std::int64_t>(encoded.size()));
+}
+}  // namespace
+
+BENCHMARK(legacy_message_encode)
+    ->Args({0, 1024})
+    ->Args({1, 1024})
+    ->Args({0, 16384})
+    ->Args({1, 16384});
+BENCHMARK(legacy_message_decode)
+    ->Args({0, 1024})
+    ->Args({1, 1024})
+    ->Args({0, 16384})
+    ->Args({1, 16384});
+}  // namespace ottest
@@ -0,0 +1,128 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Common.hpp"
+#include "internal/api/session/FactoryAPI.hpp"
+#include "internal/otx/common/trade/OTOffer.hpp"
+#include "internal/otx/common/trade/OrderBook.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace ottest
+{
+namespace
+{
+using Book = ot::otx::OrderBook;
+
+constexpr auto resting_ = std::size_t{100000};
+// Distinct prices on each side of the book
+constexpr auto levels_ = std::int64_t{1000};
+constexpr auto spread_ = std::int64_t{10};
+
+// Offers shared by every run. Bids and asks alternate and are spread across
+// levels_ prices on each side without crossing.
+auto offers() noexcept
+    -> const ot::UnallocatedVector<std::unique_ptr<ot::OTOffer>>&
+{
+    static const auto offers = [] {
+        const auto& factory = Client().Factory().InternalSession();
+        auto out = ot::UnallocatedVector<std::unique_ptr<ot::OTOffer>>{};
+        out.reserve(resting_);
+
+        for (auto i = std::size_t{0}; i < resting_; ++i) {
+            const auto number = static_cast<std::int64_t>(i) + 1;
+            const auto selling = (1u == (i % 2u));
+            const auto offset = static_cast<std::int64_t>(i / 2u) % levels_;
+            const auto price =
+                selling ? (levels_ + spread_ + offset) : (levels_ - offset);
+            auto& offer = out.emplace_back(factory.Offer());
+            offer->MakeOffer(selling, price, 100, 1, number);
+        }
+
+        return out;
+    }();
+
+    return offers;
+}
+
+auto fill(Book& book) noexcept -> void
+{
+    for (const auto& offer : offers()) { book.Add(*offer); }
+}
+
+// Builds a book of resting_ offers
+auto orderbook_add(benchmark::State& state) -> void
+{
+    const auto& data = offers();
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto book = std::make_unique<Book>();
+        fill(*book);
+        benchmark::DoNotOptimize(book->BidCount());
+        state.PauseTiming();
+        book.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * data.size()));
+}
+
+// Cancels and replaces offers spread across a book of resting_ offers
+auto orderbook_cancel(benchmark::State& state) -> void
+{
+    const auto& data = offers();
+    auto book = Book{};
+    fill(book);
+    auto i = std::size_t{0};
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto* offer = book.Remove(data.at(i)->GetTransactionNum());
+        benchmark::DoNotOptimize(offer);
+        book.Add(*offer);
+        i = (i + 7919u) % data.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Checks whether a book of resting_ offers can match
+auto orderbook_crosses(benchmark::State& state) -> void
+{
+    auto book = Book{};
+    fill(book);
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(book.Crosses());
+    }
+}
+
+// Takes a snapshot of the best price levels of a book of resting_ offers
+auto orderbook_depth(benchmark::State& state) -> void
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto book = Book{};
+    fill(book);
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(book.Depth(true, count));
+        benchmark::DoNotOptimize(book.Depth(false, count));
+    }
+}
+}  // namespace
+
+BENCHMARK(orderbook_add)->Unit(benchmark::kMillisecond);
+BENCHMARK(orderbook_cancel);
+BENCHMARK(orderbook_crosses);
+BENCHMARK(orderbook_depth)->Arg(10)->Arg(50);
+}  // namespace ottest
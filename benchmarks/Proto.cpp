@@ -0,0 +1,236 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <google/protobuf/arena.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Blockchain.hpp"
+#include "Proto.tpp"
+#include "internal/blockchain/Blockchain.hpp"
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "internal/blockchain/block/Block.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/FilterType.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "serialization/protobuf/BlockchainTransactionOutput.pb.h"
+#include "serialization/protobuf/GCS.pb.h"
+#include "util/ByteLiterals.hpp"
+
+namespace ottest
+{
+namespace
+{
+using Batch = ot::UnallocatedVector<ot::UnallocatedCString>;
+using FilterType = ot::blockchain::cfilter::Type;
+
+// Number of cfilters loaded by one BlockFilter::LoadFilters call during a
+// typical rescan
+constexpr auto filter_batch_ = std::size_t{1000};
+// Number of outputs parsed by OutputCache::populate between arena resets
+constexpr auto output_batch_ = std::size_t{4096};
+
+// Serialized BIP-158 basic filter of the largest test block, repeated
+auto filter_batch() noexcept -> const Batch&
+{
+    static const auto batch = [] {
+        const auto& api = Client();
+        auto output = Batch{};
+        const auto pBlock = ParseBip158Block();
+
+        if (false == bool(pBlock)) { return output; }
+
+        const auto& block = *pBlock;
+        const auto [bits, fpRate] =
+            ot::blockchain::internal::GetFilterParams(FilterType::Basic_BIP158);
+        const auto key =
+            ot::blockchain::internal::BlockHashToFilterKey(block.ID().Bytes());
+        const auto elements = [&] {
+            auto out = ot::Vector<ot::OTData>{};
+
+            for (const auto& bytes : block.Internal().ExtractElements(
+                     FilterType::Basic_BIP158)) {
+                out.emplace_back(
+                    api.Factory().DataFromBytes(ot::reader(bytes)));
+            }
+
+            return out;
+        }();
+        const auto cfilter =
+            ot::factory::GCS(api, bits, fpRate, key, elements, {});
+        auto proto = ot::proto::GCS{};
+
+        if (false == cfilter.Internal().Serialize(proto)) { return output; }
+
+        output.assign(filter_batch_, proto.SerializeAsString());
+
+        return output;
+    }();
+
+    return batch;
+}
+
+// Serialized outputs of the largest test block, repeated
+auto output_batch() noexcept -> const Batch&
+{
+    static const auto batch = [] {
+        auto output = Batch{};
+        const auto pBlock = ParseBip158Block();
+
+        if (false == bool(pBlock)) { return output; }
+
+        auto outputs = Batch{};
+
+        for (const auto& tx : *pBlock) {
+            for (const auto& txout : tx->Outputs()) {
+                auto proto = ot::proto::BlockchainTransactionOutput{};
+
+                if (false == txout.Internal().Serialize(proto)) { continue; }
+
+                outputs.emplace_back(proto.SerializeAsString());
+            }
+        }
+
+        if (outputs.empty()) { return output; }
+
+        output.reserve(output_batch_);
+
+        for (auto i = std::size_t{0}; i < output_batch_; ++i) {
+            output.emplace_back(outputs.at(i % outputs.size()));
+        }
+
+        return output;
+    }();
+
+    return batch;
+}
+
+// Mirrors BlockFilter::LoadFilters: each serialized filter is parsed and
+// immediately converted to a native GCS
+template <bool arena>
+auto load_filters(benchmark::State& state) -> void
+{
+    const auto& api = Client();
+    const auto& batch = filter_batch();
+
+    if (batch.empty()) {
+        state.SkipWithError("failed to serialize filter");
+
+        return;
+    }
+
+    static const auto options = ot::proto::BatchArenaOptions(1_MiB);
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto output = ot::Vector<ot::blockchain::GCS>{};
+        output.reserve(batch.size());
+
+        if constexpr (arena) {
+            auto buffer = google::protobuf::Arena{options};
+
+            for (const auto& bytes : batch) {
+                output.emplace_back(ot::factory::GCS(
+                    api,
+                    *ot::proto::Factory<ot::proto::GCS>(buffer, bytes),
+                    {}));
+            }
+        } else {
+            for (const auto& bytes : batch) {
+                output.emplace_back(ot::factory::GCS(
+                    api, ot::proto::Factory<ot::proto::GCS>(bytes), {}));
+            }
+        }
+
+        benchmark::DoNotOptimize(output);
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * batch.size()));
+}
+
+// Mirrors OutputCache::populate: each serialized output is parsed and
+// immediately converted to a native output
+template <bool arena>
+auto populate_outputs(benchmark::State& state) -> void
+{
+    constexpr auto chain = bip158_chain_;
+    const auto& api = Client();
+    const auto& batch = output_batch();
+
+    if (batch.empty()) {
+        state.SkipWithError("failed to serialize outputs");
+
+        return;
+    }
+
+    static const auto options = ot::proto::BatchArenaOptions(1_MiB);
+    using Proto = ot::proto::BlockchainTransactionOutput;
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto output = ot::UnallocatedVector<std::unique_ptr<
+            ot::blockchain::block::bitcoin::internal::Output>>{};
+        output.reserve(batch.size());
+
+        if constexpr (arena) {
+            auto buffer = google::protobuf::Arena{options};
+
+            for (const auto& bytes : batch) {
+                output.emplace_back(ot::factory::BitcoinTransactionOutput(
+                    api, chain, *ot::proto::Factory<Proto>(buffer, bytes)));
+            }
+        } else {
+            for (const auto& bytes : batch) {
+                output.emplace_back(ot::factory::BitcoinTransactionOutput(
+                    api, chain, ot::proto::Factory<Proto>(bytes)));
+            }
+        }
+
+        benchmark::DoNotOptimize(output);
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * batch.size()));
+}
+
+auto proto_load_filters_arena(benchmark::State& state) -> void
+{
+    load_filters<true>(state);
+}
+
+auto proto_load_filters_heap(benchmark::State& state) -> void
+{
+    load_filters<false>(state);
+}
+
+auto proto_populate_outputs_arena(benchmark::State& state) -> void
+{
+    populate_outputs<true>(state);
+}
+
+auto proto_populate_outputs_heap(benchmark::State& state) -> void
+{
+    populate_outputs<false>(state);
+}
+}  // namespace
+
+BENCHMARK(proto_load_filters_arena);
+BENCHMARK(proto_load_filters_heap);
+BENCHMARK(proto_populate_outputs_arena);
+BENCHMARK(proto_populate_outputs_heap);
+}  // namespace ottest
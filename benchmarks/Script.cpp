@@ -0,0 +1,60 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+
+#include "Blockchain.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Script.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace ottest
+{
+namespace
+{
+using Position = ot::blockchain::block::bitcoin::Script::Position;
+
+// Parses and classifies every output script of the block
+auto script_classify(benchmark::State& state) -> void
+{
+    const auto pBlock = ParseBip158Block();
+
+    if (false == bool(pBlock)) {
+        state.SkipWithError("failed to parse block");
+
+        return;
+    }
+
+    auto scripts = ot::UnallocatedVector<ot::Space>{};
+
+    for (const auto& tx : *pBlock) {
+        for (const auto& output : tx->Outputs()) {
+            auto& out = scripts.emplace_back();
+            output.Script().Serialize(ot::writer(out));
+        }
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+        for (const auto& bytes : scripts) {
+            const auto script = ot::factory::BitcoinScript(
+                bip158_chain_, ot::reader(bytes), Position::Output);
+            benchmark::DoNotOptimize(script->Type());
+        }
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * scripts.size()));
+}
+}  // namespace
+
+BENCHMARK(script_classify);
+}  // namespace ottest
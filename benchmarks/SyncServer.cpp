@@ -0,0 +1,163 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "Blockchain.hpp"
+#include "blockchain/bip158/bch_filter_1307544.hpp"
+#include "blockchain/node/base/SyncReader.hpp"
+#include "internal/network/p2p/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/FilterType.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/Header.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Header.hpp"
+#include "opentxs/network/p2p/Block.hpp"
+#include "opentxs/network/p2p/Data.hpp"
+#include "opentxs/network/p2p/State.hpp"
+#include "opentxs/network/zeromq/message/Message.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/WorkType.hpp"
+
+namespace ottest
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+using FilterType = ot::blockchain::cfilter::Type;
+using SyncReader = ot::blockchain::node::base::SyncReader;
+
+constexpr auto chain_ = ot::blockchain::Type::UnitTest;
+constexpr auto chain_height_ = std::size_t{2000};
+
+auto stored_filter() noexcept -> ot::ReadView
+{
+    const auto& filter = bch_filter_1307544_;
+
+    return {reinterpret_cast<const char*>(filter.data()), filter.size()};
+}
+
+auto percentile(ot::UnallocatedVector<double>& samples, double p) noexcept
+    -> double
+{
+    if (samples.empty()) { return 0.0; }
+
+    const auto index = static_cast<std::size_t>(
+        p * static_cast<double>(samples.size() - 1u));
+    const auto i = std::next(samples.begin(), index);
+    std::nth_element(samples.begin(), i, samples.end());
+
+    return *i;
+}
+
+// Measures the work the sync server does for each packet it publishes.
+// SyncReader prepares the header and filter bytes for one chunk, then the
+// chunk is packed into a sync packet and serialized as in the assembly stage.
+// Storage is replaced by loaders which return the same header and filter for
+// every block and no sockets are used, so this does not measure SyncServer
+// end to end. Each thread prepares every chunk of a 2000 block chain, which
+// shows how packet preparation scales when chunks are prepared concurrently.
+auto sync_server_prepare(benchmark::State& state) -> void
+{
+    const auto block = ParseBip158Block();
+
+    if (false == bool(block)) {
+        state.SkipWithError("failed to load block");
+
+        return;
+    }
+
+    const auto header = block->Header().as_Bitcoin();
+    const auto filter = stored_filter();
+    const auto reader = SyncReader{
+        [&](const auto& blocks, const auto& visitor) {
+            for (const auto& hash : blocks) { visitor(hash, filter); }
+
+            return blocks.size();
+        },
+        [&](const auto&) { return header->as_Bitcoin(); },
+        {}};
+    const auto chunks = SyncReader::Chunks(chain_height_);
+    const auto hashes = [] {
+        auto out = SyncReader::Hashes{};
+        out.reserve(SyncReader::chunk_);
+
+        for (auto i = std::size_t{0}; i < SyncReader::chunk_; ++i) {
+            out.emplace_back();
+        }
+
+        return out;
+    }();
+    const auto cfheader = ot::Space(32u, std::byte{0x0});
+    auto latency = ot::UnallocatedVector<double>{};
+    latency.reserve(chunks.size());
+    auto packets = std::size_t{0};
+
+    for ([[maybe_unused]] auto _ : state) {
+        for (const auto& [first, last] : chunks) {
+            const auto start = Clock::now();
+            const auto prepared = reader.Prepare(hashes);
+            auto items = ot::UnallocatedVector<ot::network::p2p::Block>{};
+            items.reserve(prepared.size());
+            auto height = static_cast<ot::blockchain::block::Height>(first);
+
+            for (const auto& data : prepared) {
+                items.emplace_back(
+                    chain_,
+                    height++,
+                    FilterType::Basic_BIP158,
+                    data.count_,
+                    ot::reader(data.header_),
+                    ot::reader(data.filter_));
+            }
+
+            const auto tip = ot::blockchain::block::Position{
+                static_cast<ot::blockchain::block::Height>(last - 1u),
+                ot::blockchain::block::Hash{}};
+            const auto msg = ot::factory::BlockchainSyncData(
+                ot::WorkType::P2PBlockchainNewBlock,
+                {chain_, tip},
+                std::move(items),
+                ot::reader(cfheader));
+            auto out = ot::network::zeromq::Message{};
+
+            if (false == msg.Serialize(out)) {
+                state.SkipWithError("failed to serialize packet");
+
+                return;
+            }
+
+            benchmark::DoNotOptimize(out);
+            latency.emplace_back(
+                std::chrono::duration<double, std::micro>(Clock::now() - start)
+                    .count());
+            ++packets;
+        }
+    }
+
+    using Counter = benchmark::Counter;
+    state.SetItemsProcessed(static_cast<std::int64_t>(packets));
+    state.counters["p50_us"] =
+        Counter(percentile(latency, 0.50), Counter::kAvgThreads);
+    state.counters["p99_us"] =
+        Counter(percentile(latency, 0.99), Counter::kAvgThreads);
+}
+}  // namespace
+
+BENCHMARK(sync_server_prepare)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(8)
+    ->UseRealTime();
+}  // namespace ottest
@@ -0,0 +1,207 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Common.hpp"
+#include "blockchain/node/wallet/spend/BitcoinTransactionBuilder.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/api/crypto/Blockchain.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/api/session/Wallet.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Script.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/crypto/Account.hpp"
+#include "opentxs/blockchain/crypto/Element.hpp"
+#include "opentxs/blockchain/crypto/HD.hpp"
+#include "opentxs/blockchain/crypto/HDProtocol.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/crypto/key/EllipticCurve.hpp"  // IWYU pragma: keep
+#include "opentxs/identity/Nym.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/PasswordPrompt.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "serialization/protobuf/BlockchainTransactionProposal.pb.h"
+#include "serialization/protobuf/BlockchainTransactionProposedOutput.pb.h"
+
+namespace ottest
+{
+namespace
+{
+using Builder = ot::blockchain::node::wallet::BitcoinTransactionBuilder;
+
+constexpr auto chain_ = ot::blockchain::Type::UnitTest;
+constexpr auto max_inputs_ = std::size_t{1000};
+constexpr auto value_ = std::int64_t{100000000};
+
+// Wallet state shared by every run: a nym with a BIP-44 account, a proposal
+// paying to that account and enough outputs to fund the largest transaction
+struct Wallet {
+    ot::Nym_p nym_;
+    Builder::Proposal proposal_;
+    ot::UnallocatedVector<Builder::UTXO> utxos_;
+
+    Wallet(const ot::api::session::Client& api) noexcept
+        : nym_()
+        , proposal_()
+        , utxos_()
+    {
+        using Subchain = ot::blockchain::crypto::Subchain;
+        const auto reason = api.Factory().PasswordPrompt(__func__);
+        nym_ = api.Wallet().Nym(reason, "Bench");
+
+        if (!nym_) { return; }
+
+        api.Crypto().Blockchain().NewHDSubaccount(
+            nym_->ID(),
+            ot::blockchain::crypto::HDProtocol::BIP_44,
+            chain_,
+            reason);
+        const auto& account = api.Crypto()
+                                  .Blockchain()
+                                  .Account(nym_->ID(), chain_)
+                                  .GetHD()
+                                  .at(0);
+
+        {
+            const auto id = [&] {
+                auto out = api.Factory().Identifier();
+                out->Randomize();
+
+                return out;
+            }();
+            const auto& sender = nym_->ID();
+            proposal_.set_version(1);
+            proposal_.set_id(id->str());
+            proposal_.set_initiator(sender.data(), sender.size());
+            auto& output = *proposal_.add_output();
+            output.set_version(1);
+            ot::Amount{value_}.Serialize(ot::writer(output.mutable_amount()));
+            const auto& element = account.BalanceElement(Subchain::Internal, 0);
+            output.set_pubkeyhash(element.PubkeyHash()->str());
+        }
+
+        using OutputBuilder = ot::api::session::Factory::OutputBuilder;
+        auto outputs = ot::UnallocatedVector<OutputBuilder>{};
+
+        for (auto i = std::size_t{0}; i < max_inputs_; ++i) {
+            const auto index = account.Reserve(Subchain::External, reason);
+
+            if (false == index.has_value()) { return; }
+
+            const auto& element =
+                account.BalanceElement(Subchain::External, index.value());
+            const auto key = element.Key();
+
+            if (!key) { return; }
+
+            outputs.emplace_back(
+                ot::blockchain::Amount{value_},
+                api.Factory().BitcoinScriptP2PKH(chain_, *key),
+                ot::UnallocatedSet<ot::blockchain::crypto::Key>{
+                    element.KeyID()});
+        }
+
+        const auto pTX = api.Factory().BitcoinGenerationTransaction(
+            chain_, 1, std::move(outputs));
+
+        if (!pTX) { return; }
+
+        const auto& tx = *pTX;
+
+        for (auto i = std::uint32_t{0}; i < tx.Outputs().size(); ++i) {
+            utxos_.emplace_back(
+                ot::blockchain::block::Outpoint{tx.ID().Bytes(), i},
+                tx.Outputs().at(i).Internal().clone());
+        }
+    }
+};
+
+auto wallet() noexcept -> const Wallet&
+{
+    static const auto wallet = Wallet{Client()};
+
+    return wallet;
+}
+
+// Signs a P2PKH transaction with the number of inputs given by the benchmark
+// argument. Building the unsigned transaction is excluded from the timing.
+auto sign_inputs(benchmark::State& state, const bool parallel) -> void
+{
+    const auto& api = Client();
+    const auto& data = wallet();
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    if (data.utxos_.size() < count) {
+        state.SkipWithError("failed to create wallet outputs");
+
+        return;
+    }
+
+    const auto id = api.Factory().Identifier(data.proposal_.id());
+
+    for ([[maybe_unused]] auto _ : state) {
+        state.PauseTiming();
+        auto builder = std::make_unique<Builder>(
+            api, id, data.proposal_, chain_, ot::Amount{value_ / 1000});
+        auto ready = builder->CreateOutputs(data.proposal_);
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            ready &= builder->AddInput(data.utxos_.at(i));
+        }
+
+        if (false == ready) {
+            state.SkipWithError("failed to build transaction");
+
+            return;
+        }
+
+        state.ResumeTiming();
+
+        if (false == builder->SignInputs(parallel)) {
+            state.SkipWithError("failed to sign transaction");
+
+            return;
+        }
+
+        state.PauseTiming();
+        builder.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * count));
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(sign_inputs, serial, false)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(sign_inputs, parallel, true)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+}  // namespace ottest
@@ -104,10 +104,12 @@ public:
 
     QString accountID() const noexcept;
     int balancePolarity() const noexcept;
+    auto canFetchMore(const QModelIndex& parent) const noexcept -> bool final;
     // Each item in the list is an opentxs::blockchain::Type enum value cast to
     // an int
     QVariantList depositChains() const noexcept;
     QString displayBalance() const noexcept;
+    auto fetchMore(const QModelIndex& parent) noexcept -> void final;
     AmountValidator* getAmountValidator() const noexcept;
     DestinationValidator* getDestValidator() const noexcept;
     DisplayScaleQt* getScaleModel() const noexcept;
@@ -156,6 +156,7 @@ private slots:
 
 private:
     friend ModelHelper;
+    friend internal::Model;
 
     auto make_index(const internal::Index& index) const noexcept -> QModelIndex;
 
@@ -40,6 +40,7 @@ public:
     virtual auto AccountID() const noexcept -> UnallocatedCString = 0;
     virtual auto Balance() const noexcept -> const Amount = 0;
     virtual auto BalancePolarity() const noexcept -> int = 0;
+    virtual auto CanLoadMore() const noexcept -> bool = 0;
     virtual auto ContractID() const noexcept -> UnallocatedCString = 0;
     virtual auto DepositAddress() const noexcept -> UnallocatedCString = 0;
     virtual auto DepositAddress(const blockchain::Type chain) const noexcept
@@ -50,6 +51,7 @@ public:
     virtual auto DisplayUnit() const noexcept -> UnallocatedCString = 0;
     virtual auto First() const noexcept
         -> opentxs::SharedPimpl<opentxs::ui::BalanceItem> = 0;
+    virtual auto LoadMore() const noexcept -> void = 0;
     virtual auto Name() const noexcept -> UnallocatedCString = 0;
     virtual auto Next() const noexcept
         -> opentxs::SharedPimpl<opentxs::ui::BalanceItem> = 0;
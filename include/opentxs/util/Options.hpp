@@ -9,6 +9,7 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <chrono>
 #include <cstdint>
 
 #include "opentxs/blockchain/Types.hpp"
@@ -31,7 +32,11 @@ public:
         -> const UnallocatedSet<UnallocatedCString>&;
     auto BlockchainBindIpv6() const noexcept
         -> const UnallocatedSet<UnallocatedCString>&;
+    auto BlockchainSpendBatchOutputs() const noexcept -> std::size_t;
+    auto BlockchainSpendBatchWindow() const noexcept
+        -> std::chrono::milliseconds;
     auto BlockchainStorageLevel() const noexcept -> int;
+    auto BlockchainSyncParanoid() const noexcept -> bool;
     auto BlockchainWalletEnabled() const noexcept -> bool;
     auto DefaultMintKeyBytes() const noexcept -> std::size_t;
     auto DisabledBlockchains() const noexcept
@@ -62,6 +67,7 @@ public:
     auto RemoteLogEndpoint() const noexcept -> const char*;
     auto StoragePrimaryPlugin() const noexcept -> const char*;
     auto TestMode() const noexcept -> bool;
+    auto UIUpdateInterval() const noexcept -> std::chrono::milliseconds;
 
     auto AddBlockchainIpv4Bind(const char* endpoint) noexcept -> Options&;
     auto AddBlockchainIpv6Bind(const char* endpoint) noexcept -> Options&;
@@ -75,8 +81,13 @@ public:
         const char* key,
         const char* value) noexcept -> Options&;
     auto ParseCommandLine(int argc, char** argv) noexcept -> Options&;
+    auto SetBlockchainSpendBatchOutputs(std::size_t count) noexcept
+        -> Options&;
+    auto SetBlockchainSpendBatchWindow(
+        std::chrono::milliseconds window) noexcept -> Options&;
     auto SetBlockchainStorageLevel(int value) noexcept -> Options&;
     auto SetBlockchainSyncEnabled(bool enabled) noexcept -> Options&;
+    auto SetBlockchainSyncParanoid(bool paranoid) noexcept -> Options&;
     auto SetBlockchainWalletEnabled(bool enabled) noexcept -> Options&;
     auto SetDefaultMintKeyBytes(std::size_t bytes) noexcept -> Options&;
     auto SetHome(const char* path) noexcept -> Options&;
@@ -93,6 +104,8 @@ public:
     auto SetQtRootObject(QObject*) noexcept -> Options&;
     auto SetStoragePlugin(const char* name) noexcept -> Options&;
     auto SetTestMode(bool test) noexcept -> Options&;
+    auto SetUIUpdateInterval(std::chrono::milliseconds interval) noexcept
+        -> Options&;
 
     Options() noexcept;
     Options(int argc, char** argv) noexcept;
@@ -70,6 +70,7 @@ enum class WorkType : OTZMQWorkType {
     OTXResponse = 4097,
     OTXPush = 4098,
     OTXLegacyXML = 4099,
+    OTXLegacyBinary = 4100,
 };
 
 constexpr auto value(const WorkType in) noexcept
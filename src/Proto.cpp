@@ -6,7 +6,9 @@
 #include "0_stdafx.hpp"  // IWYU pragma: associated
 #include "Proto.tpp"     // IWYU pragma: associated
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: keep
+#include <cstddef>
 #include <limits>
 
 #include "Proto.hpp"
@@ -35,6 +37,16 @@ auto operator==(const ProtobufType& lhs, const ProtobufType& rhs) noexcept
 
 namespace opentxs::proto
 {
+auto BatchArenaOptions(std::size_t blockSize) noexcept
+    -> google::protobuf::ArenaOptions
+{
+    auto out = google::protobuf::ArenaOptions{};
+    out.start_block_size = blockSize;
+    out.max_block_size = blockSize;
+
+    return out;
+}
+
 auto ToString(const ProtobufType& input) -> UnallocatedCString
 {
     auto output = UnallocatedCString{};
@@ -7,6 +7,7 @@
 
 #include "Proto.hpp"  // IWYU pragma: associated
 
+#include <google/protobuf/arena.h>
 #include <cassert>
 #include <cstddef>
 #include <iostream>
@@ -30,6 +31,21 @@ template <typename Output, typename Input>
 Output Factory(const Pimpl<Input>& input);
 template <typename Output, typename Input>
 Output Factory(const Input& input);
+template <typename Output>
+Output* Factory(
+    google::protobuf::Arena& arena,
+    const void* input,
+    const std::size_t size);
+template <typename Output, typename Input>
+Output* Factory(google::protobuf::Arena& arena, const Input& input);
+
+/// Options for an arena shared by a batch of parse or serialize operations
+///
+/// Bulk load paths should allocate one arena per batch, parse every message
+/// with the arena-aware Factory overloads, and call Reset() on the arena
+/// whenever the parsed messages are no longer needed.
+auto BatchArenaOptions(std::size_t blockSize) noexcept
+    -> google::protobuf::ArenaOptions;
 
 template <typename Output>
 Output Factory(const void* input, const std::size_t size)
@@ -43,6 +59,30 @@ Output Factory(const void* input, const std::size_t size)
     return serialized;
 }
 
+template <typename Output>
+Output* Factory(
+    google::protobuf::Arena& arena,
+    const void* input,
+    const std::size_t size)
+{
+    static_assert(sizeof(int) <= sizeof(std::size_t));
+    assert(size <= static_cast<std::size_t>(std::numeric_limits<int>::max()));
+
+    auto* serialized = google::protobuf::Arena::CreateMessage<Output>(&arena);
+
+    assert(nullptr != serialized);
+
+    serialized->ParseFromArray(input, static_cast<int>(size));
+
+    return serialized;
+}
+
+template <typename Output, typename Input>
+Output* Factory(google::protobuf::Arena& arena, const Input& input)
+{
+    return Factory<Output>(arena, input.data(), input.size());
+}
+
 template <typename Output, typename Input>
 Output Factory(const Pimpl<Input>& input)
 {
@@ -358,6 +358,14 @@ auto Blockchain::ProcessTransaction(
     return imp_->ProcessTransaction(chain, in, reason);
 }
 
+auto Blockchain::ProcessTransactions(
+    const Chain chain,
+    Transactions&& transactions,
+    const PasswordPrompt& reason) const noexcept -> bool
+{
+    return imp_->ProcessTransactions(chain, std::move(transactions), reason);
+}
+
 auto Blockchain::PubkeyHash(
     [[maybe_unused]] const Chain chain,
     const Data& pubkey) const noexcept(false) -> OTData
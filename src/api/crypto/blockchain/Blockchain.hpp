@@ -243,6 +243,10 @@ public:
         const Chain chain,
         const opentxs::blockchain::block::bitcoin::Transaction& transaction,
         const PasswordPrompt& reason) const noexcept -> bool final;
+    auto ProcessTransactions(
+        const Chain chain,
+        Transactions&& transactions,
+        const PasswordPrompt& reason) const noexcept -> bool final;
     auto RecipientContact(const Key& key) const noexcept -> OTIdentifier final;
     auto Release(const Key key) const noexcept -> bool final;
     auto ReportScan(
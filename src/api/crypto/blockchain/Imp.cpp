@@ -1142,6 +1142,14 @@ auto Blockchain::Imp::ProcessTransaction(
     return false;
 }
 
+auto Blockchain::Imp::ProcessTransactions(
+    const opentxs::blockchain::Type,
+    Blockchain::Transactions&&,
+    const PasswordPrompt&) const noexcept -> bool
+{
+    return false;
+}
+
 auto Blockchain::Imp::PubkeyHash(
     [[maybe_unused]] const opentxs::blockchain::Type chain,
     const Data& pubkey) const noexcept(false) -> OTData
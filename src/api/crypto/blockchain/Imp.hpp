@@ -255,6 +255,10 @@ struct Blockchain::Imp {
         const opentxs::blockchain::Type chain,
         const opentxs::blockchain::block::bitcoin::Transaction& in,
         const PasswordPrompt& reason) const noexcept -> bool;
+    virtual auto ProcessTransactions(
+        const opentxs::blockchain::Type chain,
+        Blockchain::Transactions&& transactions,
+        const PasswordPrompt& reason) const noexcept -> bool;
     auto PubkeyHash(const opentxs::blockchain::Type chain, const Data& pubkey)
         const noexcept(false) -> OTData;
     auto RecipientContact(const Key& key) const noexcept -> OTIdentifier;
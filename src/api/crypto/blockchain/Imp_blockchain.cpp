@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iosfwd>
 #include <iterator>
 #include <mutex>
@@ -102,6 +103,7 @@ BlockchainImp::BlockchainImp(
         return out;
     }())
     , balances_(api_)
+    , transaction_locks_()
 {
 }
 
@@ -208,7 +210,7 @@ auto BlockchainImp::AssignTransactionMemo(
     const TxidHex& id,
     const UnallocatedCString& label) const noexcept -> bool
 {
-    auto lock = Lock{lock_};
+    auto lock = Lock{transaction_mutex(id)};
     auto pTransaction = load_transaction(lock, id);
 
     if (false == bool(pTransaction)) {
@@ -308,7 +310,7 @@ auto BlockchainImp::KeyGenerated(
 auto BlockchainImp::LoadTransactionBitcoin(const TxidHex& txid) const noexcept
     -> std::unique_ptr<const opentxs::blockchain::block::bitcoin::Transaction>
 {
-    auto lock = Lock{lock_};
+    auto lock = Lock{transaction_mutex(txid)};
 
     return load_transaction(lock, txid);
 }
@@ -316,7 +318,7 @@ auto BlockchainImp::LoadTransactionBitcoin(const TxidHex& txid) const noexcept
 auto BlockchainImp::LoadTransactionBitcoin(const Txid& txid) const noexcept
     -> std::unique_ptr<const opentxs::blockchain::block::bitcoin::Transaction>
 {
-    auto lock = Lock{lock_};
+    auto lock = Lock{transaction_mutex(txid)};
 
     return load_transaction(lock, txid);
 }
@@ -336,6 +338,32 @@ auto BlockchainImp::load_transaction(const Lock& lock, const Txid& txid)
         txid.Bytes());
 }
 
+auto BlockchainImp::lock_transactions(
+    const Blockchain::Transactions& transactions) const noexcept
+    -> UnallocatedVector<Lock>
+{
+    // NOTE mutexes are always acquired in index order so that concurrent
+    // batches with overlapping transactions can not deadlock
+    auto indices = UnallocatedSet<std::size_t>{};
+
+    for (const auto& tx : transactions) {
+        OT_ASSERT(tx);
+
+        indices.emplace(
+            std::hash<ReadView>{}(tx->ID().Bytes()) %
+            transaction_locks_.size());
+    }
+
+    auto output = UnallocatedVector<Lock>{};
+    output.reserve(indices.size());
+
+    for (const auto index : indices) {
+        output.emplace_back(transaction_locks_[index]);
+    }
+
+    return output;
+}
+
 auto BlockchainImp::LookupContacts(const Data& pubkeyHash) const noexcept
     -> ContactList
 {
@@ -387,46 +415,69 @@ auto BlockchainImp::ProcessTransaction(
     const opentxs::blockchain::block::bitcoin::Transaction& in,
     const PasswordPrompt& reason) const noexcept -> bool
 {
-    const auto& db = api_.Network().Blockchain().Internal().Database();
-    auto copy = in.clone();
+    auto transactions = Blockchain::Transactions{};
+    transactions.emplace_back(in.clone());
 
-    OT_ASSERT(copy);
+    OT_ASSERT(transactions.back());
 
-    auto lock = Lock{lock_};
-    const auto& id = in.ID();
-    const auto txid = id.Bytes();
+    return ProcessTransactions(chain, std::move(transactions), reason);
+}
 
-    if (auto tx = db.LoadTransaction(txid); tx) {
-        tx->Internal().MergeMetadata(chain, in.Internal());
+auto BlockchainImp::ProcessTransactions(
+    const opentxs::blockchain::Type chain,
+    Blockchain::Transactions&& transactions,
+    const PasswordPrompt& reason) const noexcept -> bool
+{
+    if (transactions.empty()) { return true; }
 
-        if (false == db.StoreTransaction(*tx)) {
-            LogError()(OT_PRETTY_CLASS())(
-                "failed to save updated transaction ")(id.asHex())
-                .Flush();
+    const auto& db = api_.Network().Blockchain().Internal().Database();
+    const auto locks = lock_transactions(transactions);
+    auto batch = Blockchain::Transactions{};
+    auto index = UnallocatedMap<ReadView, std::size_t>{};
+    batch.reserve(transactions.size());
 
-            return false;
-        }
+    for (auto& tx : transactions) {
+        const auto txid = tx->ID().Bytes();
 
-        copy.swap(tx);
-    } else {
-        if (false == db.StoreTransaction(in)) {
-            LogError()(OT_PRETTY_CLASS())("failed to save new transaction ")(
-                id.asHex())
-                .Flush();
+        if (auto i = index.find(txid); index.end() != i) {
+            batch.at(i->second)->Internal().MergeMetadata(
+                chain, tx->Internal());
 
-            return false;
+            continue;
+        }
+
+        if (auto existing = db.LoadTransaction(txid); existing) {
+            existing->Internal().MergeMetadata(chain, tx->Internal());
+            tx.swap(existing);
         }
+
+        index.emplace(tx->ID().Bytes(), batch.size());
+        batch.emplace_back(std::move(tx));
     }
 
-    if (false == db.AssociateTransaction(id, copy->Internal().GetPatterns())) {
-        LogError()(OT_PRETTY_CLASS())("associate patterns for transaction ")(
-            id.asHex())
+    if (false == db.StoreTransactions(batch)) {
+        LogError()(OT_PRETTY_CLASS())("failed to save ")(batch.size())(
+            " transactions")
             .Flush();
 
         return false;
     }
 
-    return reconcile_activity_threads(lock, *copy);
+    if (false == db.AssociateTransactions(batch)) {
+        LogError()(OT_PRETTY_CLASS())("failed to associate patterns for ")(
+            batch.size())(" transactions")
+            .Flush();
+
+        return false;
+    }
+
+    auto output{true};
+
+    for (const auto& tx : batch) {
+        output &= reconcile_activity_threads(*tx);
+    }
+
+    return output;
 }
 
 auto BlockchainImp::reconcile_activity_threads(
@@ -437,11 +488,10 @@ auto BlockchainImp::reconcile_activity_threads(
 
     if (false == bool(tx)) { return false; }
 
-    return reconcile_activity_threads(lock, *tx);
+    return reconcile_activity_threads(*tx);
 }
 
 auto BlockchainImp::reconcile_activity_threads(
-    const Lock& lock,
     const opentxs::blockchain::block::bitcoin::Transaction& tx) const noexcept
     -> bool
 {
@@ -486,7 +536,7 @@ auto BlockchainImp::Unconfirm(
     const Time time) const noexcept -> bool
 {
     auto out = Imp::Unconfirm(key, txid, time);
-    auto lock = Lock{lock_};
+    auto lock = Lock{transaction_mutex(txid)};
 
     if (auto tx = load_transaction(lock, txid); tx) {
         static const auto null =
@@ -506,6 +556,19 @@ auto BlockchainImp::Unconfirm(
     return out;
 }
 
+auto BlockchainImp::transaction_mutex(const Txid& txid) const noexcept
+    -> std::mutex&
+{
+    return transaction_locks_[
+        std::hash<ReadView>{}(txid.Bytes()) % transaction_locks_.size()];
+}
+
+auto BlockchainImp::transaction_mutex(const TxidHex& txid) const noexcept
+    -> std::mutex&
+{
+    return transaction_mutex(api_.Factory().DataFromHex(txid));
+}
+
 auto BlockchainImp::UpdateBalance(
     const opentxs::blockchain::Type chain,
     const opentxs::blockchain::Balance balance) const noexcept -> void
@@ -547,10 +610,12 @@ auto BlockchainImp::UpdateElement(
                 std::back_inserter(transactions));
         });
     dedup(transactions);
-    auto lock = Lock{lock_};
     std::for_each(
         std::begin(transactions),
         std::end(transactions),
-        [&](const auto& txid) { reconcile_activity_threads(lock, txid); });
+        [&](const auto& txid) {
+            auto lock = Lock{transaction_mutex(txid)};
+            reconcile_activity_threads(lock, txid);
+        });
 }
 }  // namespace opentxs::api::crypto::imp
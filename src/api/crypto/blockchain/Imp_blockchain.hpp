@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <functional>
@@ -161,6 +162,10 @@ struct BlockchainImp final : public Blockchain::Imp {
         const opentxs::blockchain::Type chain,
         const opentxs::blockchain::block::bitcoin::Transaction& in,
         const PasswordPrompt& reason) const noexcept -> bool final;
+    auto ProcessTransactions(
+        const opentxs::blockchain::Type chain,
+        Blockchain::Transactions&& transactions,
+        const PasswordPrompt& reason) const noexcept -> bool final;
     auto ReportScan(
         const opentxs::blockchain::Type chain,
         const identifier::Nym& owner,
@@ -197,6 +202,8 @@ struct BlockchainImp final : public Blockchain::Imp {
     ~BlockchainImp() final = default;
 
 private:
+    using TransactionLocks = std::array<std::mutex, 32>;
+
     const api::session::Activity& activity_;
     const CString key_generated_endpoint_;
     OTZMQPublishSocket transaction_updates_;
@@ -204,6 +211,11 @@ private:
     OTZMQPublishSocket scan_updates_;
     OTZMQPublishSocket new_blockchain_accounts_;
     blockchain::BalanceOracle balances_;
+    // NOTE guards read-modify-write cycles on stored transactions. Each
+    // transaction maps to one mutex by txid so unrelated transactions,
+    // including those processed by different chains at the same time, do not
+    // serialize on each other.
+    mutable TransactionLocks transaction_locks_;
 
     auto broadcast_update_signal(const Txid& txid) const noexcept -> void
     {
@@ -214,6 +226,8 @@ private:
     auto broadcast_update_signal(
         const opentxs::blockchain::block::bitcoin::Transaction& tx)
         const noexcept -> void;
+    auto lock_transactions(const Blockchain::Transactions& transactions)
+        const noexcept -> UnallocatedVector<Lock>;
     auto load_transaction(const Lock& lock, const Txid& id) const noexcept
         -> std::unique_ptr<opentxs::blockchain::block::bitcoin::Transaction>;
     auto load_transaction(const Lock& lock, const TxidHex& id) const noexcept
@@ -227,8 +241,9 @@ private:
     auto reconcile_activity_threads(const Lock& lock, const Txid& txid)
         const noexcept -> bool;
     auto reconcile_activity_threads(
-        const Lock& lock,
         const opentxs::blockchain::block::bitcoin::Transaction& tx)
         const noexcept -> bool;
+    auto transaction_mutex(const Txid& txid) const noexcept -> std::mutex&;
+    auto transaction_mutex(const TxidHex& txid) const noexcept -> std::mutex&;
 };
 }  // namespace opentxs::api::crypto::imp
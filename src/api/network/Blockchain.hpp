@@ -48,6 +48,11 @@ class Database;
 
 namespace node
 {
+namespace blockoracle
+{
+class BlockCache;
+}  // namespace blockoracle
+
 class Manager;
 }  // namespace node
 }  // namespace blockchain
@@ -91,6 +96,11 @@ struct Blockchain::Imp : virtual public internal::Blockchain {
     {
         OT_FAIL;
     }
+    auto BlockCache() const noexcept
+        -> const opentxs::blockchain::node::blockoracle::BlockCache& override
+    {
+        OT_FAIL;
+    }
     auto BlockQueueUpdate() const noexcept
         -> const zmq::socket::Publish& override
     {
@@ -45,6 +45,7 @@ BlockchainImp::BlockchainImp(
     : api_(api)
     , crypto_(nullptr)
     , db_(nullptr)
+    , block_cache_()
     , active_peer_updates_([&] {
         auto out = zmq.PublishSocket();
         const auto listen = out->Start(endpoints.BlockchainPeer().data());
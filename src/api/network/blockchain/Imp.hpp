@@ -19,6 +19,7 @@
 #include "api/network/Blockchain.hpp"
 #include "api/network/blockchain/StartupPublisher.hpp"
 #include "blockchain/database/common/Database.hpp"
+#include "blockchain/node/blockoracle/BlockCache.hpp"
 #include "internal/api/network/Blockchain.hpp"
 #include "internal/blockchain/node/Node.hpp"
 #include "internal/network/p2p/Client.hpp"
@@ -112,6 +113,11 @@ struct BlockchainImp final : public Blockchain::Imp {
     {
         return block_available_;
     }
+    auto BlockCache() const noexcept
+        -> const opentxs::blockchain::node::blockoracle::BlockCache& final
+    {
+        return block_cache_;
+    }
     auto BlockQueueUpdate() const noexcept -> const zmq::socket::Publish& final
     {
         return block_download_queue_;
@@ -194,6 +200,8 @@ private:
     const api::Session& api_;
     const api::crypto::Blockchain* crypto_;
     std::unique_ptr<opentxs::blockchain::database::common::Database> db_;
+    // NOTE declared before networks_ so cached blocks outlive every chain
+    opentxs::blockchain::node::blockoracle::BlockCache block_cache_;
     OTZMQPublishSocket active_peer_updates_;
     OTZMQPublishSocket block_available_;
     OTZMQPublishSocket block_download_queue_;
@@ -7,12 +7,11 @@
 #include "1_Internal.hpp"                      // IWYU pragma: associated
 #include "api/session/activity/MailCache.hpp"  // IWYU pragma: associated
 
-#include <chrono>
+#include <condition_variable>
 #include <cstring>
 #include <functional>
 #include <iterator>
 #include <mutex>
-#include <queue>
 #include <utility>
 
 #include "internal/api/network/Asio.hpp"
@@ -27,6 +26,7 @@
 #include "opentxs/api/session/Storage.hpp"
 #include "opentxs/api/session/Wallet.hpp"
 #include "opentxs/core/Armored.hpp"
+#include "opentxs/core/Secret.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/contract/peer/PeerObject.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
@@ -59,6 +59,7 @@ struct MailCache::Imp {
         const otx::client::StorageBox box_;
         const SimpleCallback done_;
         std::promise<UnallocatedCString> promise_;
+        const std::shared_future<UnallocatedCString> future_;
 
         Task(
             const api::Session& api,
@@ -81,6 +82,7 @@ struct MailCache::Imp {
             , box_(box)
             , done_(std::move(done))
             , promise_()
+            , future_(promise_.get_future())
         {
             ++counter_;
         }
@@ -95,6 +97,40 @@ struct MailCache::Imp {
         auto operator=(Task&&) -> Task& = delete;
     };
 
+    static constexpr auto default_limit_ = 32_MiB;
+
+    auto Bytes() const noexcept -> std::size_t
+    {
+        auto lock = Lock{lock_};
+
+        return cached_bytes_;
+    }
+    auto Decrypt(
+        const identifier::Nym& nymID,
+        const Identifier& id,
+        const otx::client::StorageBox box,
+        const PasswordPrompt& reason) const noexcept -> UnallocatedCString
+    {
+        const auto mail = Mail(nymID, id, box);
+
+        if (!mail) { return "Error: Unable to load mail item"; }
+
+        const auto nym = api_.Wallet().Nym(nymID);
+
+        if (false == bool(nym)) {
+
+            return "Error: Unable to load recipient nym";
+        }
+
+        const auto object =
+            api_.Factory().PeerObject(nym, mail->m_ascPayload, reason);
+
+        if (!object) { return "Error: Unable to decrypt message"; }
+
+        if (!object->Message()) { return "Unable to display message"; }
+
+        return *object->Message();
+    }
     auto Mail(
         const identifier::Nym& nym,
         const Identifier& id,
@@ -161,38 +197,7 @@ struct MailCache::Imp {
 
             cb();
         }};
-        const auto mail = Mail(task.nym_, task.item_, task.box_);
-
-        if (!mail) {
-            message = "Error: Unable to load mail item";
-
-            return;
-        }
-
-        const auto nym = api_.Wallet().Nym(task.nym_);
-
-        if (false == bool(nym)) {
-            message = "Error: Unable to load recipient nym";
-
-            return;
-        }
-
-        const auto object =
-            api_.Factory().PeerObject(nym, mail->m_ascPayload, task.reason_);
-
-        if (!object) {
-            message = "Error: Unable to decrypt message";
-
-            return;
-        }
-
-        if (!object->Message()) {
-            message = "Unable to display message";
-
-            return;
-        }
-
-        message = *object->Message();
+        message = load_(task.nym_, task.item_, task.box_, task.reason_);
     }
 
     auto CacheText(
@@ -202,10 +207,8 @@ struct MailCache::Imp {
         const UnallocatedCString& text) noexcept -> void
     {
         auto key = this->key(nym, id, box);
-        auto promise = std::promise<UnallocatedCString>{};
-        promise.set_value(text);
         auto lock = Lock{lock_};
-        results_.try_emplace(std::move(key), promise.get_future());
+        cache(lock, key, text);
     }
     auto Get(
         const identifier::Nym& nym,
@@ -217,9 +220,18 @@ struct MailCache::Imp {
         auto lock = Lock{lock_};
         auto key = this->key(nym, id, box);
 
-        if (const auto it = results_.find(key); results_.end() != it) {
+        if (auto it = cache_.find(key); cache_.end() != it) {
+            auto& entry = it->second;
+            lru_.splice(lru_.begin(), lru_, entry.position_);
+            auto promise = std::promise<UnallocatedCString>{};
+            promise.set_value(UnallocatedCString{entry.text_->Bytes()});
+
+            return promise.get_future();
+        }
+
+        if (const auto it = tasks_.find(key); tasks_.end() != it) {
 
-            return it->second;
+            return it->second.future_;
         }
 
         auto [tIt, newTask] = tasks_.try_emplace(
@@ -235,47 +247,76 @@ struct MailCache::Imp {
         OT_ASSERT(newTask);
 
         auto& task = tIt->second;
-        const auto [fIt, newFuture] =
-            results_.try_emplace(key, task.promise_.get_future());
-
-        OT_ASSERT(newFuture);
-
-        const auto& future = fIt->second;
-        fifo_.push(std::move(key));
         const auto sent = api_.Network().Asio().Internal().Post(
             ThreadPool::General,
             [this, pTask = &task] { ProcessThreadPool(pTask); });
 
         OT_ASSERT(sent);
 
-        return future;
+        return task.future_;
     }
 
     Imp(const api::Session& api,
-        const opentxs::network::zeromq::socket::Publish& messageLoaded) noexcept
+        const opentxs::network::zeromq::socket::Publish& messageLoaded,
+        const std::size_t limit,
+        Loader load) noexcept
         : api_(api)
         , message_loaded_(messageLoaded)
+        , limit_(limit)
+        , load_(load ? std::move(load) : [this](const auto&... args) {
+            return Decrypt(args...);
+        })
         , lock_()
+        , finished_()
         , jobs_()
         , cached_bytes_(0)
         , tasks_()
-        , results_()
-        , fifo_()
+        , cache_()
+        , lru_()
     {
     }
 
-    ~Imp() = default;
+    ~Imp()
+    {
+        // NOTE tasks remove themselves from tasks_ after their job count has
+        // been decremented
+        auto lock = Lock{lock_};
+        finished_.wait(lock, [this] { return tasks_.empty(); });
+    }
 
 private:
+    using LRU = UnallocatedList<OTIdentifier>;
+
+    // NOTE only the cached copy of the plaintext is held in secure memory
+    // and wiped when the item is evicted. The copies returned by Get, held
+    // by the shared state of a task's future and published in the
+    // MessageLoaded notification are ordinary strings which are not wiped.
+    // Evicted items are decrypted again the next time they are requested.
+    struct Entry {
+        OTSecret text_;
+        LRU::iterator position_;
+
+        Entry(OTSecret&& text, LRU::iterator position) noexcept
+            : text_(std::move(text))
+            , position_(position)
+        {
+        }
+    };
+
+    // Approximate memory used by an item in addition to its plaintext
+    static constexpr auto overhead_ = std::size_t{256};
+
     const api::Session& api_;
     const opentxs::network::zeromq::socket::Publish& message_loaded_;
+    const std::size_t limit_;
+    const Loader load_;
     mutable std::mutex lock_;
+    std::condition_variable finished_;
     JobCounter jobs_;
     std::size_t cached_bytes_;
     UnallocatedMap<OTIdentifier, Task> tasks_;
-    UnallocatedMap<OTIdentifier, std::shared_future<UnallocatedCString>>
-        results_;
-    std::queue<OTIdentifier> fifo_;
+    UnallocatedMap<OTIdentifier, Entry> cache_;
+    LRU lru_;
 
     auto key(
         const identifier::Nym& nym,
@@ -299,42 +340,51 @@ private:
         return out;
     }
 
-    // NOTE this should only be called from the thread pool
-    auto finish_task(const Identifier& key) noexcept -> void
+    auto cache(
+        const Lock& lock,
+        const Identifier& key,
+        const UnallocatedCString& text) noexcept -> void
     {
-        static constexpr auto limit = 250_MiB;
-        static constexpr auto wait = 0s;
-
-        auto lock = Lock{lock_};
-        tasks_.erase(key);
-
-        {
-            const auto& result = results_.at(key).get();
-            cached_bytes_ += result.size();
+        if (auto it = cache_.find(key); cache_.end() != it) {
+            auto& entry = it->second;
+            cached_bytes_ -= entry.text_->size();
+            entry.text_->AssignText(text);
+            cached_bytes_ += entry.text_->size();
+            lru_.splice(lru_.begin(), lru_, entry.position_);
+        } else {
+            lru_.emplace_front(key);
+            cache_.try_emplace(
+                key, api_.Factory().SecretFromText(text), lru_.begin());
+            cached_bytes_ += text.size() + overhead_;
         }
 
-        while (cached_bytes_ > limit) {
-            // NOTE don't clear the only cached item, no matter how large
-            if (1 >= fifo_.size()) { break; }
-
-            {
-                auto& id = fifo_.front();
-
-                {
-                    const auto& future = results_.at(id);
-                    const auto status = future.wait_for(wait);
+        evict(lock);
+    }
+    auto evict(const Lock&) noexcept -> void
+    {
+        // NOTE don't evict the most recently used item, no matter how large
+        while ((cached_bytes_ > limit_) && (1u < lru_.size())) {
+            auto it = cache_.find(lru_.back());
 
-                    if (std::future_status::ready != status) { break; }
+            OT_ASSERT(cache_.end() != it);
 
-                    const auto& result = future.get();
-                    cached_bytes_ -= result.size();
-                }
+            cached_bytes_ -= it->second.text_->size() + overhead_;
+            cache_.erase(it);
+            lru_.pop_back();
+        }
+    }
+    // NOTE this should only be called from the thread pool
+    auto finish_task(const Identifier& key) noexcept -> void
+    {
+        auto lock = Lock{lock_};
+        auto it = tasks_.find(key);
 
-                results_.erase(id);
-            }
+        OT_ASSERT(tasks_.end() != it);
 
-            fifo_.pop();
-        }
+        const auto text = it->second.future_.get();
+        tasks_.erase(it);
+        cache(lock, key, text);
+        finished_.notify_all();
     }
 
     Imp() = delete;
@@ -347,10 +397,21 @@ private:
 MailCache::MailCache(
     const api::Session& api,
     const opentxs::network::zeromq::socket::Publish& messageLoaded) noexcept
-    : imp_(std::make_unique<Imp>(api, messageLoaded))
+    : MailCache(api, messageLoaded, Imp::default_limit_, {})
 {
 }
 
+MailCache::MailCache(
+    const api::Session& api,
+    const opentxs::network::zeromq::socket::Publish& messageLoaded,
+    const std::size_t limit,
+    Loader load) noexcept
+    : imp_(std::make_unique<Imp>(api, messageLoaded, limit, std::move(load)))
+{
+}
+
+auto MailCache::Bytes() const noexcept -> std::size_t { return imp_->Bytes(); }
+
 auto MailCache::CacheText(
     const identifier::Nym& nym,
     const Identifier& id,
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <future>
 #include <memory>
 
@@ -49,6 +51,15 @@ namespace opentxs::api::session::activity
 class MailCache
 {
 public:
+    // Returns the plaintext of a mail item
+    using Loader = std::function<UnallocatedCString(
+        const identifier::Nym&,
+        const Identifier&,
+        const otx::client::StorageBox,
+        const PasswordPrompt&)>;
+
+    // Size of the cached plaintext plus bookkeeping overhead
+    auto Bytes() const noexcept -> std::size_t;
     auto LoadMail(
         const identifier::Nym& nym,
         const Identifier& id,
@@ -60,6 +71,8 @@ public:
         const Identifier& id,
         const otx::client::StorageBox box,
         const UnallocatedCString& text) noexcept -> void;
+    // The returned text is an ordinary string. Only the copy retained by
+    // the cache is stored in secure memory.
     auto GetText(
         const identifier::Nym& nym,
         const Identifier& id,
@@ -71,6 +84,13 @@ public:
         const api::Session& api,
         const opentxs::network::zeromq::socket::Publish&
             messageLoaded) noexcept;
+    // Least recently used items are evicted when the cache exceeds limit
+    // bytes. If load is empty items are decrypted from storage.
+    MailCache(
+        const api::Session& api,
+        const opentxs::network::zeromq::socket::Publish& messageLoaded,
+        const std::size_t limit,
+        Loader load) noexcept;
 
     ~MailCache();
 
@@ -7,15 +7,20 @@
 #include "1_Internal.hpp"                    // IWYU pragma: associated
 #include "api/session/ui/UpdateManager.hpp"  // IWYU pragma: associated
 
+#include <boost/system/error_code.hpp>
+#include <chrono>
 #include <functional>
 #include <mutex>
 #include <string_view>
 #include <type_traits>  // IWYU pragma: keep
 #include <utility>
 
+#include "internal/api/network/Asio.hpp"
 #include "internal/network/zeromq/Context.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/Mutex.hpp"
+#include "internal/util/Timer.hpp"
+#include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Client.hpp"
 #include "opentxs/api/session/Endpoints.hpp"
@@ -30,8 +35,10 @@
 #include "opentxs/network/zeromq/socket/Publish.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Options.hpp"
 #include "opentxs/util/Types.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "util/Work.hpp"
 
 namespace zmq = opentxs::network::zeromq;
 
@@ -41,8 +48,7 @@ struct UpdateManager::Imp {
     auto ActivateUICallback(const Identifier& id) const noexcept -> void
     {
         pipeline_.Push([&] {
-            auto out = opentxs::network::zeromq::Message{};
-            out.StartBody();
+            auto out = MakeWork(Work::activate);
             out.AddFrame(id);
 
             return out;
@@ -85,55 +91,144 @@ struct UpdateManager::Imp {
 
     Imp(const api::session::Client& api) noexcept
         : api_(api)
+        , interval_(api.GetOptions().UIUpdateInterval())
         , lock_()
         , map_()
         , publisher_(api.Network().ZeroMQ().PublishSocket())
         , pipeline_(api.Network().ZeroMQ().Internal().Pipeline(
               [this](auto&& in) { pipeline(std::move(in)); }))
+        , timer_(api.Network().Asio().Internal().GetTimer())
+        , pending_()
+        , scheduled_(false)
     {
         publisher_->Start(api_.Endpoints().WidgetUpdate().data());
         LogTrace()(OT_PRETTY_CLASS())("using ZMQ batch ")(pipeline_.BatchID())
             .Flush();
     }
 
+    ~Imp()
+    {
+        timer_.Cancel();
+        pipeline_.Close();
+    }
+
 private:
+    enum class Work : OTZMQWorkType {
+        activate = OT_ZMQ_INTERNAL_SIGNAL + 0,
+        flush = OT_ZMQ_INTERNAL_SIGNAL + 1,
+    };
+
     const api::session::Client& api_;
+    // NOTE when non-zero, all activations of a widget received during the
+    // interval are delivered as a single update at the end of the interval
+    const std::chrono::milliseconds interval_;
     mutable std::mutex lock_;
     mutable UnallocatedMap<OTIdentifier, UnallocatedVector<SimpleCallback>>
         map_;
     OTZMQPublishSocket publisher_;
     opentxs::network::zeromq::Pipeline pipeline_;
+    Timer timer_;
+    UnallocatedSet<OTIdentifier> pending_;
+    bool scheduled_;
+
+    auto notify(const Identifier& id) noexcept -> void
+    {
+        {
+            auto lock = Lock{lock_};
+            auto it = map_.find(id);
+
+            if (map_.end() == it) { return; }
+
+            const auto& callbacks = it->second;
 
+            for (const auto& cb : callbacks) {
+                if (cb) { cb(); }
+            }
+        }
+
+        const auto& socket = publisher_.get();
+        socket.Send([&] {
+            auto work = opentxs::network::zeromq::tagged_message(
+                WorkType::UIModelUpdated);
+            work.AddFrame(id);
+
+            return work;
+        }());
+    }
     auto pipeline(zmq::Message&& in) noexcept -> void
     {
         const auto body = in.Body();
 
         OT_ASSERT(0u < body.size());
 
-        auto& idFrame = body.at(0);
+        const auto work = [&] {
+            try {
 
-        OT_ASSERT(0u < idFrame.size());
+                return body.at(0).as<Work>();
+            } catch (...) {
 
-        const auto id = api_.Factory().Identifier(idFrame);
-        auto lock = Lock{lock_};
-        auto it = map_.find(id);
+                OT_FAIL;
+            }
+        }();
 
-        if (map_.end() == it) { return; }
+        switch (work) {
+            case Work::activate: {
+                process_activate(in);
+            } break;
+            case Work::flush: {
+                process_flush();
+            } break;
+            default: {
+                LogError()(OT_PRETTY_CLASS())("Unhandled type").Flush();
 
-        const auto& callbacks = it->second;
+                OT_FAIL;
+            }
+        }
+    }
+    auto process_activate(const zmq::Message& in) noexcept -> void
+    {
+        const auto body = in.Body();
+
+        OT_ASSERT(1u < body.size());
+
+        const auto& idFrame = body.at(1);
+
+        OT_ASSERT(0u < idFrame.size());
 
-        for (const auto& cb : callbacks) {
-            if (cb) { cb(); }
+        auto id = api_.Factory().Identifier(idFrame);
+
+        if (0 == interval_.count()) {
+            notify(id);
+
+            return;
         }
 
-        const auto& socket = publisher_.get();
-        socket.Send([&] {
-            auto work = opentxs::network::zeromq::tagged_message(
-                WorkType::UIModelUpdated);
-            work.AddFrame(std::move(idFrame));
+        pending_.emplace(std::move(id));
 
-            return work;
-        }());
+        if (scheduled_) { return; }
+
+        scheduled_ = true;
+        timer_.SetRelative(interval_);
+        timer_.Wait([this](const auto& error) {
+            if (error) {
+                if (boost::system::errc::operation_canceled == error.value()) {
+
+                    return;
+                }
+
+                LogError()(OT_PRETTY_CLASS())(error).Flush();
+            }
+
+            pipeline_.Push(MakeWork(Work::flush));
+        });
+    }
+    auto process_flush() noexcept -> void
+    {
+        auto pending = UnallocatedSet<OTIdentifier>{};
+        pending.swap(pending_);
+        scheduled_ = false;
+
+        for (const auto& id : pending) { notify(id); }
     }
 };
 
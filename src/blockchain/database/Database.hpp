@@ -239,6 +239,10 @@ public:
     {
         return wallet_.CancelProposal(id);
     }
+    auto DeleteProposal(const Identifier& id) noexcept -> bool final
+    {
+        return wallet_.DeleteProposal(id);
+    }
     auto FilterHeaderTip(const cfilter::Type type) const noexcept
         -> block::Position final
     {
@@ -405,6 +409,14 @@ public:
     {
         return filters_.LoadFilter(type, block, alloc);
     }
+    auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const EncodedFilterVisitor& visitor) const noexcept
+        -> std::size_t final
+    {
+        return filters_.LoadEncodedFilters(type, blocks, visitor);
+    }
     auto LoadFilters(
         const cfilter::Type type,
         const Vector<block::Hash>& blocks) const noexcept
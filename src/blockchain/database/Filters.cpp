@@ -165,6 +165,14 @@ auto Filters::LoadFilter(
     return common_.LoadFilter(type, block, alloc);
 }
 
+auto Filters::LoadEncodedFilters(
+    const cfilter::Type type,
+    const Vector<block::Hash>& blocks,
+    const Parent::EncodedFilterVisitor& visitor) const noexcept -> std::size_t
+{
+    return common_.LoadEncodedFilters(type, blocks, visitor);
+}
+
 auto Filters::LoadFilters(
     const cfilter::Type type,
     const Vector<block::Hash>& blocks) const noexcept -> Vector<GCS>
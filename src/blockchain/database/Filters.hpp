@@ -90,6 +90,11 @@ public:
         const cfilter::Type type,
         const ReadView block,
         alloc::Default alloc) const noexcept -> blockchain::GCS;
+    auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const Parent::EncodedFilterVisitor& visitor) const noexcept
+        -> std::size_t;
     auto LoadFilters(
         const cfilter::Type type,
         const Vector<block::Hash>& blocks) const noexcept -> Vector<GCS>;
@@ -110,6 +110,11 @@ auto Wallet::CompletedProposals() const noexcept -> UnallocatedSet<OTIdentifier>
     return proposals_.CompletedProposals();
 }
 
+auto Wallet::DeleteProposal(const Identifier& id) const noexcept -> bool
+{
+    return proposals_.CancelProposal(nullptr, id);
+}
+
 auto Wallet::FinalizeReorg(
     storage::lmdb::LMDB::Transaction& tx,
     const block::Position& pos) const noexcept -> bool
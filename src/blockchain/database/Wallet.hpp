@@ -159,6 +159,7 @@ public:
     auto AdvanceTo(const block::Position& pos) const noexcept -> bool;
     auto CancelProposal(const Identifier& id) const noexcept -> bool;
     auto CompletedProposals() const noexcept -> UnallocatedSet<OTIdentifier>;
+    auto DeleteProposal(const Identifier& id) const noexcept -> bool;
     auto FinalizeReorg(
         storage::lmdb::LMDB::Transaction& tx,
         const block::Position& pos) const noexcept -> bool;
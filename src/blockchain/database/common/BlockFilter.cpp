@@ -8,9 +8,11 @@
 #include "blockchain/database/common/BlockFilter.hpp"  // IWYU pragma: associated
 
 #include <google/protobuf/arena.h>  // IWYU pragma: keep
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <iterator>
 #include <mutex>
 #include <stdexcept>
 #include <tuple>
@@ -20,6 +22,7 @@
 #include "Proto.hpp"
 #include "Proto.tpp"
 #include "blockchain/database/common/Bulk.hpp"
+#include "blockchain/database/common/Database.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "internal/util/BoostPMR.hpp"
@@ -46,6 +49,82 @@ BlockFilter::BlockFilter(
     , lmdb_(lmdb)
     , bulk_(bulk)
 {
+    migrate();
+}
+
+auto BlockFilter::copy_records(
+    const util::ReadEpoch& epoch,
+    const Vector<util::IndexData>& indices,
+    Vector<std::byte>& buffer,
+    Vector<ReadView>& out) const noexcept -> void
+{
+    // NOTE records may be overwritten in place as soon as the mutex is
+    // released so they are copied out while it is held
+    out.reserve(indices.size());
+    auto lock = Lock{bulk_.Mutex()};
+    auto total = std::size_t{0};
+
+    for (const auto& index : indices) {
+        total += out.emplace_back(bulk_.ReadView(epoch, lock, index)).size();
+    }
+
+    buffer.resize(total);
+    auto* it = buffer.data();
+
+    for (auto& view : out) {
+        const auto size = view.size();
+
+        if (0u < size) { std::memcpy(it, view.data(), size); }
+
+        view = {reinterpret_cast<const char*>(it), size};
+        std::advance(it, size);
+    }
+}
+
+auto BlockFilter::decode(
+    const cfilter::Type type,
+    const ReadView blockHash,
+    const ReadView bytes,
+    alloc::Default alloc) const noexcept(false) -> GCS
+{
+    auto output = [&] {
+        if (is_raw(bytes)) {
+            if (raw_version_ != reinterpret_cast<const std::byte*>(
+                                    bytes.data())[1]) {
+                throw std::runtime_error{"Unknown cfilter record version"};
+            }
+
+            return factory::GCS(
+                api_,
+                type,
+                opentxs::blockchain::internal::BlockHashToFilterKey(
+                    blockHash),
+                bytes.substr(raw_header_bytes_),
+                alloc);
+        } else {
+
+            return factory::GCS(
+                api_, proto::Factory<proto::GCS>(bytes), alloc);
+        }
+    }();
+
+    if (false == output.IsValid()) {
+        throw std::runtime_error{"Failed to decode cfilter"};
+    }
+
+    return output;
+}
+
+auto BlockFilter::encode(const GCS& filter, Vector<std::byte>& out) noexcept
+    -> bool
+{
+    return filter.Encode([&](const auto size) -> WritableView {
+        out.resize(raw_header_bytes_ + size);
+        out[0] = raw_marker_;
+        out[1] = raw_version_;
+
+        return {std::next(out.data(), raw_header_bytes_), size};
+    });
 }
 
 auto BlockFilter::HaveFilter(const cfilter::Type type, const ReadView blockHash)
@@ -73,6 +152,12 @@ auto BlockFilter::HaveFilterHeader(
     }
 }
 
+auto BlockFilter::is_raw(const ReadView bytes) noexcept -> bool
+{
+    return (raw_header_bytes_ < bytes.size()) &&
+           (raw_marker_ == *reinterpret_cast<const std::byte*>(bytes.data()));
+}
+
 auto BlockFilter::load_filter_index(
     const cfilter::Type type,
     const ReadView blockHash,
@@ -104,6 +189,7 @@ auto BlockFilter::LoadFilter(
     alloc::Default alloc) const noexcept -> opentxs::blockchain::GCS
 {
     try {
+        const auto epoch = bulk_.BeginRead();
         const auto index = [&] {
             auto out = util::IndexData{};
             load_filter_index(type, blockHash, out);
@@ -111,8 +197,10 @@ auto BlockFilter::LoadFilter(
             return out;
         }();
 
-        return factory::GCS(
-            api_, proto::Factory<proto::GCS>(bulk_.ReadView(index)), alloc);
+        auto lock = Lock{bulk_.Mutex()};
+
+        return decode(
+            type, blockHash, bulk_.ReadView(epoch, lock, index), alloc);
     } catch (const std::exception& e) {
         LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -120,43 +208,122 @@ auto BlockFilter::LoadFilter(
     }
 }
 
+auto BlockFilter::LoadEncodedFilters(
+    const cfilter::Type type,
+    const Vector<block::Hash>& blocks,
+    const EncodedFilterVisitor& visitor) const noexcept -> std::size_t
+{
+    auto buf = std::array<std::byte, index_buffer_bytes_>{};
+    auto alloc = alloc::BoostMonotonic{buf.data(), buf.size()};
+    auto records = Vector<std::byte>{};
+    auto views = Vector<ReadView>{&alloc};
+
+    {
+        const auto epoch = bulk_.BeginRead();
+        auto indices = Vector<util::IndexData>{&alloc};
+        load_filter_indices(type, blocks, indices);
+        copy_records(epoch, indices, records, views);
+    }
+
+    auto visited = std::size_t{0};
+    auto hash = blocks.cbegin();
+
+    for (const auto& bytes : views) {
+        try {
+
+            // NOTE a raw record without its header is already the wire
+            // encoding so only legacy proto::GCS records are decoded
+            if (is_raw(bytes)) {
+                if (raw_version_ != reinterpret_cast<const std::byte*>(
+                                        bytes.data())[1]) {
+                    throw std::runtime_error{"Unknown cfilter record version"};
+                }
+
+                visitor(*hash, bytes.substr(raw_header_bytes_));
+            } else {
+                const auto filter = decode(type, hash->Bytes(), bytes, {});
+                auto encoded = Space{};
+
+                if (false == filter.Encode(writer(encoded))) {
+                    throw std::runtime_error{"Failed to encode cfilter"};
+                }
+
+                visitor(*hash, reader(encoded));
+            }
+
+            ++hash;
+            ++visited;
+        } catch (const std::exception& e) {
+            LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            break;
+        }
+    }
+
+    return visited;
+}
+
+auto BlockFilter::load_filter_indices(
+    const cfilter::Type type,
+    const Vector<block::Hash>& blocks,
+    Vector<util::IndexData>& out) const noexcept -> void
+{
+    out.reserve(std::min(blocks.size(), index_batch_));
+    auto tx = lmdb_.TransactionRO();
+
+    for (const auto& hash : blocks) {
+        try {
+            auto& index = out.emplace_back();
+            load_filter_index(type, hash.Bytes(), tx, index);
+        } catch (const std::exception& e) {
+            LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
+            out.pop_back();
+
+            break;
+        }
+    }
+}
+
 auto BlockFilter::LoadFilters(
     const cfilter::Type type,
     const Vector<block::Hash>& blocks) const noexcept -> Vector<GCS>
 {
     auto output = Vector<GCS>{blocks.get_allocator()};
     output.reserve(blocks.size());
-    // TODO use a named constant for the cfilter scan batch size.
-    constexpr auto allocBytes =
-        (1000u * sizeof(util::IndexData)) + sizeof(Vector<util::IndexData>);
-    auto buf = std::array<std::byte, allocBytes>{};
+    auto buf = std::array<std::byte, index_buffer_bytes_>{};
     auto alloc = alloc::BoostMonotonic{buf.data(), buf.size()};
-    const auto indices = [&] {
-        auto out = Vector<util::IndexData>{&alloc};
-        out.reserve(1000u);
-        auto tx = lmdb_.TransactionRO();
-
-        for (const auto& hash : blocks) {
-            try {
-                auto& index = out.emplace_back();
-                load_filter_index(type, hash.Bytes(), tx, index);
-            } catch (const std::exception& e) {
-                LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
-                out.pop_back();
-
-                break;
-            }
-        }
+    auto records = Vector<std::byte>{};
+    const auto views = [&] {
+        const auto epoch = bulk_.BeginRead();
+        auto indices = Vector<util::IndexData>{&alloc};
+        load_filter_indices(type, blocks, indices);
+        auto out = Vector<ReadView>{&alloc};
+        copy_records(epoch, indices, records, out);
 
         return out;
     }();
 
-    for (const auto& index : indices) {
+    // NOTE raw records are decoded directly from the copied records into the
+    // caller's allocator. Every parsed legacy proto::GCS is discarded as soon
+    // as the native filter has been constructed so one arena serves the
+    // entire batch.
+    static const auto options = proto::BatchArenaOptions(1_MiB);
+    auto arena = google::protobuf::Arena{options};
+    auto hash = blocks.cbegin();
+
+    for (const auto& bytes : views) {
         try {
-            output.emplace_back(factory::GCS(
-                api_,
-                proto::Factory<proto::GCS>(bulk_.ReadView(index)),
-                blocks.get_allocator()));
+            if (is_raw(bytes)) {
+                output.emplace_back(decode(
+                    type, hash->Bytes(), bytes, blocks.get_allocator()));
+            } else {
+                output.emplace_back(factory::GCS(
+                    api_,
+                    *proto::Factory<proto::GCS>(arena, bytes),
+                    blocks.get_allocator()));
+            }
+
+            ++hash;
         } catch (const std::exception& e) {
             LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -229,6 +396,144 @@ auto BlockFilter::LoadFilterHeader(
     return output;
 }
 
+auto BlockFilter::migrate() noexcept -> void
+{
+    static constexpr auto key =
+        static_cast<std::size_t>(Database::Key::CfilterFormat);
+    const auto current = [&] {
+        auto out = std::byte{};
+        lmdb_.Load(Table::Config, key, [&](const auto in) {
+            if (sizeof(out) != in.size()) { return; }
+
+            std::memcpy(&out, in.data(), in.size());
+        });
+
+        return out;
+    }();
+
+    if (raw_version_ == current) { return; }
+
+    try {
+        auto count = std::size_t{0};
+
+        for (const auto type :
+             {cfilter::Type::Basic_BIP158,
+              cfilter::Type::Basic_BCHVariant,
+              cfilter::Type::ES}) {
+            count += migrate(type);
+        }
+
+        const auto stored = lmdb_.Store(Table::Config, key, tsv(raw_version_));
+
+        if (false == stored.first) {
+            throw std::runtime_error{"Failed to update cfilter format"};
+        }
+
+        if (0u < count) {
+            LogConsole()("Converted ")(count)(" cfilters to raw format")
+                .Flush();
+        }
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+    }
+}
+
+auto BlockFilter::migrate(const cfilter::Type type) const noexcept(false)
+    -> std::size_t
+{
+    const auto table = translate_filter(type);
+    const auto epoch = bulk_.BeginRead();
+    const auto items = [&] {
+        auto out = UnallocatedVector<std::pair<Space, util::IndexData>>{};
+        lmdb_.Read(
+            table,
+            [&](const auto key, const auto value) {
+                auto& [hash, index] =
+                    out.emplace_back(space(key), util::IndexData{});
+
+                if (sizeof(index) == value.size()) {
+                    std::memcpy(
+                        static_cast<void*>(&index), value.data(), value.size());
+                } else {
+                    out.pop_back();
+                }
+
+                return true;
+            },
+            storage::lmdb::LMDB::Dir::Forward);
+
+        return out;
+    }();
+    static const auto options = proto::BatchArenaOptions(1_MiB);
+    auto arena = google::protobuf::Arena{options};
+    auto buf = Vector<std::byte>{};
+    auto count = std::size_t{0};
+
+    for (auto i = items.begin(), end = items.end(); i != end;) {
+        auto tx = lmdb_.TransactionRW();
+        auto lock = Lock{bulk_.Mutex()};
+
+        for (auto n = std::size_t{0}; (n < index_batch_) && (i != end);
+             ++n, ++i) {
+            const auto& [hash, index] = *i;
+            const auto bytes = bulk_.ReadView(epoch, lock, index);
+
+            if (is_raw(bytes)) { continue; }
+
+            const auto filter = factory::GCS(
+                api_, *proto::Factory<proto::GCS>(arena, bytes), {});
+
+            if ((false == filter.IsValid()) || (false == encode(filter, buf))) {
+                throw std::runtime_error{"Failed to convert cfilter"};
+            }
+
+            // NOTE the raw layout is always smaller than the protobuf layout
+            // so the record is rewritten at the start of its existing extent
+            // rather than being appended to the end of the file, and the
+            // unused tail of the extent is released
+            auto target = index;
+            const auto shrink = buf.size() < target.size_;
+
+            if (shrink) { target.size_ = buf.size(); }
+
+            auto view = bulk_.WriteView(lock, tx, target, {}, buf.size());
+
+            if (false == view.valid(buf.size())) {
+                throw std::runtime_error{
+                    "Failed to get write position for cfilter"};
+            }
+
+            std::memcpy(view.data(), buf.data(), buf.size());
+            const auto stored =
+                lmdb_.Store(table, reader(hash), tsv(target), tx);
+
+            if (false == stored.first) {
+                throw std::runtime_error{"Failed to update cfilter index"};
+            }
+
+            if (shrink) {
+                const auto tail = util::IndexData{
+                    index.position_ + buf.size(), index.size_ - buf.size()};
+
+                if (false == bulk_.Release(lock, tx, tail)) {
+                    throw std::runtime_error{"Failed to release cfilter space"};
+                }
+            }
+
+            ++count;
+        }
+
+        arena.Reset();
+        lock.unlock();
+
+        if (false == tx.Finalize(true)) {
+            throw std::runtime_error{"Database error"};
+        }
+    }
+
+    return count;
+}
+
 auto BlockFilter::store(
     const Lock& lock,
     storage::lmdb::LMDB::Transaction& tx,
@@ -237,16 +542,16 @@ auto BlockFilter::store(
     const GCS& filter) const noexcept -> bool
 {
     try {
-        const auto proto = [&] {
-            auto out = proto::GCS{};
+        const auto serialized = [&] {
+            auto out = Vector<std::byte>{};
 
-            if (false == filter.Internal().Serialize(out)) {
+            if (false == encode(filter, out)) {
                 throw std::runtime_error{"Failed to serialize gcs"};
             }
 
             return out;
         }();
-        const auto bytes = proto.ByteSizeLong();
+        const auto bytes = serialized.size();
         const auto table = translate_filter(type);
         auto index = [&] {
             auto output = util::IndexData{};
@@ -279,7 +584,9 @@ auto BlockFilter::store(
                 "Failed to get write position for cfilter"};
         }
 
-        return proto::write(proto, preallocated(bytes, view.data()));
+        std::memcpy(view.data(), serialized.data(), bytes);
+
+        return true;
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -348,7 +655,7 @@ auto BlockFilter::StoreFilters(
 
         using BlockHash = ReadView;
         using SerializedCfheader = Vector<std::byte>;
-        using SerializedCfilter = proto::GCS*;
+        using SerializedCfilter = Vector<std::byte>;
         using CFilterSize = std::size_t;
         using BulkIndex = util::IndexData;
         using StorageItem = std::tuple<
@@ -359,13 +666,7 @@ auto BlockFilter::StoreFilters(
             BulkIndex>;
 
         // NOTE do as much work as possible before locking mutexes
-        static const auto options = [] {
-            auto out = google::protobuf::ArenaOptions{};
-            out.start_block_size = 8_MiB;
-            out.max_block_size = 8_MiB;
-
-            return out;
-        }();
+        static const auto options = proto::BatchArenaOptions(8_MiB);
         auto arena = google::protobuf::Arena{options};
         auto alloc = alloc::BoostMonotonic{
             4_MiB, alloc::standard_to_boost(alloc::System())};
@@ -380,7 +681,7 @@ auto BlockFilter::StoreFilters(
                     out.emplace_back(
                         BlockHash{},
                         SerializedCfheader{&alloc},
-                        google::protobuf::Arena::Create<proto::GCS>(&arena),
+                        SerializedCfilter{&alloc},
                         0,
                         BulkIndex{});
                 bHash = std::get<0>(*h).Bytes();
@@ -398,11 +699,11 @@ auto BlockFilter::StoreFilters(
 
                 if (auto& [b, filter] = *f;
                     (false == filter.IsValid()) ||
-                    (false == filter.Internal().Serialize(*cfilter))) {
+                    (false == encode(filter, cfilter))) {
                     throw std::runtime_error{"Failed to serialize gcs"};
                 }
 
-                bytes = cfilter->ByteSizeLong();
+                bytes = cfilter.size();
             }
 
             return out;
@@ -444,9 +745,7 @@ auto BlockFilter::StoreFilters(
                     "Failed to get write position for cfilter"};
             }
 
-            if (!proto::write(*filter, preallocated(bytes, view.data()))) {
-                throw std::runtime_error{"Failed to get write cfilter"};
-            }
+            std::memcpy(view.data(), filter.data(), bytes);
 
             const auto stored = lmdb_.Store(hTable, block, reader(header), tx);
 
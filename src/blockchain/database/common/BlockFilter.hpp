@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
@@ -60,6 +61,7 @@ class LMDB;
 namespace util
 {
 struct IndexData;
+class ReadEpoch;
 }  // namespace util
 // }  // namespace v1
 }  // namespace opentxs
@@ -74,6 +76,10 @@ public:
         const noexcept -> bool;
     auto HaveFilterHeader(const cfilter::Type type, const ReadView blockHash)
         const noexcept -> bool;
+    auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const EncodedFilterVisitor& visitor) const noexcept -> std::size_t;
     auto LoadFilter(
         const cfilter::Type type,
         const ReadView blockHash,
@@ -110,16 +116,45 @@ private:
     static const std::uint32_t blockchain_filter_headers_version_{1};
     static const std::uint32_t blockchain_filter_version_{1};
     static const std::uint32_t blockchain_filters_version_{1};
+    // NOTE raw cfilter records consist of a two byte header followed by the
+    // BIP-158 encoding of the filter (element count as CompactSize followed by
+    // the Golomb-coded set). The key, bits, and false positive rate are
+    // derived from the block hash and filter type. The first header byte can
+    // never begin a serialized protobuf since field number zero is invalid so
+    // records in the legacy proto::GCS layout are still recognized.
+    static constexpr auto raw_marker_ = std::byte{0x00};
+    static constexpr auto raw_version_ = std::byte{0x01};
+    static constexpr auto raw_header_bytes_ = std::size_t{2};
+    // Batch loads reserve space for this many indices and views in a stack
+    // buffer, and migrations rewrite this many records per transaction
+    static constexpr auto index_batch_ = std::size_t{1000};
+    static constexpr auto index_buffer_bytes_ =
+        (index_batch_ * (sizeof(util::IndexData) + sizeof(ReadView))) +
+        sizeof(Vector<util::IndexData>) + sizeof(Vector<ReadView>);
 
     const api::Session& api_;
     storage::lmdb::LMDB& lmdb_;
     Bulk& bulk_;
 
+    static auto encode(const GCS& filter, Vector<std::byte>& out) noexcept
+        -> bool;
+    static auto is_raw(const ReadView bytes) noexcept -> bool;
     static auto translate_filter(const cfilter::Type type) noexcept(false)
         -> Table;
     static auto translate_header(const cfilter::Type type) noexcept(false)
         -> Table;
 
+    auto copy_records(
+        const util::ReadEpoch& epoch,
+        const Vector<util::IndexData>& indices,
+        Vector<std::byte>& buffer,
+        Vector<ReadView>& out) const noexcept -> void;
+    auto decode(
+        const cfilter::Type type,
+        const ReadView blockHash,
+        const ReadView bytes,
+        alloc::Default alloc) const noexcept(false) -> GCS;
+
     auto load_filter_index(
         const cfilter::Type type,
         const ReadView blockHash,
@@ -129,6 +164,12 @@ private:
         const ReadView blockHash,
         storage::lmdb::LMDB::Transaction& tx,
         util::IndexData& out) const noexcept(false) -> void;
+    auto load_filter_indices(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        Vector<util::IndexData>& out) const noexcept -> void;
+    auto migrate() noexcept -> void;
+    auto migrate(const cfilter::Type type) const noexcept(false) -> std::size_t;
     auto store(
         const Lock& lock,
         storage::lmdb::LMDB::Transaction& tx,
@@ -43,6 +43,7 @@ auto BlockHeader::Exists(
 auto BlockHeader::Load(const opentxs::blockchain::block::Hash& hash) const
     noexcept(false) -> proto::BlockchainBlockHeader
 {
+    const auto epoch = bulk_.BeginRead();
     const auto index = [&] {
         auto out = util::IndexData{};
         auto cb = [&out](const ReadView in) {
@@ -59,7 +60,10 @@ auto BlockHeader::Load(const opentxs::blockchain::block::Hash& hash) const
         return out;
     }();
 
-    return proto::Factory<proto::BlockchainBlockHeader>(bulk_.ReadView(index));
+    auto lock = Lock{bulk_.Mutex()};
+
+    return proto::Factory<proto::BlockchainBlockHeader>(
+        bulk_.ReadView(epoch, lock, index));
 }
 
 auto BlockHeader::Store(
@@ -8,6 +8,7 @@
 #include "blockchain/database/common/Blocks.hpp"  // IWYU pragma: associated
 
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <type_traits>
@@ -41,6 +42,7 @@ struct Blocks::Imp {
     auto Load(const Hash& block) const noexcept -> BlockReader
     {
         auto lock = Lock{lock_};
+        auto epoch = bulk_.BeginRead();
         auto index = util::IndexData{};
         auto cb = [&index](const auto in) {
             if (sizeof(index) != in.size()) { return; }
@@ -57,7 +59,20 @@ struct Blocks::Imp {
             return {};
         }
 
-        return BlockReader{bulk_.ReadView(index), block_locks_[block]};
+        auto view = [&] {
+            auto bulk = Lock{bulk_.Mutex()};
+
+            return bulk_.ReadView(epoch, bulk, index);
+        }();
+
+        // NOTE the block lock prevents the block from being overwritten in
+        // place while the reader exists. The read epoch is owned by the
+        // destruct callback so the space is not reused before then if the
+        // block is moved or replaced.
+        return BlockReader{
+            std::move(view),
+            block_locks_[block],
+            [epoch = std::make_shared<util::ReadEpoch>(std::move(epoch))] {}};
     }
 
     auto Store(const Hash& block, const std::size_t bytes) const noexcept
@@ -7,22 +7,57 @@
 #include "1_Internal.hpp"                       // IWYU pragma: associated
 #include "blockchain/database/common/Bulk.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <mutex>
 #include <utility>
 
 #include "blockchain/database/common/Database.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Log.hpp"
+#include "util/LMDB.hpp"
 #include "util/MappedFileStorage.hpp"
 
 namespace opentxs::blockchain::database::common
 {
 struct Bulk::Imp final : private util::MappedFileStorage {
+    auto BeginRead() const noexcept -> util::ReadEpoch { return begin_read(); }
+    auto Compact(std::size_t limit) const noexcept
+        -> std::pair<std::size_t, bool>
+    {
+        // NOTE every table which stores an IndexData referring to this storage
+        static const auto tables = UnallocatedVector<int>{
+            Table::HeaderIndex,
+            Table::FilterIndexBasic,
+            Table::FilterIndexBCH,
+            Table::FilterIndexES,
+            Table::BlockIndex,
+            Table::TransactionIndex,
+        };
+        const auto output = compact(lock_, tables, limit);
+
+        if (const auto moved = output.first; 0u < moved) {
+            LogVerbose()(OT_PRETTY_CLASS())("moved ")(moved)(" items").Flush();
+        }
+
+        return output;
+    }
     auto Mutex() const noexcept -> std::mutex& { return lock_; }
-    auto ReadView(const Lock&, const util::IndexData& index) const noexcept
-        -> opentxs::ReadView
+    auto ReadView(
+        const util::ReadEpoch&,
+        const Lock&,
+        const util::IndexData& index) const noexcept -> opentxs::ReadView
     {
         return get_read_view(index);
     }
+    auto Release(
+        const Lock&,
+        storage::lmdb::LMDB::Transaction& tx,
+        const util::IndexData& index) const noexcept -> bool
+    {
+        return release(tx, index);
+    }
     auto WriteView(
         const Lock&,
         storage::lmdb::LMDB::Transaction& tx,
@@ -40,7 +75,8 @@ struct Bulk::Imp final : private util::MappedFileStorage {
               path,
               "blk",
               Table::Config,
-              static_cast<std::size_t>(Database::Key::NextBlockAddress))
+              static_cast<std::size_t>(Database::Key::NextBlockAddress),
+              Table::BulkFreeSpace)
         , lock_()
     {
     }
@@ -55,20 +91,33 @@ Bulk::Bulk(storage::lmdb::LMDB& lmdb, const UnallocatedCString& path) noexcept(
 {
 }
 
-auto Bulk::Mutex() const noexcept -> std::mutex& { return imp_->Mutex(); }
+auto Bulk::BeginRead() const noexcept -> util::ReadEpoch
+{
+    return imp_->BeginRead();
+}
 
-auto Bulk::ReadView(const util::IndexData& index) const noexcept
-    -> opentxs::ReadView
+auto Bulk::Compact(std::size_t limit) const noexcept
+    -> std::pair<std::size_t, bool>
 {
-    auto lock = Lock{imp_->Mutex()};
+    return imp_->Compact(limit);
+}
+
+auto Bulk::Mutex() const noexcept -> std::mutex& { return imp_->Mutex(); }
 
-    return ReadView(lock, index);
+auto Bulk::ReadView(
+    const util::ReadEpoch& epoch,
+    const Lock& lock,
+    const util::IndexData& index) const noexcept -> opentxs::ReadView
+{
+    return imp_->ReadView(epoch, lock, index);
 }
 
-auto Bulk::ReadView(const Lock& lock, const util::IndexData& index)
-    const noexcept -> opentxs::ReadView
+auto Bulk::Release(
+    const Lock& lock,
+    storage::lmdb::LMDB::Transaction& tx,
+    const util::IndexData& index) const noexcept -> bool
 {
-    return imp_->ReadView(lock, index);
+    return imp_->Release(lock, tx, index);
 }
 
 auto Bulk::WriteView(
@@ -9,6 +9,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <utility>
 
 #include "internal/util/Mutex.hpp"
 #include "opentxs/util/Bytes.hpp"
@@ -31,6 +32,7 @@ class LMDB;
 namespace util
 {
 struct IndexData;
+class ReadEpoch;
 }  // namespace util
 // }  // namespace v1
 }  // namespace opentxs
@@ -44,11 +46,30 @@ public:
     using UpdateCallback =
         std::function<bool(storage::lmdb::LMDB::Transaction&)>;
 
+    /// Examine up to limit items in the next batch of the current compaction
+    /// pass and move them into free space closer to the start of storage
+    ///
+    /// Returns the number of items moved and whether the pass is finished
+    /// Register a reader
+    ///
+    /// Must be called before loading an index which will be passed to
+    /// ReadView. Space released while the returned object exists is not
+    /// reused until it is destroyed.
+    auto BeginRead() const noexcept -> util::ReadEpoch;
+    auto Compact(std::size_t limit) const noexcept
+        -> std::pair<std::size_t, bool>;
     auto Mutex() const noexcept -> std::mutex&;
-    auto ReadView(const util::IndexData& index) const noexcept
-        -> opentxs::ReadView;
-    auto ReadView(const Lock& lock, const util::IndexData& index) const noexcept
-        -> opentxs::ReadView;
+    /// The view remains valid while epoch exists. The lock only prevents the
+    /// item from being replaced in place while it is read.
+    auto ReadView(
+        const util::ReadEpoch& epoch,
+        const Lock& lock,
+        const util::IndexData& index) const noexcept -> opentxs::ReadView;
+    /// Record the space referenced by index as free once tx commits
+    auto Release(
+        const Lock& lock,
+        storage::lmdb::LMDB::Transaction& tx,
+        const util::IndexData& index) const noexcept -> bool;
     auto WriteView(
         storage::lmdb::LMDB::Transaction& tx,
         util::IndexData& index,
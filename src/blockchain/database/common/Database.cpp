@@ -14,13 +14,18 @@ extern "C" {
 
 #include <boost/filesystem.hpp>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <iosfwd>
 #include <iterator>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -34,6 +39,7 @@ extern "C" {
 #include "blockchain/database/common/Wallet.hpp"
 #include "internal/api/Legacy.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
 #include "internal/util/TSV.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"  // IWYU pragma: keep
 #include "opentxs/blockchain/block/bitcoin/Transaction.hpp"  // IWYU pragma: keep
@@ -71,6 +77,10 @@ struct Database::Imp {
     Sync sync_;
     Wallet wallet_;
     Configuration config_;
+    std::mutex compaction_lock_;
+    std::condition_variable compaction_cv_;
+    std::atomic<bool> shutdown_;
+    std::thread compaction_;
 
     static auto block_storage_enabled() noexcept -> bool
     {
@@ -266,6 +276,28 @@ struct Database::Imp {
         return init_folder(legacy_, blockchain_path_, String::Factory(dir))
             ->Get();
     }
+    auto compact() noexcept -> void
+    {
+        // NOTE each pass over the index tables is performed in bounded
+        // batches so writers are never held off for long, and the storage is
+        // rechecked periodically because released space only becomes
+        // reusable once the readers which may still refer to it are done
+        static constexpr auto batch = std::size_t{1000u};
+        static constexpr auto interval = std::chrono::minutes{15};
+
+        while (false == shutdown_) {
+            while (false == shutdown_) {
+                if (const auto [moved, finished] = bulk_.Compact(batch);
+                    finished) {
+                    break;
+                }
+            }
+
+            auto lock = Lock{compaction_lock_};
+            compaction_cv_.wait_for(
+                lock, interval, [this] { return shutdown_.load(); });
+        }
+    }
 
     Imp(const api::Session& api,
         const api::crypto::Blockchain& blockchain,
@@ -303,6 +335,8 @@ struct Database::Imp {
                       {Table::FilterIndexBCH, 0},
                       {Table::FilterIndexES, 0},
                       {Table::TransactionIndex, 0},
+                      {Table::BulkFreeSpace, MDB_DUPSORT | MDB_INTEGERKEY},
+                      {Table::SyncFreeSpace, MDB_DUPSORT | MDB_INTEGERKEY},
                   };
 
                   for (const auto& [table, name] : SyncTables()) {
@@ -328,15 +362,31 @@ struct Database::Imp {
         , peers_(api_, lmdb_)
         , filters_(api_, lmdb_, bulk_)
         , blocks_(lmdb_, bulk_)
-        , sync_(api_, lmdb_, blocks_path_->Get())
+        , sync_(api_, lmdb_, blocks_path_->Get(), args.BlockchainSyncParanoid())
         , wallet_(api_, blockchain, lmdb_, bulk_)
         , config_(api_, lmdb_)
+        , compaction_lock_()
+        , compaction_cv_()
+        , shutdown_(false)
+        , compaction_(&Imp::compact, this)
     {
         OT_ASSERT(crypto_shorthash_KEYBYTES == siphash_key_.size());
 
         static_assert(
             sizeof(opentxs::blockchain::PatternID) == crypto_shorthash_BYTES);
     }
+
+    ~Imp()
+    {
+        {
+            auto lock = Lock{compaction_lock_};
+            shutdown_ = true;
+        }
+
+        compaction_cv_.notify_all();
+
+        if (compaction_.joinable()) { compaction_.join(); }
+    }
 };
 
 const storage::lmdb::TableNames Database::Imp::table_names_ = [] {
@@ -364,6 +414,8 @@ const storage::lmdb::TableNames Database::Imp::table_names_ = [] {
         {Table::FilterIndexBCH, "block_filters_bch_2"},
         {Table::FilterIndexES, "block_filters_opentxs_2"},
         {Table::TransactionIndex, "transactions"},
+        {Table::BulkFreeSpace, "bulk_free_space"},
+        {Table::SyncFreeSpace, "sync_free_space"},
     };
 
     for (const auto& [table, name] : SyncTables()) {
@@ -403,6 +455,12 @@ auto Database::AssociateTransaction(
     return imp_.wallet_.AssociateTransaction(txid, patterns);
 }
 
+auto Database::AssociateTransactions(
+    const Transactions& transactions) const noexcept -> bool
+{
+    return imp_.wallet_.AssociateTransactions(transactions);
+}
+
 auto Database::AddSyncServer(const UnallocatedCString& endpoint) const noexcept
     -> bool
 {
@@ -518,6 +576,14 @@ auto Database::LoadFilter(
     return imp_.filters_.LoadFilter(type, blockHash, alloc);
 }
 
+auto Database::LoadEncodedFilters(
+    const cfilter::Type type,
+    const Vector<block::Hash>& blocks,
+    const EncodedFilterVisitor& visitor) const noexcept -> std::size_t
+{
+    return imp_.filters_.LoadEncodedFilters(type, blocks, visitor);
+}
+
 auto Database::LoadFilters(
     const cfilter::Type type,
     const Vector<block::Hash>& blocks) const noexcept -> Vector<GCS>
@@ -652,6 +718,12 @@ auto Database::StoreTransaction(
     return imp_.wallet_.StoreTransaction(tx);
 }
 
+auto Database::StoreTransactions(
+    const Transactions& transactions) const noexcept -> bool
+{
+    return imp_.wallet_.StoreTransactions(transactions);
+}
+
 auto Database::SyncTip(const Chain chain) const noexcept -> Height
 {
     return imp_.sync_.Tip(chain);
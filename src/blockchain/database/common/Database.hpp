@@ -97,6 +97,7 @@ public:
         SiphashKey = 2,
         NextSyncAddress = 3,
         SyncServerEndpoint = 4,
+        CfilterFormat = 5,
     };
 
     using BlockHash = opentxs::blockchain::block::Hash;
@@ -108,6 +109,8 @@ public:
     using Height = opentxs::blockchain::block::Height;
     using SyncItems = UnallocatedVector<opentxs::network::p2p::Block>;
     using Endpoints = UnallocatedVector<UnallocatedCString>;
+    using Transactions =
+        UnallocatedVector<std::unique_ptr<block::bitcoin::Transaction>>;
 
     auto AddOrUpdate(Address_p address) const noexcept -> bool;
     auto AddSyncServer(const UnallocatedCString& endpoint) const noexcept
@@ -117,6 +120,8 @@ public:
     auto AssociateTransaction(
         const Txid& txid,
         const UnallocatedVector<PatternID>& patterns) const noexcept -> bool;
+    auto AssociateTransactions(const Transactions& transactions) const noexcept
+        -> bool;
     auto BlockHeaderExists(const BlockHash& hash) const noexcept -> bool;
     auto BlockExists(const BlockHash& block) const noexcept -> bool;
     auto BlockLoad(const BlockHash& block) const noexcept -> BlockReader;
@@ -147,6 +152,10 @@ public:
         const cfilter::Type type,
         const ReadView blockHash,
         alloc::Default alloc) const noexcept -> opentxs::blockchain::GCS;
+    auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const EncodedFilterVisitor& visitor) const noexcept -> std::size_t;
     auto LoadFilters(
         const cfilter::Type type,
         const Vector<block::Hash>& blocks) const noexcept -> Vector<GCS>;
@@ -186,6 +195,8 @@ public:
         -> bool;
     auto StoreTransaction(const block::bitcoin::Transaction& tx) const noexcept
         -> bool;
+    auto StoreTransactions(const Transactions& transactions) const noexcept
+        -> bool;
     auto SyncTip(const Chain chain) const noexcept -> Height;
     auto UpdateContact(const Contact& contact) const noexcept
         -> UnallocatedVector<pTxid>;
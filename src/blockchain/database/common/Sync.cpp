@@ -76,23 +76,29 @@ struct Sync::Imp final : private util::MappedFileStorage {
                     throw std::runtime_error("Failed to load sync packet");
                 }
 
-                auto checksum = std::uint64_t{};
-
-                static_assert(sizeof(checksum) == crypto_shorthash_BYTES);
-
-                if (0 !=
-                    ::crypto_shorthash(
-                        reinterpret_cast<unsigned char*>(&checksum),
-                        reinterpret_cast<const unsigned char*>(view.data()),
-                        view.size(),
-                        checksum_key_.data())) {
-                    throw std::runtime_error("Failed to calculate checksum");
-                }
-
-                if (data.checksum_ != checksum) {
-                    auto exclusive = boost::upgrade_to_unique_lock<Mutex>{lock};
-                    reorg(chain, height - 1);
-                    throw std::runtime_error("checksum failure");
+                if (false == is_verified(chain, height)) {
+                    auto checksum = std::uint64_t{};
+
+                    static_assert(sizeof(checksum) == crypto_shorthash_BYTES);
+
+                    if (0 != ::crypto_shorthash(
+                                 reinterpret_cast<unsigned char*>(&checksum),
+                                 reinterpret_cast<const unsigned char*>(
+                                     view.data()),
+                                 view.size(),
+                                 checksum_key_.data())) {
+                        throw std::runtime_error(
+                            "Failed to calculate checksum");
+                    }
+
+                    if (data.checksum_ != checksum) {
+                        auto exclusive =
+                            boost::upgrade_to_unique_lock<Mutex>{lock};
+                        reorg(chain, height - 1);
+                        throw std::runtime_error("checksum failure");
+                    }
+
+                    set_verified(chain, height, height);
                 }
 
                 if (false == output.Add(view)) { return false; }
@@ -225,6 +231,13 @@ struct Sync::Imp final : private util::MappedFileStorage {
             return false;
         }
 
+        // NOTE the checksums were just calculated from the bytes which were
+        // written so there is no need to verify them again when they are read
+        set_verified(
+            chain,
+            static_cast<std::size_t>(items.front().Height()),
+            static_cast<std::size_t>(tip));
+
         return true;
     }
 
@@ -242,15 +255,18 @@ struct Sync::Imp final : private util::MappedFileStorage {
     }
     Imp(const api::Session& api,
         storage::lmdb::LMDB& lmdb,
-        const UnallocatedCString& path) noexcept(false)
+        const UnallocatedCString& path,
+        const bool paranoid) noexcept(false)
         : MappedFileStorage(
               lmdb,
               path,
               "sync",
               Table::Config,
-              static_cast<std::size_t>(Database::Key::NextSyncAddress))
+              static_cast<std::size_t>(Database::Key::NextSyncAddress),
+              Table::SyncFreeSpace)
         , api_(api)
         , tip_table_(Table::SyncTips)
+        , paranoid_(paranoid)
         , lock_()
         , tips_([&] {
             auto output = Tips{};
@@ -259,6 +275,15 @@ struct Sync::Imp final : private util::MappedFileStorage {
                 output.emplace(chain, -1);
             }
 
+            return output;
+        }())
+        , verified_([&] {
+            auto output = Verified{};
+
+            for (const auto chain : opentxs::blockchain::DefinedChains()) {
+                output.emplace(chain, Verified::mapped_type{});
+            }
+
             return output;
         }())
     {
@@ -296,13 +321,18 @@ private:
     using SharedLock = boost::upgrade_lock<Mutex>;
     using ExclusiveLock = boost::unique_lock<Mutex>;
     using Tips = UnallocatedMap<Chain, Height>;
+    // One bit per height, set once the checksum of the packet at that height
+    // has been calculated during the lifetime of this process
+    using Verified = UnallocatedMap<Chain, UnallocatedVector<bool>>;
 
     static const std::array<unsigned char, 16> checksum_key_;
 
     const api::Session& api_;
     const int tip_table_;
+    const bool paranoid_;
     mutable Mutex lock_;
     mutable Tips tips_;
+    mutable Verified verified_;
 
     struct Data {
         util::IndexData index_;
@@ -385,6 +415,18 @@ private:
         }();
         Store(chain, items);
     }
+    // NOTE Load is the only reader and it holds an upgrade lock, which is
+    // exclusive with respect to other upgrade locks, so these functions do
+    // not race with each other
+    auto is_verified(const Chain chain, const std::size_t height)
+        const noexcept -> bool
+    {
+        if (paranoid_) { return false; }
+
+        const auto& bits = verified_.at(chain);
+
+        return (height < bits.size()) && bits[height];
+    }
     // WARNING make sure an exclusive lock is held
     auto reorg(const Chain chain, const Height height) const noexcept -> bool
     {
@@ -399,8 +441,19 @@ private:
         const auto table = ChainToSyncTable(chain);
 
         for (auto key = Height{height + 1}; key <= tip; ++key) {
-            if (false ==
-                lmdb_.Delete(table, static_cast<std::size_t>(key), txn)) {
+            const auto dbKey = static_cast<std::size_t>(key);
+            lmdb_.Load(
+                table,
+                tsv(dbKey),
+                [&](const auto bytes) {
+                    try {
+                        release(txn, Data{bytes}.index_);
+                    } catch (...) {
+                    }
+                },
+                txn);
+
+            if (false == lmdb_.Delete(table, dbKey, txn)) {
                 LogError()(OT_PRETTY_CLASS())("Delete error").Flush();
 
                 return false;
@@ -422,9 +475,23 @@ private:
         }
 
         tip = height;
+        auto& bits = verified_.at(chain);
+        bits.resize(
+            std::min(bits.size(), static_cast<std::size_t>(height + 1)));
 
         return true;
     }
+    auto set_verified(
+        const Chain chain,
+        const std::size_t first,
+        const std::size_t last) const noexcept -> void
+    {
+        auto& bits = verified_.at(chain);
+
+        if (bits.size() <= last) { bits.resize(last + 1u, false); }
+
+        for (auto i = first; i <= last; ++i) { bits[i] = true; }
+    }
 };
 
 const std::array<unsigned char, 16> Sync::Imp::checksum_key_{};
@@ -432,8 +499,9 @@ const std::array<unsigned char, 16> Sync::Imp::checksum_key_{};
 Sync::Sync(
     const api::Session& api,
     storage::lmdb::LMDB& lmdb,
-    const UnallocatedCString& path) noexcept(false)
-    : imp_(std::make_unique<Imp>(api, lmdb, path))
+    const UnallocatedCString& path,
+    const bool paranoid) noexcept(false)
+    : imp_(std::make_unique<Imp>(api, lmdb, path, paranoid))
 {
 }
 
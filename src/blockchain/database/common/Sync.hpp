@@ -76,10 +76,14 @@ public:
     auto Store(const Chain chain, const Items& items) const noexcept -> bool;
     auto Tip(const Chain chain) const noexcept -> Height;
 
+    // Stored packets are checksummed when they are written. Unless paranoid
+    // is set each packet is verified against its checksum at most once per
+    // process, the first time it is loaded, instead of on every load.
     Sync(
         const api::Session& api,
         storage::lmdb::LMDB& lmdb,
-        const UnallocatedCString& path) noexcept(false);
+        const UnallocatedCString& path,
+        const bool paranoid) noexcept(false);
 
     ~Sync();
 
@@ -58,6 +58,39 @@ Wallet::Wallet(
 auto Wallet::AssociateTransaction(
     const Txid& txid,
     const UnallocatedVector<PatternID>& in) const noexcept -> bool
+{
+    Lock lock(lock_);
+
+    return associate_transaction(lock, txid, in);
+}
+
+auto Wallet::AssociateTransactions(const Transactions& transactions)
+    const noexcept -> bool
+{
+    auto patterns = UnallocatedVector<UnallocatedVector<PatternID>>{};
+    patterns.reserve(transactions.size());
+    std::transform(
+        std::begin(transactions),
+        std::end(transactions),
+        std::back_inserter(patterns),
+        [](const auto& tx) { return tx->Internal().GetPatterns(); });
+    Lock lock(lock_);
+    auto p = patterns.cbegin();
+
+    for (const auto& tx : transactions) {
+        if (false == associate_transaction(lock, tx->ID(), *p++)) {
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+auto Wallet::associate_transaction(
+    const Lock& lock,
+    const Txid& txid,
+    const UnallocatedVector<PatternID>& in) const noexcept -> bool
 {
     LogTrace()(OT_PRETTY_CLASS())("Transaction ")(txid.asHex())(
         " is associated with patterns:")
@@ -69,7 +102,6 @@ auto Wallet::AssociateTransaction(
         incoming.emplace(pattern);
         LogTrace()("    * ")(pattern).Flush();
     });
-    Lock lock(lock_);
     auto& existing = transaction_to_patterns_[txid];
     auto newElements = UnallocatedVector<PatternID>{};
     auto removedElements = UnallocatedVector<PatternID>{};
@@ -119,6 +151,7 @@ auto Wallet::LoadTransaction(const ReadView txid) const noexcept
 {
     try {
         const auto proto = [&] {
+            const auto epoch = bulk_.BeginRead();
             const auto index = [&] {
                 auto out = util::IndexData{};
                 auto cb = [&out](const ReadView in) {
@@ -135,8 +168,10 @@ auto Wallet::LoadTransaction(const ReadView txid) const noexcept
                 return out;
             }();
 
+            auto lock = Lock{bulk_.Mutex()};
+
             return proto::Factory<proto::BlockchainTransaction>(
-                bulk_.ReadView(index));
+                bulk_.ReadView(epoch, lock, index));
         }();
 
         return factory::BitcoinTransaction(api_, proto);
@@ -174,6 +209,49 @@ auto Wallet::LookupTransactions(const PatternID pattern) const noexcept
 
 auto Wallet::StoreTransaction(
     const block::bitcoin::Transaction& in) const noexcept -> bool
+{
+    try {
+        auto dLock = lmdb_.TransactionRW();
+
+        if (false == store_transaction(dLock, in)) { return false; }
+
+        if (false == dLock.Finalize(true)) {
+            throw std::runtime_error{"Database update error"};
+        }
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto Wallet::StoreTransactions(const Transactions& transactions) const noexcept
+    -> bool
+{
+    try {
+        auto dLock = lmdb_.TransactionRW();
+
+        for (const auto& tx : transactions) {
+            if (false == store_transaction(dLock, *tx)) { return false; }
+        }
+
+        if (false == dLock.Finalize(true)) {
+            throw std::runtime_error{"Database update error"};
+        }
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto Wallet::store_transaction(
+    storage::lmdb::LMDB::Transaction& dLock,
+    const block::bitcoin::Transaction& in) const noexcept -> bool
 {
     try {
         const auto proto = [&] {
@@ -194,7 +272,7 @@ auto Wallet::StoreTransaction(
 
                 std::memcpy(static_cast<void*>(&output), in.data(), in.size());
             };
-            lmdb_.Load(transaction_table_, hash, cb);
+            lmdb_.Load(transaction_table_, hash, cb, dLock);
 
             return output;
         }();
@@ -212,7 +290,6 @@ auto Wallet::StoreTransaction(
 
             return true;
         };
-        auto dLock = lmdb_.TransactionRW();
         auto view = [&] {
             auto bLock = Lock{bulk_.Mutex()};
 
@@ -228,10 +305,6 @@ auto Wallet::StoreTransaction(
             throw std::runtime_error{"Failed to write transaction to storage"};
         }
 
-        if (false == dLock.Finalize(true)) {
-            throw std::runtime_error{"Database update error"};
-        }
-
         return true;
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
@@ -16,6 +16,7 @@
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
+#include "util/LMDB.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -51,13 +52,6 @@ class Bulk;
 }  // namespace database
 }  // namespace blockchain
 
-namespace storage
-{
-namespace lmdb
-{
-class LMDB;
-}  // namespace lmdb
-}  // namespace storage
 
 class Contact;
 // }  // namespace v1
@@ -72,10 +66,14 @@ public:
     using PatternID = opentxs::blockchain::PatternID;
     using Txid = opentxs::blockchain::block::Txid;
     using pTxid = opentxs::blockchain::block::pTxid;
+    using Transactions =
+        UnallocatedVector<std::unique_ptr<block::bitcoin::Transaction>>;
 
     auto AssociateTransaction(
         const Txid& txid,
         const UnallocatedVector<PatternID>& patterns) const noexcept -> bool;
+    auto AssociateTransactions(const Transactions& transactions) const noexcept
+        -> bool;
     auto LoadTransaction(const ReadView txid) const noexcept
         -> std::unique_ptr<block::bitcoin::Transaction>;
     auto LookupContact(const Data& pubkeyHash) const noexcept
@@ -84,6 +82,9 @@ public:
         -> UnallocatedVector<pTxid>;
     auto StoreTransaction(const block::bitcoin::Transaction& tx) const noexcept
         -> bool;
+    // Writes every transaction in a single database transaction
+    auto StoreTransactions(const Transactions& transactions) const noexcept
+        -> bool;
     auto UpdateContact(const Contact& contact) const noexcept
         -> UnallocatedVector<pTxid>;
     auto UpdateMergedContact(const Contact& parent, const Contact& child)
@@ -118,6 +119,13 @@ private:
     mutable TransactionToPattern transaction_to_patterns_;
     mutable PatternToTransaction pattern_to_transactions_;
 
+    auto associate_transaction(
+        const Lock& lock,
+        const Txid& txid,
+        const UnallocatedVector<PatternID>& patterns) const noexcept -> bool;
+    auto store_transaction(
+        storage::lmdb::LMDB::Transaction& tx,
+        const block::bitcoin::Transaction& in) const noexcept -> bool;
     auto update_contact(
         const Lock& lock,
         const UnallocatedSet<OTData>& existing,
@@ -243,6 +243,7 @@ public:
 
         try {
             auto tx = lmdb_.TransactionRW();
+            auto processed = Transactions{};
             const auto added = add_transaction(
                 LogTrace(),
                 account,
@@ -255,12 +256,15 @@ public:
                 txoCreated,
                 txoConsumed,
                 cache,
-                tx);
+                tx,
+                processed);
 
             if (false == added) {
                 throw std::runtime_error{"failed to add transaction"};
             }
 
+            process_transactions(std::move(processed));
+
             if (false == tx.Finalize(true)) {
                 throw std::runtime_error{
                     "Failed to commit database transaction"};
@@ -1041,6 +1045,7 @@ public:
 
 private:
     using Cache = libguarded::shared_guarded<OutputCache, std::shared_mutex>;
+    using Transactions = api::crypto::internal::Blockchain::Transactions;
 
     const api::Session& api_;
     const storage::lmdb::LMDB& lmdb_;
@@ -1302,6 +1307,19 @@ private:
 
         return output;
     }
+    auto process_transactions(Transactions&& transactions) const
+        noexcept(false) -> void
+    {
+        if (transactions.empty()) { return; }
+
+        const auto& api = api_.Crypto().Blockchain().Internal();
+        const auto reason = api_.Factory().PasswordPrompt(
+            "Save a received blockchain transaction");
+
+        if (!api.ProcessTransactions(chain_, std::move(transactions), reason)) {
+            throw std::runtime_error{"Error adding transaction to database"};
+        }
+    }
     auto publish_balance(const OutputCache& cache) const noexcept -> void
     {
         const auto& api = api_.Crypto().Blockchain();
@@ -1340,6 +1358,9 @@ private:
         OutputCache& cache,
         storage::lmdb::LMDB::Transaction& tx) noexcept(false) -> bool
     {
+        auto processed = Transactions{};
+        processed.reserve(blockMatches.size());
+
         for (const auto& [txid, transaction] : blockMatches) {
             const auto& [indices, pTx] = transaction;
             log(OT_PRETTY_CLASS())("adding transaction ")(txid->asHex())
@@ -1359,11 +1380,14 @@ private:
                 txoCreated,
                 txoConsumed,
                 cache,
-                tx);
+                tx,
+                processed);
 
             if (false == added) { return false; }
         }
 
+        process_transactions(std::move(processed));
+
         return true;
     }
     [[nodiscard]] auto add_transaction(
@@ -1378,7 +1402,8 @@ private:
         TXOs& txoCreated,
         TXOs& txoConsumed,
         OutputCache& cache,
-        storage::lmdb::LMDB::Transaction& tx) noexcept(false) -> bool
+        storage::lmdb::LMDB::Transaction& tx,
+        Transactions& processed) noexcept(false) -> bool
     {
         const auto& api = api_.Crypto().Blockchain();
         const auto isGeneration = original.IsGeneration();
@@ -1529,12 +1554,9 @@ private:
             txoCreated.emplace(outpoint, output.Internal().clone());
         }
 
-        const auto reason = api_.Factory().PasswordPrompt(
-            "Save a received blockchain transaction");
-
-        if (!api.Internal().ProcessTransaction(chain_, copy, reason)) {
-            throw std::runtime_error{"Error adding transaction to database"};
-        }
+        // NOTE the transaction is stored and indexed by the caller, together
+        // with every other transaction from the same block
+        processed.emplace_back(std::move(pCopy));
 
         return true;
     }
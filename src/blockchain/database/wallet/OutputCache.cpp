@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"  // IWYU pragma: associated
 #include "blockchain/database/wallet/OutputCache.hpp"  // IWYU pragma: associated
 
+#include <google/protobuf/arena.h>
 #include <robin_hood.h>
 #include <algorithm>
 #include <chrono>  // IWYU pragma: keep
@@ -42,6 +43,7 @@
 #include "opentxs/util/Pimpl.hpp"
 #include "opentxs/util/Time.hpp"  // IWYU pragma: keep
 #include "serialization/protobuf/BlockchainTransactionOutput.pb.h"  // IWYU pragma: keep
+#include "util/ByteLiterals.hpp"
 #include "util/LMDB.hpp"
 
 namespace opentxs::blockchain::database::wallet
@@ -554,14 +556,26 @@ auto OutputCache::populate() noexcept -> void
     if (populated_) { return; }
 
     auto outputCount = std::size_t{};
+    static const auto options = proto::BatchArenaOptions(1_MiB);
+    auto arena = google::protobuf::Arena{options};
     const auto outputs = [&](const auto key, const auto value) {
+        // NOTE the serialized outputs are only needed long enough to
+        // construct the native objects so the arena is recycled periodically
+        // to keep its footprint bounded for large wallets
+        static constexpr auto reset = std::size_t{4096};
+
+        if ((0u < outputCount) && (0u == (outputCount % reset))) {
+            arena.Reset();
+        }
+
         ++outputCount;
         outputs_.try_emplace(
             key,
             factory::BitcoinTransactionOutput(
                 api_,
                 chain_,
-                proto::Factory<proto::BlockchainTransactionOutput>(value)));
+                *proto::Factory<proto::BlockchainTransactionOutput>(
+                    arena, value)));
 
         return true;
     };
@@ -5,7 +5,6 @@
 
 #pragma once
 
-#include <boost/container/flat_map.hpp>
 #include <boost/container/vector.hpp>
 #include <chrono>
 #include <cstddef>
@@ -47,6 +46,11 @@ namespace blockchain
 {
 namespace node
 {
+namespace blockoracle
+{
+class BlockCache;
+}  // namespace blockoracle
+
 class HeaderOracle;
 }  // namespace node
 }  // namespace blockchain
@@ -153,29 +157,8 @@ private:
         ~Cache() { Shutdown(); }
 
     private:
-        static const std::size_t cache_limit_;
         static const std::chrono::seconds download_timeout_;
 
-        struct Mem {
-            auto find(const ReadView& id) const noexcept -> BitcoinBlockFuture;
-
-            auto clear() noexcept -> void;
-            auto push(block::Hash&& id, BitcoinBlockFuture&& future) noexcept
-                -> void;
-
-            Mem(const std::size_t limit) noexcept;
-
-        private:
-            using CachedBlock = std::pair<block::Hash, BitcoinBlockFuture>;
-            using Completed = UnallocatedDeque<CachedBlock>;
-            using Index =
-                boost::container::flat_map<ReadView, const CachedBlock*>;
-
-            const std::size_t limit_;
-            Completed queue_;
-            Index index_;
-        };
-
         const api::Session& api_;
         const internal::Network& node_;
         internal::BlockDatabase& db_;
@@ -184,7 +167,7 @@ private:
         const blockchain::Type chain_;
         mutable std::mutex lock_;
         mutable Pending pending_;
-        mutable Mem mem_;
+        const blockoracle::BlockCache& mem_;
         bool running_;
 
         auto download(const block::Hash& block) const noexcept -> bool;
@@ -10,16 +10,25 @@
 #include <robin_hood.h>
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <optional>
 #include <queue>
 #include <shared_mutex>
 #include <string_view>
 #include <utility>
 
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/Mutex.hpp"
 #include "opentxs/api/crypto/Blockchain.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
+#include "opentxs/blockchain/block/bitcoin/Input.hpp"
+#include "opentxs/blockchain/block/bitcoin/Inputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
 #include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/core/Amount.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/network/zeromq/message/Message.tpp"
@@ -36,24 +45,42 @@ struct Mempool::Imp {
     using Transactions =
         UnallocatedVector<std::unique_ptr<const block::bitcoin::Transaction>>;
 
-    auto Dump() const noexcept -> UnallocatedSet<UnallocatedCString>
+    static constexpr auto default_limit_ = std::size_t{300u * 1024u * 1024u};
+
+    auto Bytes() const noexcept -> std::size_t
+    {
+        auto lock = sLock{lock_};
+
+        return bytes_;
+    }
+    auto Dump(const Cursor position, const std::size_t count) const noexcept
+        -> Dumped
     {
+        auto output = Dumped{{}, position};
+        auto& [txids, cursor] = output;
         auto lock = sLock{lock_};
 
-        return active_;
+        for (auto i = sequence_.upper_bound(position), end = sequence_.end();
+             (end != i) && (txids.size() < count);
+             ++i) {
+            const auto& [sequence, txid] = *i;
+            txids.emplace_back(txid);
+            cursor = sequence;
+        }
+
+        return output;
     }
     auto Query(ReadView txid) const noexcept
         -> std::shared_ptr<const block::bitcoin::Transaction>
     {
         auto lock = sLock{lock_};
 
-        try {
+        if (auto i = transactions_.find(Hash{txid}); transactions_.end() != i) {
 
-            return transactions_.at(Hash{txid});
-        } catch (...) {
-
-            return {};
+            return i->second.tx_;
         }
+
+        return {};
     }
     auto Submit(ReadView txid) const noexcept -> bool
     {
@@ -70,8 +97,7 @@ struct Mempool::Imp {
         auto lock = eLock{lock_};
 
         for (const auto& txid : txids) {
-            const auto [it, added] =
-                transactions_.try_emplace(Hash{txid}, nullptr);
+            const auto [it, added] = transactions_.try_emplace(Hash{txid});
 
             if (added) {
                 unexpired_txid_.emplace(Clock::now(), txid);
@@ -95,10 +121,12 @@ struct Mempool::Imp {
             return out;
         }());
     }
-    auto Submit(Transactions&& txns) const noexcept -> void
+    auto Submit(Transactions&& txns, const bool local = false) const noexcept
+        -> void
     {
         const auto now = Clock::now();
         auto lock = eLock{lock_};
+        auto added = UnallocatedVector<Hash>{};
 
         for (auto& tx : txns) {
             if (!tx) {
@@ -108,19 +136,39 @@ struct Mempool::Imp {
             }
 
             auto txid = Hash{tx->ID().Bytes()};
-            const auto [it, added] = transactions_.try_emplace(txid, nullptr);
+            const auto [it, isNew] = transactions_.try_emplace(txid);
 
-            if (added) { unexpired_txid_.emplace(now, txid); }
+            if (isNew) { unexpired_txid_.emplace(now, txid); }
+
+            if (it->second.tx_) { continue; }
+
+            add(txid, it->second, std::move(tx), now, local);
+            unexpired_tx_.emplace(now, txid);
+            added.emplace_back(std::move(txid));
+        }
+
+        evict();
+
+        for (const auto& txid : added) {
+            if (transactions_.at(txid).tx_) { notify(txid); }
+        }
+    }
+    auto Top(const std::size_t count) const noexcept -> Ranked
+    {
+        auto output = Ranked{};
+        auto lock = sLock{lock_};
 
-            auto& existing = it->second;
+        for (auto i = by_rate_.crbegin(), end = by_rate_.crend();
+             (end != i) && (output.size() < count);
+             ++i) {
+            const auto& [rate, txid] = *i;
 
-            if (!existing) {
-                existing = std::move(tx);
-                notify(txid);
-                active_.emplace(txid);
-                unexpired_tx_.emplace(now, std::move(txid));
+            if (transactions_.at(txid).fee_.has_value()) {
+                output.emplace_back(txid, rate);
             }
         }
+
+        return output;
     }
 
     auto Heartbeat() noexcept -> void
@@ -133,12 +181,18 @@ struct Mempool::Imp {
 
             if ((now - time) < tx_limit_) { break; }
 
-            try {
-                transactions_.at(txid).reset();
-            } catch (...) {
+            if (auto i = transactions_.find(txid); transactions_.end() != i) {
+                const auto& entry = i->second;
+
+                // NOTE a transaction which was evicted and later received
+                // again has a newer timestamp. Local transactions are kept
+                // until they are confirmed.
+                if (entry.tx_ && (false == entry.pinned_) &&
+                    (entry.time_ == time)) {
+                    remove(txid);
+                }
             }
 
-            active_.erase(txid);
             unexpired_tx_.pop();
         }
 
@@ -147,50 +201,195 @@ struct Mempool::Imp {
 
             if ((now - time) < txid_limit_) { break; }
 
-            transactions_.erase(txid);
-            active_.erase(txid);
+            if (auto i = transactions_.find(txid); transactions_.end() != i) {
+                const auto& entry = i->second;
+
+                if (false == bool(entry.tx_)) {
+                    transactions_.erase(i);
+                } else if (false == entry.pinned_) {
+                    remove(txid);
+                    transactions_.erase(txid);
+                }
+            }
+
             unexpired_txid_.pop();
         }
     }
+    auto Init(
+        const api::crypto::Blockchain& crypto,
+        internal::WalletDatabase& wallet) noexcept -> void
+    {
+        auto transactions = Transactions{};
+
+        for (const auto& txid : wallet.GetUnconfirmedTransactions()) {
+            if (auto tx = crypto.LoadTransactionBitcoin(txid); tx) {
+                LogVerbose()(OT_PRETTY_CLASS())(
+                    "adding unconfirmed transaction ")(txid->asHex())(
+                    " to mempool")
+                    .Flush();
+                transactions.emplace_back(std::move(tx));
+            } else {
+                LogError()(OT_PRETTY_CLASS())("failed to load transaction ")(
+                    txid->asHex())
+                    .Flush();
+            }
+        }
+
+        Submit(std::move(transactions), true);
+    }
 
-    Imp(const api::crypto::Blockchain& crypto,
-        internal::WalletDatabase& wallet,
-        const network::zeromq::socket::Publish& socket,
-        const Type chain) noexcept
-        : crypto_(crypto)
-        , wallet_(wallet)
-        , chain_(chain)
+    Imp(const network::zeromq::socket::Publish& socket,
+        const Type chain,
+        const std::size_t limit) noexcept
+        : chain_(chain)
+        , limit_(limit)
         , lock_()
         , transactions_()
-        , active_()
+        , by_rate_()
+        , by_score_()
+        , sequence_()
+        , next_sequence_(0)
+        , bytes_(0)
+        , waiting_()
         , unexpired_txid_()
         , unexpired_tx_()
         , socket_(socket)
     {
-        init();
     }
 
 private:
     using Hash = UnallocatedCString;
-    using TransactionMap = robin_hood::unordered_flat_map<
-        Hash,
-        std::shared_ptr<const block::bitcoin::Transaction>>;
+    // The package fee rate of a transaction combines its fee and size with
+    // those of all its unconfirmed ancestors. The eviction score is the
+    // highest package fee rate of the transaction or any of its descendants
+    // so a low fee parent is kept as long as a child pays for it.
+    struct Entry {
+        std::shared_ptr<const block::bitcoin::Transaction> tx_{};
+        Time time_{};
+        Cursor sequence_{};
+        std::size_t bytes_{};
+        std::size_t vbytes_{};
+        std::optional<Amount> fee_{};
+        Amount rate_{};
+        Amount score_{};
+        // Local transactions and their ancestors are never evicted
+        bool pinned_{};
+        UnallocatedSet<Hash> parents_{};
+        UnallocatedSet<Hash> children_{};
+        // Spent transactions which are not in the mempool
+        UnallocatedSet<Hash> missing_{};
+    };
+    using TransactionMap = robin_hood::unordered_node_map<Hash, Entry>;
+    using Index = UnallocatedSet<std::pair<Amount, Hash>>;
     using Data = std::pair<Time, Hash>;
     using Cache = std::queue<Data>;
 
+    // Approximate memory used by a parsed transaction and its index entries
+    // beyond the size of its serialized form
+    static constexpr auto entry_overhead_ = std::size_t{512};
     static constexpr auto tx_limit_ = std::chrono::hours{2};
     static constexpr auto txid_limit_ = std::chrono::hours{24};
 
-    const api::crypto::Blockchain& crypto_;
-    internal::WalletDatabase& wallet_;
     const Type chain_;
+    const std::size_t limit_;
     mutable std::shared_mutex lock_;
     mutable TransactionMap transactions_;
-    mutable UnallocatedSet<Hash> active_;
+    mutable Index by_rate_;
+    mutable Index by_score_;
+    mutable UnallocatedMap<Cursor, Hash> sequence_;
+    mutable Cursor next_sequence_;
+    mutable std::size_t bytes_;
+    // Transactions waiting for each spent transaction which is not in the
+    // mempool, so they can be linked if it arrives later
+    mutable UnallocatedMap<Hash, UnallocatedSet<Hash>> waiting_;
     mutable Cache unexpired_txid_;
     mutable Cache unexpired_tx_;
     const network::zeromq::socket::Publish& socket_;
 
+    auto ancestors(const Entry& entry) const noexcept -> UnallocatedSet<Hash>
+    {
+        auto output = UnallocatedSet<Hash>{};
+        auto queue = UnallocatedVector<Hash>(
+            entry.parents_.begin(), entry.parents_.end());
+
+        while (false == queue.empty()) {
+            auto txid = std::move(queue.back());
+            queue.pop_back();
+            const auto& parents = transactions_.at(txid).parents_;
+
+            if (output.emplace(std::move(txid)).second) {
+                queue.insert(queue.end(), parents.begin(), parents.end());
+            }
+        }
+
+        return output;
+    }
+    auto descendants(const Hash& txid) const noexcept -> UnallocatedSet<Hash>
+    {
+        auto output = UnallocatedSet<Hash>{};
+        auto queue = UnallocatedVector<Hash>{txid};
+
+        while (false == queue.empty()) {
+            auto hash = std::move(queue.back());
+            queue.pop_back();
+            const auto& children = transactions_.at(hash).children_;
+
+            if (output.emplace(std::move(hash)).second) {
+                queue.insert(queue.end(), children.begin(), children.end());
+            }
+        }
+
+        return output;
+    }
+    // Input values are known when the spent output belongs to another
+    // transaction in the mempool or was associated with the input by the
+    // wallet. Otherwise the fee can not be calculated.
+    auto fee(
+        const block::bitcoin::Transaction& tx,
+        UnallocatedSet<Hash>& parents,
+        UnallocatedSet<Hash>& missing) const noexcept -> std::optional<Amount>
+    {
+        auto in = Amount{0};
+        auto known{true};
+
+        for (const auto& input : tx.Inputs()) {
+            const auto& outpoint = input.PreviousOutput();
+            auto parent = Hash{outpoint.Txid()};
+
+            if (auto i = transactions_.find(parent);
+                (transactions_.end() != i) && i->second.tx_) {
+                const auto& outputs = i->second.tx_->Outputs();
+                const auto index = outpoint.Index();
+                parents.emplace(std::move(parent));
+
+                if (index < outputs.size()) {
+                    in += outputs.at(index).Value();
+                } else {
+                    known = false;
+                }
+
+                continue;
+            }
+
+            missing.emplace(std::move(parent));
+
+            try {
+                in += input.Internal().Spends().Value();
+            } catch (...) {
+                known = false;
+            }
+        }
+
+        if (false == known) { return std::nullopt; }
+
+        auto out = Amount{0};
+
+        for (const auto& output : tx.Outputs()) { out += output.Value(); }
+
+        if (out > in) { return std::nullopt; }
+
+        return in - out;
+    }
     auto notify(ReadView txid) const noexcept -> void
     {
         socket_.Send([&] {
@@ -203,25 +402,177 @@ private:
         }());
     }
 
-    auto init() noexcept -> void
+    auto add(
+        const Hash& txid,
+        Entry& entry,
+        std::unique_ptr<const block::bitcoin::Transaction> tx,
+        const Time time,
+        const bool local) const noexcept -> void
     {
-        auto transactions = Transactions{};
+        entry.time_ = time;
+        entry.sequence_ = ++next_sequence_;
+        entry.bytes_ = tx->Internal().CalculateSize() + entry_overhead_;
+        entry.vbytes_ = std::max(tx->vBytes(chain_), std::size_t{1});
+        entry.fee_ = fee(*tx, entry.parents_, entry.missing_);
+        entry.pinned_ = local;
+        entry.tx_ = std::move(tx);
+        entry.rate_ = rate(entry);
+        entry.score_ = entry.rate_;
+        by_rate_.emplace(entry.rate_, txid);
+        by_score_.emplace(entry.score_, txid);
+        sequence_.emplace(entry.sequence_, txid);
+        bytes_ += entry.bytes_;
+
+        if (local) { pin(entry); }
+
+        for (const auto& parent : entry.missing_) {
+            waiting_[parent].emplace(txid);
+        }
 
-        for (const auto& txid : wallet_.GetUnconfirmedTransactions()) {
-            if (auto tx = crypto_.LoadTransactionBitcoin(txid); tx) {
-                LogVerbose()(OT_PRETTY_CLASS())(
-                    "adding unconfirmed transaction ")(txid->asHex())(
-                    " to mempool")
-                    .Flush();
-                transactions.emplace_back(std::move(tx));
-            } else {
-                LogError()(OT_PRETTY_CLASS())("failed to load transaction ")(
-                    txid->asHex())
-                    .Flush();
+        for (const auto& parent : entry.parents_) {
+            transactions_.at(parent).children_.emplace(txid);
+            rescore(parent);
+        }
+
+        adopt(txid, entry);
+    }
+    // Links transactions which were received before the newly added parent
+    // and recalculates their fees and package fee rates
+    auto adopt(const Hash& txid, Entry& entry) const noexcept -> void
+    {
+        auto i = waiting_.find(txid);
+
+        if (waiting_.end() == i) { return; }
+
+        auto changed = UnallocatedSet<Hash>{};
+
+        for (const auto& hash : i->second) {
+            auto& child = transactions_.at(hash);
+            child.missing_.erase(txid);
+            child.parents_.emplace(txid);
+            entry.children_.emplace(hash);
+
+            if (child.pinned_) { pin(child); }
+
+            const auto affected = descendants(hash);
+            changed.insert(affected.begin(), affected.end());
+        }
+
+        waiting_.erase(i);
+
+        for (const auto& hash : changed) {
+            auto& descendant = transactions_.at(hash);
+
+            if (0u < entry.children_.count(hash)) {
+                descendant.fee_ = fee(
+                    *descendant.tx_, descendant.parents_, descendant.missing_);
+            }
+
+            by_rate_.erase({descendant.rate_, hash});
+            descendant.rate_ = rate(descendant);
+            by_rate_.emplace(descendant.rate_, hash);
+        }
+
+        for (const auto& hash : changed) { rescore(hash); }
+
+        rescore(txid);
+    }
+    auto evict() const noexcept -> void
+    {
+        auto evicted = std::size_t{0};
+        auto i = by_score_.begin();
+
+        while ((limit_ < bytes_) && (by_score_.end() != i)) {
+            const auto& [score, txid] = *i;
+
+            if (transactions_.at(txid).pinned_) {
+                ++i;
+
+                continue;
+            }
+
+            evicted += remove(Hash{txid});
+            i = by_score_.begin();
+        }
+
+        if (0u < evicted) {
+            LogVerbose()(OT_PRETTY_CLASS())("evicted ")(
+                evicted)(" transactions to stay within ")(limit_)(" bytes")
+                .Flush();
+        }
+    }
+    auto pin(const Entry& entry) const noexcept -> void
+    {
+        for (const auto& hash : ancestors(entry)) {
+            transactions_.at(hash).pinned_ = true;
+        }
+    }
+    auto rate(const Entry& entry) const noexcept -> Amount
+    {
+        auto packageFee = entry.fee_.value_or(0);
+        auto packageBytes = entry.vbytes_;
+
+        for (const auto& hash : ancestors(entry)) {
+            const auto& ancestor = transactions_.at(hash);
+            packageFee += ancestor.fee_.value_or(0);
+            packageBytes += ancestor.vbytes_;
+        }
+
+        return packageFee * 1000 / packageBytes;
+    }
+    // Removes a transaction along with every descendant since they can not be
+    // valid without it. The txid is remembered so it will not be downloaded
+    // again until it expires.
+    auto remove(const Hash& txid) const noexcept -> std::size_t
+    {
+        const auto removed = descendants(txid);
+        auto parents = UnallocatedSet<Hash>{};
+
+        for (const auto& hash : removed) {
+            auto& entry = transactions_.at(hash);
+
+            for (const auto& parent : entry.parents_) {
+                if (0u < removed.count(parent)) { continue; }
+
+                transactions_.at(parent).children_.erase(hash);
+                parents.emplace(parent);
+            }
+
+            for (const auto& parent : entry.missing_) {
+                if (auto i = waiting_.find(parent); waiting_.end() != i) {
+                    i->second.erase(hash);
+
+                    if (i->second.empty()) { waiting_.erase(i); }
+                }
             }
+
+            by_rate_.erase({entry.rate_, hash});
+            by_score_.erase({entry.score_, hash});
+            sequence_.erase(entry.sequence_);
+            bytes_ -= entry.bytes_;
+            entry = Entry{};
+        }
+
+        for (const auto& parent : parents) { rescore(parent); }
+
+        return removed.size();
+    }
+    auto rescore(const Hash& txid) const noexcept -> void
+    {
+        auto& entry = transactions_.at(txid);
+        auto score = entry.rate_;
+
+        for (const auto& child : entry.children_) {
+            score = std::max(score, transactions_.at(child).score_);
         }
 
-        Submit(std::move(transactions));
+        if (score == entry.score_) { return; }
+
+        by_score_.erase({entry.score_, txid});
+        entry.score_ = score;
+        by_score_.emplace(entry.score_, txid);
+
+        for (const auto& parent : entry.parents_) { rescore(parent); }
     }
 };
 
@@ -230,13 +581,25 @@ Mempool::Mempool(
     internal::WalletDatabase& wallet,
     const network::zeromq::socket::Publish& socket,
     const Type chain) noexcept
-    : imp_(std::make_unique<Imp>(crypto, wallet, socket, chain))
+    : Mempool(socket, chain, Imp::default_limit_)
 {
+    imp_->Init(crypto, wallet);
 }
 
-auto Mempool::Dump() const noexcept -> UnallocatedSet<UnallocatedCString>
+Mempool::Mempool(
+    const network::zeromq::socket::Publish& socket,
+    const Type chain,
+    const std::size_t limit) noexcept
+    : imp_(std::make_unique<Imp>(socket, chain, limit))
 {
-    return imp_->Dump();
+}
+
+auto Mempool::Bytes() const noexcept -> std::size_t { return imp_->Bytes(); }
+
+auto Mempool::Dump(const Cursor position, const std::size_t count)
+    const noexcept -> Dumped
+{
+    return imp_->Dump(position, count);
 }
 
 auto Mempool::Heartbeat() noexcept -> void { imp_->Heartbeat(); }
@@ -264,5 +627,10 @@ auto Mempool::Submit(std::unique_ptr<const block::bitcoin::Transaction> tx)
     imp_->Submit(std::move(tx));
 }
 
+auto Mempool::Top(const std::size_t count) const noexcept -> Ranked
+{
+    return imp_->Top(count);
+}
+
 Mempool::~Mempool() = default;
 }  // namespace opentxs::blockchain::node
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 #include "internal/blockchain/node/Node.hpp"
@@ -70,7 +71,10 @@ namespace opentxs::blockchain::node
 class Mempool final : public internal::Mempool
 {
 public:
-    auto Dump() const noexcept -> UnallocatedSet<UnallocatedCString> final;
+    // Estimated memory used by active transactions
+    auto Bytes() const noexcept -> std::size_t;
+    auto Dump(const Cursor position, const std::size_t count) const noexcept
+        -> Dumped final;
     auto Query(ReadView txid) const noexcept
         -> std::shared_ptr<const block::bitcoin::Transaction> final;
     auto Submit(ReadView txid) const noexcept -> bool final;
@@ -78,14 +82,22 @@ public:
         -> UnallocatedVector<bool> final;
     auto Submit(std::unique_ptr<const block::bitcoin::Transaction> tx)
         const noexcept -> void final;
+    auto Top(const std::size_t count) const noexcept -> Ranked final;
 
     auto Heartbeat() noexcept -> void final;
 
+    // Loads unconfirmed wallet transactions, which are never evicted
     Mempool(
         const api::crypto::Blockchain& crypto,
         internal::WalletDatabase& db,
         const network::zeromq::socket::Publish& socket,
         const Type chain) noexcept;
+    // Starts empty. The lowest paying transactions are evicted whenever the
+    // estimated memory use exceeds limit bytes.
+    Mempool(
+        const network::zeromq::socket::Publish& socket,
+        const Type chain,
+        const std::size_t limit) noexcept;
 
     ~Mempool() final;
 
@@ -0,0 +1,116 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                         // IWYU pragma: associated
+#include "1_Internal.hpp"                       // IWYU pragma: associated
+#include "blockchain/node/base/SyncReader.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <chrono>
+
+#include "internal/blockchain/Blockchain.hpp"
+#include "opentxs/core/Data.hpp"
+
+namespace opentxs::blockchain::node::base
+{
+using namespace std::literals::chrono_literals;
+
+const std::size_t SyncReader::chunk_{100};
+const std::size_t SyncReader::read_ahead_{16};
+
+SyncReader::SyncReader(
+    FilterLoader filters,
+    HeaderLoader header,
+    Post post) noexcept
+    : filters_(std::move(filters))
+    , header_(std::move(header))
+    , post_(std::move(post))
+    , reading_()
+{
+}
+
+auto SyncReader::Chunks(const std::size_t count) noexcept
+    -> UnallocatedVector<Range>
+{
+    auto output = UnallocatedVector<Range>{};
+    output.reserve((count + chunk_ - 1u) / chunk_);
+
+    for (auto first = std::size_t{0}; first < count; first += chunk_) {
+        output.emplace_back(first, std::min(first + chunk_, count));
+    }
+
+    return output;
+}
+
+auto SyncReader::Full() noexcept -> bool
+{
+    static const auto is_ready = [](const auto& future) {
+        return std::future_status::ready == future.wait_for(0s);
+    };
+
+    while ((0u < reading_.size()) && is_ready(reading_.front())) {
+        reading_.pop_front();
+    }
+
+    return reading_.size() >= read_ahead_;
+}
+
+auto SyncReader::Prepare(const Hashes& blocks) const noexcept -> Prepared
+{
+    auto output = Prepared(blocks.size());
+    auto decoded = UnallocatedVector<bool>(blocks.size(), false);
+    auto index = std::size_t{0};
+    filters_(blocks, [&](const auto&, const auto bytes) {
+        const auto i = index++;
+
+        try {
+            auto& data = output.at(i);
+            const auto [count, filter] =
+                blockchain::internal::DecodeSerializedCfilter(bytes);
+            data.count_ = count;
+            data.filter_ = space(filter);
+            decoded.at(i) = true;
+        } catch (...) {
+        }
+    });
+
+    for (auto i = std::size_t{0}; i < blocks.size(); ++i) {
+        if (false == decoded.at(i)) { continue; }
+
+        const auto pHeader = header_(blocks.at(i));
+
+        if (false == bool(pHeader)) { continue; }
+
+        auto& data = output.at(i);
+        const auto& header = *pHeader;
+        data.parent_ = header.ParentHash();
+        data.header_ = space(header.Encode()->Bytes());
+    }
+
+    return output;
+}
+
+auto SyncReader::Start(Job&& job) noexcept -> void
+{
+    auto promise = std::make_shared<std::promise<void>>();
+    reading_.emplace_back(promise->get_future());
+    auto wrapped = [job = std::move(job), promise]() mutable {
+        job();
+        job = {};
+        promise->set_value();
+    };
+
+    if (false == post_(wrapped)) { wrapped(); }
+}
+
+auto SyncReader::Wait() noexcept -> void
+{
+    for (auto& future : reading_) { future.wait(); }
+
+    reading_.clear();
+}
+
+SyncReader::~SyncReader() { Wait(); }
+}  // namespace opentxs::blockchain::node::base
@@ -0,0 +1,86 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <utility>
+
+#include "internal/blockchain/node/Node.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/bitcoin/Header.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::node::base
+{
+// Header and cfilter bytes for one block, ready to be packed into a sync packet
+struct SyncPacketData {
+    block::Hash parent_{};
+    Space header_{};
+    std::uint32_t count_{};
+    Space filter_{};
+
+    auto IsValid() const noexcept -> bool { return false == header_.empty(); }
+};
+
+// Read-ahead stage of the sync server. Each download batch is split into
+// chunks which load their encoded filters and block headers in parallel on a
+// thread pool, with a bounded number of chunks outstanding.
+//
+// Full(), Start() and Wait() must be called from a single thread.
+class SyncReader
+{
+public:
+    using Hashes = Vector<block::Hash>;
+    using Prepared = UnallocatedVector<SyncPacketData>;
+    using Range = std::pair<std::size_t, std::size_t>;
+    using Job = std::function<void()>;
+    using FilterLoader = std::function<std::size_t(
+        const Hashes&,
+        const node::internal::FilterDatabase::EncodedFilterVisitor&)>;
+    using HeaderLoader = std::function<std::unique_ptr<block::bitcoin::Header>(
+        const block::Hash&)>;
+    using Post = std::function<bool(Job)>;
+
+    // Number of heights loaded by each job
+    static const std::size_t chunk_;
+    // Maximum number of outstanding jobs
+    static const std::size_t read_ahead_;
+
+    // Splits a batch of count tasks into the half-open ranges loaded by each
+    // job
+    static auto Chunks(const std::size_t count) noexcept
+        -> UnallocatedVector<Range>;
+
+    // Blocks whose filter or header could not be loaded are left invalid
+    auto Prepare(const Hashes& blocks) const noexcept -> Prepared;
+
+    // Returns true if no more jobs should be started until some finish
+    auto Full() noexcept -> bool;
+    // Runs the job on the calling thread if it can not be posted
+    auto Start(Job&& job) noexcept -> void;
+    auto Wait() noexcept -> void;
+
+    SyncReader(FilterLoader filters, HeaderLoader header, Post post) noexcept;
+
+    ~SyncReader();
+
+private:
+    const FilterLoader filters_;
+    const HeaderLoader header_;
+    const Post post_;
+    UnallocatedDeque<std::future<void>> reading_;
+
+    SyncReader(const SyncReader&) = delete;
+    SyncReader(SyncReader&&) = delete;
+    auto operator=(const SyncReader&) -> SyncReader& = delete;
+    auto operator=(SyncReader&&) -> SyncReader& = delete;
+};
+}  // namespace opentxs::blockchain::node::base
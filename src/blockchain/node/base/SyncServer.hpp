@@ -9,22 +9,29 @@
 #include "1_Internal.hpp"  // IWYU pragma: associated
 
 #include <zmq.h>
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <functional>
+#include <future>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <thread>
 
 #include "Proto.hpp"
 #include "Proto.tpp"
 #include "blockchain/DownloadManager.hpp"
+#include "blockchain/node/base/SyncReader.hpp"
 #include "blockchain/node/filteroracle/FilterOracle.hpp"
+#include "internal/api/network/Asio.hpp"
 #include "internal/api/session/Endpoints.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/network/p2p/Factory.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/Signals.hpp"
 #include "network/zeromq/socket/Socket.hpp"
+#include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
@@ -44,12 +51,15 @@
 #include "opentxs/network/zeromq/message/Message.tpp"
 #include "opentxs/network/zeromq/socket/Publish.hpp"
 #include "opentxs/network/zeromq/socket/Socket.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/WorkType.hpp"
 
 namespace opentxs::blockchain::node::base
 {
-using SyncDM = download::Manager<SyncServer, GCS, int, cfilter::Type>;
+using SyncDM =
+    download::Manager<SyncServer, SyncPacketData, int, cfilter::Type>;
 using SyncWorker = Worker<SyncServer, api::Session>;
 
 class SyncServer : public SyncDM, public SyncWorker
@@ -101,6 +111,17 @@ public:
         , linger_(0)
         , endpoint_(publishEndpoint)
         , socket_(::zmq_socket(api_.Network().ZeroMQ(), ZMQ_PAIR), ::zmq_close)
+        , reader_(
+              [this](const auto& blocks, const auto& visitor) {
+                  return filter_.LoadEncodedFilters(type_, blocks, visitor);
+              },
+              [this](const auto& block) {
+                  return header_.Internal().LoadBitcoinHeader(block);
+              },
+              [this](auto job) {
+                  return api_.Network().Asio().Internal().Post(
+                      ThreadPool::Storage, std::move(job));
+              })
         , zmq_lock_()
         , zmq_running_(true)
         , zmq_thread_(&SyncServer::zmq_thread, this)
@@ -132,6 +153,9 @@ private:
     const int linger_;
     const UnallocatedCString endpoint_;
     Socket socket_;
+    SyncReader reader_;
+    // NOTE only guards socket_, which is shared by the pipeline and the zmq
+    // thread. It must not be held while loading or assembling data.
     mutable std::mutex zmq_lock_;
     std::atomic_bool zmq_running_;
     std::thread zmq_thread_;
@@ -154,7 +178,7 @@ private:
         }
     }
     auto check_task(TaskType&) const noexcept -> void {}
-    auto hello(const Lock&, const block::Position& incoming) const noexcept
+    auto hello(const block::Position& incoming) const noexcept
     {
         // TODO use known() and Ancestors() instead
         auto [parent, best] = header_.CommonParent(incoming);
@@ -179,14 +203,42 @@ private:
             .Flush();
     }
 
+    // Read-ahead stage: the tasks of each batch are loaded in chunks on the
+    // storage thread pool. A batch is handed to the assembly stage
+    // (queue_processing) by the download manager once every chunk has
+    // finished and the last reference to the batch is released.
     auto download() noexcept -> void
     {
-        auto work = NextBatch();
+        if (reader_.Full()) { return; }
 
-        for (const auto& task : work.data_) {
-            // TODO allocator
-            task->download(
-                filter_.LoadFilter(type_, task->position_.second, {}));
+        auto batch = std::make_shared<BatchType>(NextBatch());
+
+        if (false == bool(*batch)) { return; }
+
+        for (const auto& [first, last] :
+             SyncReader::Chunks(batch->data_.size())) {
+            reader_.Start([this, batch, first = first, last = last]() mutable {
+                const auto& tasks = batch->data_;
+                auto prepared = reader_.Prepare([&] {
+                    auto out = SyncReader::Hashes{};
+                    out.reserve(last - first);
+
+                    for (auto i = first; i < last; ++i) {
+                        out.emplace_back(tasks.at(i)->position_.second);
+                    }
+
+                    return out;
+                }());
+
+                for (auto i = first; i < last; ++i) {
+                    // NOTE invalid data causes the task to be redownloaded
+                    tasks.at(i)->download(std::move(prepared.at(i - first)));
+                }
+
+                // NOTE the batch must be released before the job finishes
+                // since releasing it calls back into this object
+                batch.reset();
+            });
         }
     }
     auto pipeline(const zmq::Message& in) noexcept -> void
@@ -207,8 +259,6 @@ private:
                 OT_FAIL;
             }
         }();
-        auto lock = Lock{zmq_lock_};
-
         switch (work) {
             case Work::shutdown: {
                 shutdown(shutdown_promise_);
@@ -294,9 +344,10 @@ private:
         } catch (...) {
         }
     }
-    auto process_zmq(const Lock& lock) noexcept -> void
+    auto process_zmq() noexcept -> void
     {
         const auto incoming = [&] {
+            auto lock = Lock{zmq_lock_};
             auto output = network::zeromq::Message{};
             OTSocket::receive_message(lock, socket_.get(), output);
 
@@ -324,7 +375,7 @@ private:
                 throw std::runtime_error{"No matching chains"};
             }();
             const auto& position = state.Position();
-            auto [needSync, parent, data] = hello(lock, position);
+            auto [needSync, parent, data] = hello(position);
             const auto& [height, hash] = parent;
             auto reply = factory::BlockchainSyncData(
                 WorkType::P2PBlockchainSyncReply, std::move(data), {}, {});
@@ -334,37 +385,34 @@ private:
 
             auto out = network::zeromq::reply_to_message(incoming);
 
-            if (send && reply.Serialize(out)) {
-                OTSocket::send_message(lock, socket_.get(), std::move(out));
-            }
+            if (send && reply.Serialize(out)) { send_message(std::move(out)); }
         } catch (const std::exception& e) {
             LogError()(OT_PRETTY_CLASS())(__func__)(": ")(e.what()).Flush();
         }
     }
+    // Assembly stage: packs the prepared bytes into a sync packet
     auto queue_processing(DownloadedData&& data) noexcept -> void
     {
         if (0 == data.size()) { return; }
 
         const auto& tip = data.back();
         auto items = UnallocatedVector<network::p2p::Block>{};
+        items.reserve(data.size());
         auto previousFilterHeader = api_.Factory().Data();
 
         for (const auto& task : data) {
             try {
-                const auto pHeader = header_.Internal().LoadBitcoinHeader(
-                    task->position_.second);
+                const auto& prepared = task->data_.get();
 
-                if (false == bool(pHeader)) {
+                if (false == prepared.IsValid()) {
                     throw std::runtime_error(
-                        UnallocatedCString{"failed to load block header "} +
+                        UnallocatedCString{"failed to load data for block "} +
                         task->position_.second.asHex());
                 }
 
-                const auto& header = *pHeader;
-
                 if (previousFilterHeader->empty()) {
                     previousFilterHeader =
-                        filter_.LoadFilterHeader(type_, header.ParentHash());
+                        filter_.LoadFilterHeader(type_, prepared.parent_);
 
                     if (previousFilterHeader->empty()) {
                         throw std::runtime_error(
@@ -375,28 +423,13 @@ private:
                     }
                 }
 
-                const auto& cfilter = task->data_.get();
-
-                if (false == cfilter.IsValid()) {
-                    throw std::runtime_error(
-                        UnallocatedCString{"failed to load gcs for block "} +
-                        task->position_.second.asHex());
-                }
-
-                const auto headerBytes = header.Encode();
-                const auto filterBytes = [&] {
-                    auto out = Space{};
-                    cfilter.Compressed(writer(out));
-
-                    return out;
-                }();
                 items.emplace_back(
                     chain_,
                     task->position_.first,
                     type_,
-                    cfilter.ElementCount(),
-                    headerBytes->Bytes(),
-                    reader(filterBytes));
+                    prepared.count_,
+                    reader(prepared.header_),
+                    reader(prepared.filter_));
                 task->process(1);
             } catch (const std::exception& e) {
                 LogError()(OT_PRETTY_CLASS())(__func__)(": ")(e.what()).Flush();
@@ -423,18 +456,20 @@ private:
             previousFilterHeader->Bytes());
         auto work = network::zeromq::Message{};
 
-        if (msg.Serialize(work) && zmq_running_) {
-            // NOTE the appropriate lock is already being held in the pipeline
-            // function
-            auto dummy = std::mutex{};
-            auto lock = Lock{dummy};
-            OTSocket::send_message(lock, socket_.get(), std::move(work));
-        }
+        if (msg.Serialize(work)) { send_message(std::move(work)); }
+    }
+    auto send_message(network::zeromq::Message&& message) noexcept -> void
+    {
+        if (false == zmq_running_) { return; }
+
+        auto lock = Lock{zmq_lock_};
+        OTSocket::send_message(lock, socket_.get(), std::move(message));
     }
     auto shutdown(std::promise<void>& promise) noexcept -> void
     {
         if (auto previous = running_.exchange(false); previous) {
             pipeline_.Close();
+            reader_.Wait();
             promise.set_value();
         }
     }
@@ -472,12 +507,10 @@ private:
                 continue;
             }
 
-            auto lock = Lock{zmq_lock_};
-
             for (const auto& item : poll) {
                 if (ZMQ_POLLIN != item.revents) { continue; }
 
-                process_zmq(lock);
+                process_zmq();
             }
         }
 
@@ -0,0 +1,245 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "blockchain/node/blockoracle/BlockCache.hpp"  // IWYU pragma: associated
+
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "internal/blockchain/block/Block.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/node/BlockOracle.hpp"
+#include "opentxs/util/Container.hpp"
+#include "util/ByteLiterals.hpp"
+
+namespace opentxs::blockchain::node::blockoracle
+{
+const std::size_t BlockCache::default_budget_{256_MiB};
+
+BlockCache::BlockCache(const std::size_t budget) noexcept
+    : budget_(budget)
+    , protected_budget_((budget_ / 5u) * 4u)
+    , lock_()
+    , probation_()
+    , protected_()
+    , index_()
+    , loading_()
+    , probation_bytes_(0)
+    , protected_bytes_(0)
+    , hits_(0)
+    , misses_(0)
+{
+}
+
+BlockCache::BlockCache() noexcept
+    : BlockCache(default_budget_)
+{
+}
+
+auto BlockCache::Clear(const blockchain::Type chain) const noexcept -> void
+{
+    auto lock = Lock{lock_};
+
+    for (auto i = index_.begin(); i != index_.end();) {
+        if (chain == i->first.first) {
+            erase(i->second);
+            i = index_.erase(i);
+        } else {
+            ++i;
+        }
+    }
+
+    for (auto i = loading_.begin(); i != loading_.end();) {
+        if (chain == i->first.first) {
+            auto& [promise, future] = i->second;
+            promise.set_value(nullptr);
+            i = loading_.erase(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+auto BlockCache::erase(LRU::iterator item) const noexcept -> void
+{
+    if (Segment::protect == item->segment_) {
+        protected_bytes_ -= item->bytes_;
+        protected_.erase(item);
+    } else {
+        probation_bytes_ -= item->bytes_;
+        probation_.erase(item);
+    }
+}
+
+auto BlockCache::evict() const noexcept -> void
+{
+    while (protected_bytes_ > protected_budget_) {
+        auto& item = protected_.back();
+        item.segment_ = Segment::probation;
+        protected_bytes_ -= item.bytes_;
+        probation_bytes_ += item.bytes_;
+        probation_.splice(
+            probation_.begin(), protected_, std::prev(protected_.end()));
+    }
+
+    while ((probation_bytes_ + protected_bytes_) > budget_) {
+        auto& segment = probation_.empty() ? protected_ : probation_;
+
+        if (segment.empty()) { break; }
+
+        auto item = std::prev(segment.end());
+        index_.erase(item->key_);
+        erase(item);
+    }
+}
+
+auto BlockCache::Find(const blockchain::Type chain, const block::Hash& id)
+    const noexcept -> BitcoinBlockFuture
+{
+    if (id.IsNull()) { return {}; }
+
+    const auto key = std::make_pair(chain, id);
+    auto lock = Lock{lock_};
+
+    auto output = find(key);
+
+    if (output.valid()) {
+        ++hits_;
+    } else {
+        ++misses_;
+    }
+
+    return output;
+}
+
+auto BlockCache::find(const Key& key) const noexcept -> BitcoinBlockFuture
+{
+    const auto i = index_.find(key);
+
+    if (index_.end() == i) { return {}; }
+
+    auto item = i->second;
+    auto output = item->future_;
+
+    if (Segment::probation == item->segment_) {
+        item->segment_ = Segment::protect;
+        probation_bytes_ -= item->bytes_;
+        protected_bytes_ += item->bytes_;
+        protected_.splice(protected_.begin(), probation_, item);
+        evict();
+    } else {
+        protected_.splice(protected_.begin(), protected_, item);
+    }
+
+    return output;
+}
+
+auto BlockCache::FinishLoad(
+    const blockchain::Type chain,
+    const block::Hash& id,
+    BitcoinBlock_p block) const noexcept -> std::optional<Load>
+{
+    auto key = std::make_pair(chain, id);
+    auto lock = Lock{lock_};
+    auto i = loading_.find(key);
+
+    // NOTE Clear() already resolved the promise
+    if (loading_.end() == i) { return std::nullopt; }
+
+    auto load = std::move(i->second);
+    loading_.erase(i);
+
+    if (false == bool(block)) { return std::make_optional(std::move(load)); }
+
+    auto& [promise, future] = load;
+    promise.set_value(std::move(block));
+    push(std::move(key), std::move(future));
+
+    return std::nullopt;
+}
+
+auto BlockCache::serialized_size(const BitcoinBlockFuture& future) noexcept
+    -> std::size_t
+{
+    // NOTE only completed downloads are cached so this never blocks
+    const auto& block = future.get();
+
+    if (false == bool(block)) { return 0u; }
+
+    return block->Internal().CalculateSize();
+}
+
+auto BlockCache::Push(
+    const blockchain::Type chain,
+    const block::Hash& id,
+    BitcoinBlockFuture future) const noexcept -> void
+{
+    if (id.IsNull()) { return; }
+
+    auto lock = Lock{lock_};
+    push(std::make_pair(chain, id), std::move(future));
+}
+
+auto BlockCache::push(Key&& key, BitcoinBlockFuture&& future) const noexcept
+    -> void
+{
+    if (0u < index_.count(key)) { return; }
+
+    const auto bytes = serialized_size(future);
+    auto item = probation_.insert(
+        probation_.begin(),
+        CachedBlock{key, std::move(future), bytes, Segment::probation});
+    probation_bytes_ += bytes;
+    index_.emplace(std::move(key), item);
+    evict();
+}
+
+auto BlockCache::StartLoad(const blockchain::Type chain, const block::Hash& id)
+    const noexcept -> std::pair<BitcoinBlockFuture, bool>
+{
+    auto key = std::make_pair(chain, id);
+    auto lock = Lock{lock_};
+
+    // NOTE another thread may have finished loading the block since the
+    // caller checked the cache
+    if (auto future = find(key); future.valid()) {
+        return std::make_pair(std::move(future), false);
+    }
+
+    if (auto i = loading_.find(key); loading_.end() != i) {
+        return std::make_pair(i->second.second, false);
+    }
+
+    auto& [promise, future] = loading_[std::move(key)];
+    future = promise.get_future();
+
+    return std::make_pair(future, true);
+}
+
+auto BlockCache::Stats() const noexcept -> Statistics
+{
+    auto lock = Lock{lock_};
+
+    return Statistics{
+        probation_bytes_ + protected_bytes_,
+        index_.size(),
+        hits_.load(),
+        misses_.load()};
+}
+
+BlockCache::~BlockCache()
+{
+    for (auto& [key, load] : loading_) {
+        auto& [promise, future] = load;
+        promise.set_value(nullptr);
+    }
+}
+}  // namespace opentxs::blockchain::node::blockoracle
@@ -0,0 +1,117 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/node/BlockOracle.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::node::blockoracle
+{
+// Segmented LRU of decoded blocks shared by every chain of a session. Blocks
+// enter the probationary segment and are promoted to the protected segment on
+// their second hit, so a single pass over many blocks (for example a rescan)
+// can not flush blocks which are being reused.
+//
+// Blocks which are being read from storage are tracked as well so concurrent
+// requests for the same block wait on a single load.
+//
+// The budget is measured in the serialized size of the cached blocks. Decoded
+// blocks use more memory than their serialized form so the budget limits the
+// memory used by the cache only approximately.
+class BlockCache
+{
+public:
+    using BitcoinBlock_p = node::BlockOracle::BitcoinBlock_p;
+    using BitcoinBlockFuture = node::BlockOracle::BitcoinBlockFuture;
+    using Promise = std::promise<BitcoinBlock_p>;
+    using Load = std::pair<Promise, BitcoinBlockFuture>;
+
+    struct Statistics {
+        std::size_t serialized_bytes_{};
+        std::size_t items_{};
+        std::uint64_t hits_{};
+        std::uint64_t misses_{};
+    };
+
+    static const std::size_t default_budget_;
+
+    auto Clear(const blockchain::Type chain) const noexcept -> void;
+    auto Find(const blockchain::Type chain, const block::Hash& id)
+        const noexcept -> BitcoinBlockFuture;
+    // Resolves a load started by StartLoad. If the block was not found in
+    // storage the promise is returned so the caller can download it instead.
+    auto FinishLoad(
+        const blockchain::Type chain,
+        const block::Hash& id,
+        BitcoinBlock_p block) const noexcept -> std::optional<Load>;
+    auto Push(
+        const blockchain::Type chain,
+        const block::Hash& id,
+        BitcoinBlockFuture future) const noexcept -> void;
+    // The second value is true if the caller must load the block and then
+    // call FinishLoad
+    auto StartLoad(const blockchain::Type chain, const block::Hash& id)
+        const noexcept -> std::pair<BitcoinBlockFuture, bool>;
+    auto Stats() const noexcept -> Statistics;
+
+    BlockCache() noexcept;
+    BlockCache(const std::size_t budget) noexcept;
+
+    ~BlockCache();
+
+private:
+    enum class Segment : bool { probation, protect };
+
+    using Key = std::pair<blockchain::Type, block::Hash>;
+
+    struct CachedBlock {
+        Key key_;
+        BitcoinBlockFuture future_;
+        std::size_t bytes_;
+        Segment segment_;
+    };
+
+    using LRU = UnallocatedList<CachedBlock>;
+    using Index = UnallocatedMap<Key, LRU::iterator>;
+    using Loading = UnallocatedMap<Key, Load>;
+
+    const std::size_t budget_;
+    const std::size_t protected_budget_;
+    mutable std::mutex lock_;
+    mutable LRU probation_;
+    mutable LRU protected_;
+    mutable Index index_;
+    mutable Loading loading_;
+    mutable std::size_t probation_bytes_;
+    mutable std::size_t protected_bytes_;
+    mutable std::atomic<std::uint64_t> hits_;
+    mutable std::atomic<std::uint64_t> misses_;
+
+    static auto serialized_size(const BitcoinBlockFuture& future) noexcept
+        -> std::size_t;
+
+    auto erase(LRU::iterator item) const noexcept -> void;
+    auto evict() const noexcept -> void;
+    auto find(const Key& key) const noexcept -> BitcoinBlockFuture;
+    auto push(Key&& key, BitcoinBlockFuture&& future) const noexcept -> void;
+
+    BlockCache(const BlockCache&) = delete;
+    BlockCache(BlockCache&&) = delete;
+    auto operator=(const BlockCache&) -> BlockCache& = delete;
+    auto operator=(BlockCache&&) -> BlockCache& = delete;
+};
+}  // namespace opentxs::blockchain::node::blockoracle
@@ -12,10 +12,14 @@
 #include <iterator>
 #include <memory>
 
+#include "blockchain/node/blockoracle/BlockCache.hpp"
+#include "internal/api/network/Blockchain.hpp"
 #include "internal/blockchain/database/Database.hpp"
 #include "internal/blockchain/node/Node.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/Mutex.hpp"
+#include "opentxs/api/network/Blockchain.hpp"
+#include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/Types.hpp"
@@ -34,7 +38,6 @@
 
 namespace opentxs::blockchain::node::implementation
 {
-const std::size_t BlockOracle::Cache::cache_limit_{16};
 const std::chrono::seconds BlockOracle::Cache::download_timeout_{60};
 
 BlockOracle::Cache::Cache(
@@ -52,7 +55,7 @@ BlockOracle::Cache::Cache(
     , chain_(chain)
     , lock_()
     , pending_()
-    , mem_(cache_limit_)
+    , mem_(api_.Network().Blockchain().Internal().BlockCache())
     , running_(true)
 {
 }
@@ -126,7 +129,7 @@ auto BlockOracle::Cache::ReceiveBlock(BitcoinBlock_p in) const noexcept -> void
     promise.set_value(std::move(in));
     publish(id);
     LogVerbose()(OT_PRETTY_CLASS())("Cached block ")(id.asHex()).Flush();
-    mem_.push(block::Hash{id}, std::move(future));
+    mem_.Push(chain_, id, std::move(future));
     pending_.erase(pending);
     publish(pending_.size());
 }
@@ -147,8 +150,7 @@ auto BlockOracle::Cache::Request(const BlockHashes& hashes) const noexcept
     auto output = BitcoinBlockFutures{};
     output.reserve(hashes.size());
     auto ready = UnallocatedVector<const block::Hash*>{};
-    auto download =
-        UnallocatedMap<block::Hash, BitcoinBlockFutures::iterator>{};
+    auto load = UnallocatedVector<const block::Hash*>{};
     auto lock = Lock{lock_};
 
     if (false == running_) {
@@ -164,79 +166,101 @@ auto BlockOracle::Cache::Request(const BlockHashes& hashes) const noexcept
     for (const auto& block : hashes) {
         const auto& log = LogTrace();
         const auto start = Clock::now();
-        auto found{false};
 
-        if (auto future = mem_.find(block.Bytes()); future.valid()) {
+        if (auto future = mem_.Find(chain_, block); future.valid()) {
             output.emplace_back(std::move(future));
             ready.emplace_back(&block);
-            found = true;
-        }
-
-        const auto mem = Clock::now();
-
-        if (found) {
             log(OT_PRETTY_CLASS())(" block is cached in memory. Found in ")(
-                std::chrono::nanoseconds{mem - start})
+                std::chrono::nanoseconds{Clock::now() - start})
                 .Flush();
 
             continue;
         }
 
-        {
-            auto it = pending_.find(block);
-
-            if (pending_.end() != it) {
-                const auto& [time, promise, future, queued] = it->second;
-                output.emplace_back(future);
-                found = true;
-            }
-        }
-
-        const auto pending = Clock::now();
-
-        if (found) {
+        if (auto it = pending_.find(block); pending_.end() != it) {
+            const auto& [time, promise, future, queued] = it->second;
+            output.emplace_back(future);
             log(OT_PRETTY_CLASS())(
                 " block is already in download queue. Found in ")(
-                std::chrono::nanoseconds{pending - mem})
+                std::chrono::nanoseconds{Clock::now() - start})
                 .Flush();
 
             continue;
         }
 
-        if (auto pBlock = db_.BlockLoadBitcoin(block); bool(pBlock)) {
+        auto [future, loader] = mem_.StartLoad(chain_, block);
+        output.emplace_back(std::move(future));
+
+        if (loader) { load.emplace_back(&block); }
+    }
+
+    OT_ASSERT(output.size() == hashes.size());
+
+    if (load.empty()) {
+        lock.unlock();
+
+        for (const auto* hash : ready) { publish(*hash); }
+
+        return output;
+    }
+
+    // NOTE other threads requesting the same blocks will find them in the
+    // session block cache and wait on the same future instead of reading them
+    // again
+    lock.unlock();
+    auto loaded =
+        UnallocatedVector<std::pair<const block::Hash*, BitcoinBlock_p>>{};
+    loaded.reserve(load.size());
+
+    for (const auto* hash : load) {
+        const auto start = Clock::now();
+        auto pBlock = db_.BlockLoadBitcoin(*hash);
+
+        if (pBlock) {
             // TODO this should be checked in the block factory function
-            OT_ASSERT(pBlock->ID() == block);
+            OT_ASSERT(pBlock->ID() == *hash);
 
-            auto promise = Promise{};
-            promise.set_value(std::move(pBlock));
-            mem_.push(block::Hash{block}, promise.get_future());
-            output.emplace_back(mem_.find(block.Bytes()));
-            ready.emplace_back(&block);
-            found = true;
+            LogTrace()(OT_PRETTY_CLASS())(
+                " block is already downloaded. Loaded from storage in ")(
+                std::chrono::nanoseconds{Clock::now() - start})
+                .Flush();
         }
 
-        const auto disk = Clock::now();
+        loaded.emplace_back(hash, std::move(pBlock));
+    }
+
+    lock.lock();
+    auto download = UnallocatedVector<const block::Hash*>{};
+
+    for (auto& [hash, pBlock] : loaded) {
+        const auto found = bool(pBlock);
+        auto missing = mem_.FinishLoad(chain_, *hash, std::move(pBlock));
 
         if (found) {
-            log(OT_PRETTY_CLASS())(
-                " block is already downloaded. Loaded from storage in ")(
-                std::chrono::nanoseconds{disk - pending})
-                .Flush();
+            ready.emplace_back(hash);
 
             continue;
         }
 
-        output.emplace_back();
-        auto it = output.begin();
-        std::advance(it, output.size() - 1);
-        download.emplace(block, it);
+        // NOTE Shutdown() already resolved the promise
+        if (false == missing.has_value()) { continue; }
 
-        log(OT_PRETTY_CLASS())(" block queued for download in ")(
-            std::chrono::nanoseconds{Clock::now() - pending})
-            .Flush();
-    }
+        auto& [promise, future] = *missing;
 
-    OT_ASSERT(output.size() == hashes.size());
+        if (false == running_) {
+            promise.set_value(nullptr);
+
+            continue;
+        }
+
+        auto& [time, pPromise, pFuture, queued] = pending_[*hash];
+        time = Clock::now();
+        pPromise = std::move(promise);
+        pFuture = std::move(future);
+        queued = false;
+        download.emplace_back(hash);
+        LogTrace()(OT_PRETTY_CLASS())(" block queued for download").Flush();
+    }
 
     if (0 < download.size()) {
         auto blockList = UnallocatedVector<ReadView>{};
@@ -244,21 +268,14 @@ auto BlockOracle::Cache::Request(const BlockHashes& hashes) const noexcept
             std::begin(download),
             std::end(download),
             std::back_inserter(blockList),
-            [](const auto& in) -> auto {
-                const auto& [key, value] = in;
-
-                return key.Bytes();
-            });
+            [](const auto* hash) { return hash->Bytes(); });
         LogVerbose()(OT_PRETTY_CLASS())("Downloading ")(blockList.size())(
             " blocks from peers")
             .Flush();
         const auto messageSent = node_.RequestBlocks(blockList);
 
-        for (auto& [hash, futureOut] : download) {
-            auto& [time, promise, future, queued] = pending_[hash];
-            time = Clock::now();
-            future = promise.get_future();
-            *futureOut = future;
+        for (const auto* hash : download) {
+            auto& [time, promise, future, queued] = pending_.at(*hash);
             queued = messageSent;
         }
 
@@ -276,7 +293,7 @@ auto BlockOracle::Cache::Shutdown() noexcept -> void
 
     if (running_) {
         running_ = false;
-        mem_.clear();
+        mem_.Clear(chain_);
 
         for (auto& [hash, item] : pending_) {
             auto& [time, promise, future, queued] = item;
@@ -294,6 +311,11 @@ auto BlockOracle::Cache::StateMachine() const noexcept -> bool
 
     if (false == running_) { return false; }
 
+    const auto stats = mem_.Stats();
+    LogVerbose()(OT_PRETTY_CLASS())("block cache contains ")(stats.items_)(
+        " blocks using ")(stats.serialized_bytes_)(" serialized bytes. Hits: ")(
+        stats.hits_)(", misses: ")(stats.misses_)
+        .Flush();
     LogVerbose()(OT_PRETTY_CLASS())(print(chain_))(" download queue contains ")(
         pending_.size())(" blocks.")
         .Flush();
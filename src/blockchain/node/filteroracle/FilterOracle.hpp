@@ -139,6 +139,14 @@ public:
     auto GetFilterJob() const noexcept -> CfilterJob final;
     auto GetHeaderJob() const noexcept -> CfheaderJob final;
     auto Heartbeat() const noexcept -> void final;
+    auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const internal::FilterDatabase::EncodedFilterVisitor& visitor)
+        const noexcept -> std::size_t final
+    {
+        return database_.LoadEncodedFilters(type, blocks, visitor);
+    }
     auto LoadFilter(
         const cfilter::Type type,
         const block::Hash& block,
@@ -277,12 +277,13 @@ auto Account::Imp::index_nym(const identifier::Nym& id) noexcept -> void
 
     log_("Initializing payment code ")(code.asBase58())(" on ")(name_).Flush();
     auto accountID = NotificationStateData::calculate_id(api_, chain_, code);
-    const auto& asio = api_.Network().ZeroMQ().Internal();
-    const auto batchID = asio.PreallocateBatch();
     auto& map = notification_;
 
     if (auto i = map.find(accountID); map.end() != i) { return; }
 
+    const auto& asio = api_.Network().ZeroMQ().Internal();
+    const auto batchID = asio.PreallocateBatch();
+
     auto [it, added] = map.try_emplace(
         std::move(accountID),
         boost::allocate_shared<NotificationStateData>(
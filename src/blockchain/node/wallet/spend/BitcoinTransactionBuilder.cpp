@@ -24,6 +24,7 @@
 
 #include "Proto.hpp"
 #include "internal/api/crypto/Blockchain.hpp"
+#include "internal/api/network/Asio.hpp"
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/Params.hpp"
@@ -35,6 +36,8 @@
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/api/crypto/Blockchain.hpp"
 #include "opentxs/api/crypto/Hash.hpp"  // IWYU pragma: keep
+#include "opentxs/api/network/Asio.hpp"
+#include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Contacts.hpp"
 #include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Factory.hpp"
@@ -429,15 +432,53 @@ struct BitcoinTransactionBuilder::Imp {
 
         for (const auto& key : change_keys_) { api.Release(key); }
     }
-    auto SignInputs() noexcept -> bool
+    auto SignInputs(const bool parallel) noexcept -> bool
     {
-        auto index = int{-1};
-        auto txcopy = Transaction{};
-        auto bip143 = std::optional<bitcoin::Bip143Hashes>{};
+        // NOTE preimages are calculated up front since they depend on state
+        // shared by every input. Once they are known each input can be
+        // signed independently.
+        auto preimages = UnallocatedVector<Space>{};
 
-        for (const auto& [input, value] : inputs_) {
-            if (false == sign_input(++index, *input, txcopy, bip143)) {
-                LogError()(OT_PRETTY_CLASS())("Failed to sign input ")(index)
+        if (false == get_preimages(preimages)) { return false; }
+
+        const auto count = inputs_.size();
+        const auto sigHash = blockchain::bitcoin::SigHash{chain_};
+        // NOTE one slot per input so that no two jobs write to the same
+        // memory location
+        auto results = UnallocatedVector<std::uint8_t>(count, 0u);
+        auto sign = [&](const std::size_t index) {
+            auto& input = *inputs_.at(index).first;
+            const auto& preimage = preimages.at(index);
+            results.at(index) =
+                add_signatures(reader(preimage), sigHash, input);
+        };
+
+        if (parallel && (1u < count)) {
+            auto& asio = api_.Network().Asio().Internal();
+            auto jobs = job_counter_.Allocate();
+
+            for (auto i = std::size_t{0}; i < count; ++i) {
+                jobs.wait_for_ready();
+                ++jobs;
+                const auto queued = asio.Post(ThreadPool::General, [&, i] {
+                    sign(i);
+                    --jobs;
+                });
+
+                if (false == queued) {
+                    --jobs;
+                    sign(i);
+                }
+            }
+
+            jobs.wait_for_finished();
+        } else {
+            for (auto i = std::size_t{0}; i < count; ++i) { sign(i); }
+        }
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            if (0u == results.at(i)) {
+                LogError()(OT_PRETTY_CLASS())("Failed to sign input ")(i)
                     .Flush();
 
                 return false;
@@ -448,7 +489,6 @@ struct BitcoinTransactionBuilder::Imp {
     }
 
     Imp(const api::Session& api,
-        internal::WalletDatabase& db,
         const Identifier& id,
         const Proposal& proposal,
         const Type chain,
@@ -502,6 +542,7 @@ struct BitcoinTransactionBuilder::Imp {
 
             return out;
         }())
+        , job_counter_()
     {
         OT_ASSERT(sender_);
     }
@@ -536,6 +577,7 @@ private:
     Amount output_value_;
     UnallocatedSet<KeyID> change_keys_;
     UnallocatedSet<KeyID> outgoing_keys_;
+    JobCounter job_counter_;
 
     static auto is_segwit(const block::bitcoin::internal::Input& input) noexcept
         -> bool
@@ -867,6 +909,121 @@ private:
         }
         return dust;
     }
+    auto get_preimage(
+        const int index,
+        const block::bitcoin::internal::Input& input,
+        Transaction& txcopy,
+        Bip143& bip143) const noexcept -> Space
+    {
+        switch (chain_) {
+            case Type::BitcoinCash:
+            case Type::BitcoinCash_testnet3: {
+
+                return get_preimage_bch(index, input, bip143);
+            }
+            case Type::Bitcoin:
+            case Type::Bitcoin_testnet3:
+            case Type::Litecoin:
+            case Type::Litecoin_testnet4:
+            case Type::PKT:
+            case Type::PKT_testnet:
+            case Type::UnitTest: {
+                if (is_segwit(input)) {
+
+                    return get_preimage_segwit(index, input, bip143);
+                }
+
+                return get_preimage_btc(index, txcopy);
+            }
+            case Type::Unknown:
+            case Type::Ethereum_frontier:
+            case Type::Ethereum_ropsten:
+            default: {
+                LogError()(OT_PRETTY_CLASS())("Unsupported chain").Flush();
+
+                return {};
+            }
+        }
+    }
+    auto get_preimage_bch(
+        const int index,
+        const block::bitcoin::internal::Input& input,
+        Bip143& bip143) const noexcept -> Space
+    {
+        if (false == init_bip143(bip143)) {
+            LogError()(OT_PRETTY_CLASS())("Error instantiating bip143").Flush();
+
+            return {};
+        }
+
+        const auto sigHash = blockchain::bitcoin::SigHash{chain_};
+
+        return bip143->Preimage(
+            index, outputs_.size(), version_, lock_time_, sigHash, input);
+    }
+    auto get_preimage_btc(const int index, Transaction& txcopy) const noexcept
+        -> Space
+    {
+        if (false == init_txcopy(txcopy)) {
+            LogError()(OT_PRETTY_CLASS())("Error instantiating txcopy").Flush();
+
+            return {};
+        }
+
+        const auto sigHash = blockchain::bitcoin::SigHash{chain_};
+        auto preimage = txcopy->GetPreimageBTC(index, sigHash);
+
+        if (0 == preimage.size()) {
+            LogError()(OT_PRETTY_CLASS())("Error obtaining signing preimage")
+                .Flush();
+
+            return {};
+        }
+
+        std::copy(sigHash.begin(), sigHash.end(), std::back_inserter(preimage));
+
+        return preimage;
+    }
+    auto get_preimage_segwit(
+        const int index,
+        const block::bitcoin::internal::Input& input,
+        Bip143& bip143) const noexcept -> Space
+    {
+        if (false == init_bip143(bip143)) {
+            LogError()(OT_PRETTY_CLASS())("Error instantiating bip143").Flush();
+
+            return {};
+        }
+
+        segwit_ = true;
+        const auto sigHash = blockchain::bitcoin::SigHash{chain_};
+
+        return bip143->Preimage(
+            index, outputs_.size(), version_, lock_time_, sigHash, input);
+    }
+    auto get_preimages(UnallocatedVector<Space>& out) const noexcept -> bool
+    {
+        auto index = int{-1};
+        auto txcopy = Transaction{};
+        auto bip143 = std::optional<bitcoin::Bip143Hashes>{};
+        out.clear();
+        out.reserve(inputs_.size());
+
+        for (const auto& [input, value] : inputs_) {
+            auto& preimage = out.emplace_back(
+                get_preimage(++index, *input, txcopy, bip143));
+
+            if (preimage.empty()) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Failed to calculate preimage for input ")(index)
+                    .Flush();
+
+                return false;
+            }
+        }
+
+        return true;
+    }
     auto get_private_key(
         const opentxs::crypto::key::EllipticCurve& pubkey,
         const blockchain::crypto::Element& element,
@@ -1077,102 +1234,6 @@ private:
     {
         return (bytes() * fee_rate_) / 1000;
     }
-    auto sign_input(
-        const int index,
-        block::bitcoin::internal::Input& input,
-        Transaction& txcopy,
-        Bip143& bip143) const noexcept -> bool
-    {
-        switch (chain_) {
-            case Type::BitcoinCash:
-            case Type::BitcoinCash_testnet3: {
-
-                return sign_input_bch(index, input, bip143);
-            }
-            case Type::Bitcoin:
-            case Type::Bitcoin_testnet3:
-            case Type::Litecoin:
-            case Type::Litecoin_testnet4:
-            case Type::PKT:
-            case Type::PKT_testnet:
-            case Type::UnitTest: {
-                if (is_segwit(input)) {
-
-                    return sign_input_segwit(index, input, bip143);
-                }
-
-                return sign_input_btc(index, input, txcopy);
-            }
-            case Type::Unknown:
-            case Type::Ethereum_frontier:
-            case Type::Ethereum_ropsten:
-            default: {
-                LogError()(OT_PRETTY_CLASS())("Unsupported chain").Flush();
-
-                return false;
-            }
-        }
-    }
-    auto sign_input_bch(
-        const int index,
-        block::bitcoin::internal::Input& input,
-        Bip143& bip143) const noexcept -> bool
-    {
-        if (false == init_bip143(bip143)) {
-            LogError()(OT_PRETTY_CLASS())("Error instantiating bip143").Flush();
-
-            return false;
-        }
-
-        const auto sigHash = blockchain::bitcoin::SigHash{chain_};
-        const auto preimage = bip143->Preimage(
-            index, outputs_.size(), version_, lock_time_, sigHash, input);
-
-        return add_signatures(reader(preimage), sigHash, input);
-    }
-    auto sign_input_btc(
-        const int index,
-        block::bitcoin::internal::Input& input,
-        Transaction& txcopy) const noexcept -> bool
-    {
-        if (false == init_txcopy(txcopy)) {
-            LogError()(OT_PRETTY_CLASS())("Error instantiating txcopy").Flush();
-
-            return false;
-        }
-
-        const auto sigHash = blockchain::bitcoin::SigHash{chain_};
-        auto preimage = txcopy->GetPreimageBTC(index, sigHash);
-
-        if (0 == preimage.size()) {
-            LogError()(OT_PRETTY_CLASS())("Error obtaining signing preimage")
-                .Flush();
-
-            return false;
-        }
-
-        std::copy(sigHash.begin(), sigHash.end(), std::back_inserter(preimage));
-
-        return add_signatures(reader(preimage), sigHash, input);
-    }
-    auto sign_input_segwit(
-        const int index,
-        block::bitcoin::internal::Input& input,
-        Bip143& bip143) const noexcept -> bool
-    {
-        if (false == init_bip143(bip143)) {
-            LogError()(OT_PRETTY_CLASS())("Error instantiating bip143").Flush();
-
-            return false;
-        }
-
-        segwit_ = true;
-        const auto sigHash = blockchain::bitcoin::SigHash{chain_};
-        const auto preimage = bip143->Preimage(
-            index, outputs_.size(), version_, lock_time_, sigHash, input);
-
-        return add_signatures(reader(preimage), sigHash, input);
-    }
     enum class Match : bool { ByValue, ByHash };
     auto validate(
         const Match match,
@@ -1272,12 +1333,11 @@ private:
 
 BitcoinTransactionBuilder::BitcoinTransactionBuilder(
     const api::Session& api,
-    internal::WalletDatabase& db,
     const Identifier& id,
     const Proposal& proposal,
     const Type chain,
     const Amount feeRate) noexcept
-    : imp_(std::make_unique<Imp>(api, db, id, proposal, chain, feeRate))
+    : imp_(std::make_unique<Imp>(api, id, proposal, chain, feeRate))
 {
     OT_ASSERT(imp_);
 }
@@ -1318,9 +1378,10 @@ auto BitcoinTransactionBuilder::ReleaseKeys() noexcept -> void
     return imp_->ReleaseKeys();
 }
 
-auto BitcoinTransactionBuilder::SignInputs() noexcept -> bool
+auto BitcoinTransactionBuilder::SignInputs(const bool parallel) noexcept
+    -> bool
 {
-    return imp_->SignInputs();
+    return imp_->SignInputs(parallel);
 }
 auto BitcoinTransactionBuilder::Spender() const noexcept
     -> const identifier::Nym&
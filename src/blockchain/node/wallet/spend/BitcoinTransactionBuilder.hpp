@@ -75,14 +75,6 @@ struct Transaction;
 class Output;
 }  // namespace bitcoin
 }  // namespace block
-
-namespace node
-{
-namespace internal
-{
-struct WalletDatabase;
-}  // namespace internal
-}  // namespace node
 }  // namespace blockchain
 
 namespace identifier
@@ -117,11 +109,12 @@ public:
     auto FinalizeOutputs() noexcept -> void;
     auto FinalizeTransaction() noexcept -> Transaction;
     auto ReleaseKeys() noexcept -> void;
-    auto SignInputs() noexcept -> bool;
+    // Inputs are signed concurrently on the general thread pool unless
+    // parallel is false. The result is identical either way.
+    auto SignInputs(const bool parallel = true) noexcept -> bool;
 
     BitcoinTransactionBuilder(
         const api::Session& api,
-        node::internal::WalletDatabase& db,
         const Identifier& id,
         const Proposal& proposal,
         const Type chain,
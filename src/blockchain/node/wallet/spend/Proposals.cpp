@@ -7,7 +7,9 @@
 #include "1_Internal.hpp"  // IWYU pragma: associated
 #include "blockchain/node/wallet/spend/Proposals.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <mutex>
@@ -38,6 +40,7 @@
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Options.hpp"
 #include "opentxs/util/Pimpl.hpp"
 #include "opentxs/util/Time.hpp"
 #include "opentxs/util/Types.hpp"
@@ -82,15 +85,31 @@ public:
         , node_(node)
         , db_(db)
         , chain_(chain)
+        , batch_window_(api_.GetOptions().BlockchainSpendBatchWindow())
+        , batch_outputs_(api_.GetOptions().BlockchainSpendBatchOutputs())
         , lock_()
         , pending_(api_)
         , confirming_()
+        , batch_start_()
+        , batched_()
+        , unbatched_()
     {
+        // NOTE proposals which were combined into a batch share the same
+        // finished transaction
+        auto batches = UnallocatedMap<UnallocatedCString, OTIdentifier>{};
+
         for (const auto& serialized : db_.LoadProposals()) {
             auto id = api_.Factory().Identifier(serialized.id());
 
             if (serialized.has_finished()) {
-                confirming_.emplace(std::move(id), Time{});
+                const auto& txid = serialized.finished().txid();
+
+                if (auto i = batches.find(txid); batches.end() != i) {
+                    batched_.emplace(std::move(id), i->second);
+                } else {
+                    batches.emplace(txid, id);
+                    confirming_.emplace(std::move(id), Time{});
+                }
             } else {
                 pending_.Add(std::move(id), {});
             }
@@ -110,6 +129,7 @@ private:
         std::promise<SendOutcome>&)>;
     using Promise = std::promise<SendOutcome>;
     using Data = std::pair<OTIdentifier, Promise>;
+    using Batch = UnallocatedVector<std::pair<OTIdentifier, Proposal>>;
 
     struct Pending {
         auto Exists(const Identifier& id) const noexcept -> bool
@@ -124,6 +144,16 @@ private:
 
             return 0 < data_.size();
         }
+        auto IDs() const noexcept -> UnallocatedVector<OTIdentifier>
+        {
+            auto lock = Lock{lock_};
+            auto output = UnallocatedVector<OTIdentifier>{};
+            output.reserve(data_.size());
+
+            for (const auto& [id, promise] : data_) { output.emplace_back(id); }
+
+            return output;
+        }
 
         auto Add(
             OTIdentifier&& id,
@@ -171,10 +201,31 @@ private:
         auto Pop() noexcept -> Data
         {
             auto lock = Lock{lock_};
-            auto post = ScopeGuard{[&] { data_.pop_front(); }};
+            auto post = ScopeGuard{[&] {
+                ids_.erase(data_.front().first);
+                data_.pop_front();
+            }};
 
             return std::move(data_.front());
         }
+        auto Take(const Identifier& id) noexcept -> Data
+        {
+            auto lock = Lock{lock_};
+            const auto copy = OTIdentifier{id};
+            auto i = std::find_if(
+                data_.begin(), data_.end(), [&](const auto& item) {
+                    return item.first == copy;
+                });
+
+            OT_ASSERT(data_.end() != i);
+
+            auto post = ScopeGuard{[&] {
+                ids_.erase(i->first);
+                data_.erase(i);
+            }};
+
+            return std::move(*i);
+        }
 
         Pending(const api::Session& api) noexcept
             : api_(api)
@@ -195,14 +246,57 @@ private:
     const node::internal::Network& node_;
     node::internal::WalletDatabase& db_;
     const Type chain_;
+    const std::chrono::milliseconds batch_window_;
+    const std::size_t batch_outputs_;
     mutable std::mutex lock_;
     mutable Pending pending_;
     mutable UnallocatedMap<OTIdentifier, Time> confirming_;
+    std::optional<Time> batch_start_;
+    // Maps each proposal which was sent as part of a batch to the proposal
+    // which is tracking the batch transaction
+    UnallocatedMap<OTIdentifier, OTIdentifier> batched_;
+    // Members of failed batches which must be sent individually
+    UnallocatedSet<OTIdentifier> unbatched_;
 
     static auto is_expired(const Proposal& tx) noexcept -> bool
     {
         return Clock::now() > Clock::from_time_t(tx.expires());
     }
+    // Combines the outputs of several proposals into a single proposal
+    static auto merge(const Identifier& id, const Batch& batch) noexcept
+        -> Proposal
+    {
+        OT_ASSERT(0 < batch.size());
+
+        const auto& first = batch.front().second;
+        auto output = Proposal{};
+        output.set_version(first.version());
+        output.set_id(id.str());
+        output.set_initiator(first.initiator());
+        output.set_expires(first.expires());
+        auto memo = std::optional<UnallocatedCString>{first.memo()};
+
+        for (const auto& [member, proposal] : batch) {
+            output.set_expires(std::min(output.expires(), proposal.expires()));
+
+            if (memo.has_value() && (memo.value() != proposal.memo())) {
+                memo.reset();
+            }
+
+            for (const auto& out : proposal.output()) {
+                *output.add_output() = out;
+            }
+        }
+
+        if (memo.has_value()) { output.set_memo(memo.value()); }
+
+        return output;
+    }
+
+    auto batching() const noexcept -> bool
+    {
+        return std::chrono::milliseconds{0} < batch_window_;
+    }
 
     auto build_transaction_bitcoin(
         const Identifier& id,
@@ -214,7 +308,7 @@ private:
         auto rc = SendResult::UnspecifiedError;
         auto txid{blank};
         auto builder = BitcoinTransactionBuilder{
-            api_, db_, id, proposal, chain_, node_.FeeRate()};
+            api_, id, proposal, chain_, node_.FeeRate()};
         auto post = ScopeGuard{[&] {
             switch (output) {
                 case BuildResult::TemporaryFailure: {
@@ -374,10 +468,43 @@ private:
     auto cleanup(const Lock& lock) noexcept -> void
     {
         const auto finished = db_.CompletedProposals();
+        auto members = UnallocatedSet<OTIdentifier>{};
+
+        for (const auto& id : finished) {
+            const auto batch = [&] {
+                if (auto i = batched_.find(id); batched_.end() != i) {
+
+                    return i->second;
+                }
+
+                return OTIdentifier{id};
+            }();
+
+            if (0 == finished.count(batch)) { members.emplace(batch); }
+
+            for (auto i = batched_.begin(); i != batched_.end();) {
+                if (i->second == batch) {
+                    if (0 == finished.count(i->first)) {
+                        members.emplace(i->first);
+                    }
+
+                    i = batched_.erase(i);
+                } else {
+                    ++i;
+                }
+            }
+        }
+
+        for (const auto& id : members) {
+            db_.DeleteProposal(id);
+            pending_.Delete(id);
+            confirming_.erase(id);
+        }
 
         for (const auto& id : finished) {
             pending_.Delete(id);
             confirming_.erase(id);
+            unbatched_.erase(id);
         }
 
         db_.ForgetProposals(finished);
@@ -436,7 +563,14 @@ private:
     {
         if (false == pending_.HasData()) { return; }
 
-        auto job = pending_.Pop();
+        if (batching()) {
+            send_batch(lock);
+        } else {
+            send(lock, pending_.Pop());
+        }
+    }
+    auto send(const Lock& lock, Data&& job) noexcept -> void
+    {
         auto& [id, promise] = job;
         auto wipe{false};
         auto erase{false};
@@ -448,7 +582,11 @@ private:
                 erase = true;
             }
 
-            if (false == erase) { pending_.Add(std::move(job)); }
+            if (erase) {
+                unbatched_.erase(id);
+            } else {
+                pending_.Add(std::move(job));
+            }
         }};
         auto serialized = db_.LoadProposal(id);
 
@@ -480,6 +618,125 @@ private:
             }
         }
     }
+    // Collects pending proposals into a batch and sends it once either the
+    // batch window has elapsed or the batch has reached the maximum number of
+    // outputs. Proposals which can not be batched are sent individually.
+    auto send_batch(const Lock& lock) noexcept -> void
+    {
+        auto batch = Batch{};
+        auto outputs = std::size_t{0};
+
+        for (const auto& id : pending_.IDs()) {
+            auto serialized = db_.LoadProposal(id);
+            const auto batchable = serialized.has_value() &&
+                                   (0 == unbatched_.count(id)) &&
+                                   (0 == serialized->notification_size()) &&
+                                   (false == is_expired(*serialized));
+
+            if (false == batchable) {
+                send(lock, pending_.Take(id));
+
+                continue;
+            }
+
+            const auto& proposal = *serialized;
+            const auto count = static_cast<std::size_t>(proposal.output_size());
+
+            if (0 < batch.size()) {
+                const auto& first = batch.front().second;
+
+                if (first.initiator() != proposal.initiator()) { continue; }
+
+                if ((outputs + count) > batch_outputs_) { continue; }
+            }
+
+            outputs += count;
+            batch.emplace_back(id, std::move(*serialized));
+        }
+
+        if (0 == batch.size()) {
+            batch_start_.reset();
+
+            return;
+        }
+
+        const auto now = Clock::now();
+
+        if (false == batch_start_.has_value()) { batch_start_ = now; }
+
+        const auto full = outputs >= batch_outputs_;
+        const auto waited = (now - batch_start_.value()) >= batch_window_;
+
+        if ((false == full) && (false == waited)) { return; }
+
+        batch_start_.reset();
+
+        if (1 == batch.size()) {
+            send(lock, pending_.Take(batch.front().first));
+        } else {
+            send_batch(lock, batch);
+        }
+    }
+    auto send_batch(const Lock& lock, Batch& batch) noexcept -> void
+    {
+        const auto id = [&] {
+            auto out = api_.Factory().Identifier();
+            out->Randomize();
+
+            return out;
+        }();
+        auto proposal = merge(id, batch);
+        auto promise = Promise{};
+        auto future = promise.get_future();
+        const auto result = [&] {
+            if (false == db_.AddProposal(id, proposal)) {
+                LogError()(OT_PRETTY_CLASS())("Database error (batch)").Flush();
+
+                return BuildResult::PermanentFailure;
+            }
+
+            if (auto builder = get_builder(); builder) {
+
+                return builder(id, proposal, promise);
+            }
+
+            return BuildResult::PermanentFailure;
+        }();
+
+        if (BuildResult::Success != result) {
+            LogError()(OT_PRETTY_CLASS())("Failed to send batch of ")(
+                batch.size())(" proposals. Sending them individually.")
+                .Flush();
+            // NOTE releases any outputs which were reserved for the batch
+            db_.CancelProposal(id);
+
+            for (const auto& [member, data] : batch) {
+                unbatched_.emplace(member);
+            }
+
+            return;
+        }
+
+        const auto [rc, txid] = future.get();
+        LogVerbose()(OT_PRETTY_CLASS())("sent ")(batch.size())(
+            " proposals in transaction ")(txid->asHex())
+            .Flush();
+
+        for (auto& [member, data] : batch) {
+            auto job = pending_.Take(member);
+            *data.mutable_finished() = proposal.finished();
+
+            if (false == db_.AddProposal(member, data)) {
+                LogError()(OT_PRETTY_CLASS())("Database error (proposal)")
+                    .Flush();
+            }
+
+            job.second.set_value({rc, txid});
+            batched_.emplace(member, id);
+        }
+
+        confirming_.emplace(id, Clock::now());
+    }
 };
 
 Proposals::Proposals(
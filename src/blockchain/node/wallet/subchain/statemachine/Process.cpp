@@ -135,12 +135,22 @@ auto Process::Imp::do_process(
 
 auto Process::Imp::do_startup() noexcept -> void
 {
+    using Mempool = node::internal::Mempool;
     const auto& oracle = parent_.mempool_oracle_;
+    auto position = Mempool::Cursor{0};
 
-    for (const auto& txid : oracle.Dump()) {
-        if (auto tx = oracle.Query(txid); tx) {
-            parent_.ProcessTransaction(*tx);
+    while (true) {
+        const auto [txids, next] = oracle.Dump(position, Mempool::dump_batch_);
+
+        if (txids.empty()) { break; }
+
+        for (const auto& txid : txids) {
+            if (auto tx = oracle.Query(txid); tx) {
+                parent_.ProcessTransaction(*tx);
+            }
         }
+
+        position = next;
     }
 
     do_work();
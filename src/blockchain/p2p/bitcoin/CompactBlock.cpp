@@ -0,0 +1,514 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                             // IWYU pragma: associated
+#include "1_Internal.hpp"                           // IWYU pragma: associated
+#include "blockchain/p2p/bitcoin/CompactBlock.hpp"  // IWYU pragma: associated
+
+#include <boost/endian/buffers.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "internal/blockchain/Params.hpp"
+#include "internal/blockchain/bitcoin/Bitcoin.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/Session.hpp"
+#include "opentxs/blockchain/block/Header.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Header.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/crypto/HashType.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs::blockchain::p2p::bitcoin
+{
+namespace be = boost::endian;
+namespace bb = opentxs::network::blockchain::bitcoin;
+using EncodedTransaction = blockchain::bitcoin::EncodedTransaction;
+
+CompactBlock::CompactBlock(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const std::uint64_t version,
+    const ReadView payload) noexcept(false)
+    : api_(api)
+    , chain_(chain)
+    , witness_(1u < version)
+    , header_()
+    , hash_()
+    , key_()
+    , transactions_()
+    , positions_()
+    , ambiguous_()
+    , prefilled_(0)
+    , from_candidates_(0)
+    , missing_(0)
+{
+    if (false == valid(payload)) { throw std::runtime_error{"empty payload"}; }
+
+    const auto total = payload.size();
+    auto it = reinterpret_cast<bb::ByteIterator>(payload.data());
+    auto expected = header_bytes_ + sizeof(be::little_uint64_buf_t);
+
+    if (total < expected) {
+        throw std::runtime_error{"payload too short (header)"};
+    }
+
+    header_ = space(ReadView{payload.data(), header_bytes_});
+
+    {
+        const auto pHeader =
+            factory::BitcoinBlockHeader(api_, chain_, reader(header_));
+
+        if (false == bool(pHeader)) {
+            throw std::runtime_error{"invalid block header"};
+        }
+
+        hash_ = pHeader->Hash();
+    }
+
+    std::advance(it, header_bytes_);
+    auto nonce = be::little_uint64_buf_t{};
+    std::memcpy(static_cast<void*>(&nonce), it, sizeof(nonce));
+    std::advance(it, sizeof(nonce));
+    key_ = calculate_key(api_, reader(header_), nonce.value());
+    auto idCount = std::size_t{};
+    expected += 1u;
+
+    if (false == bb::DecodeSize(it, expected, total, idCount)) {
+        throw std::runtime_error{"failed to decode short ID count"};
+    }
+
+    if (((total - expected) / short_id_bytes_) < idCount) {
+        throw std::runtime_error{"payload too short (short IDs)"};
+    }
+
+    auto ids = UnallocatedVector<ShortID>{};
+    ids.reserve(idCount);
+
+    for (auto i = std::size_t{0}; i < idCount; ++i) {
+        auto id = ShortID{0};
+
+        for (auto j = std::size_t{0}; j < short_id_bytes_; ++j) {
+            id |= std::to_integer<ShortID>(*it) << (8u * j);
+            std::advance(it, 1);
+        }
+
+        expected += short_id_bytes_;
+        ids.emplace_back(id);
+    }
+
+    auto prefilledCount = std::size_t{};
+    expected += 1u;
+
+    if (false == bb::DecodeSize(it, expected, total, prefilledCount)) {
+        throw std::runtime_error{"failed to decode prefilled count"};
+    }
+
+    // Every prefilled transaction occupies at least two bytes
+    if (((total - expected) / 2u) < prefilledCount) {
+        throw std::runtime_error{"payload too short (prefilled)"};
+    }
+
+    const auto txCount = idCount + prefilledCount;
+    transactions_.resize(txCount);
+    auto next = std::size_t{0};
+
+    for (auto i = std::size_t{0}; i < prefilledCount; ++i) {
+        auto offset = std::size_t{};
+        expected += 1u;
+
+        if (false == bb::DecodeSize(it, expected, total, offset)) {
+            throw std::runtime_error{"failed to decode prefilled index"};
+        }
+
+        if ((txCount - next) <= offset) {
+            throw std::runtime_error{"prefilled index out of range"};
+        }
+
+        const auto position = next + offset;
+        const auto data = EncodedTransaction::Deserialize(
+            api_,
+            chain_,
+            ReadView{reinterpret_cast<const char*>(it), total - expected});
+        const auto bytes = data.size();
+        transactions_.at(position) =
+            space(ReadView{reinterpret_cast<const char*>(it), bytes});
+        std::advance(it, bytes);
+        expected += bytes;
+        next = position + 1u;
+        ++prefilled_;
+    }
+
+    if (expected != total) { throw std::runtime_error{"trailing bytes"}; }
+
+    auto id = ids.begin();
+
+    for (auto i = std::size_t{0}; i < txCount; ++i) {
+        if (false == transactions_.at(i).empty()) { continue; }
+
+        OT_ASSERT(ids.end() != id);
+
+        if (false == positions_.try_emplace(*id, i).second) {
+            throw std::runtime_error{"short ID collision"};
+        }
+
+        ++id;
+        ++missing_;
+    }
+}
+
+auto CompactBlock::AddCandidates(const Candidates& transactions) noexcept
+    -> std::size_t
+{
+    const auto start = from_candidates_;
+
+    for (const auto& pTx : transactions) {
+        if (false == bool(pTx)) { continue; }
+
+        const auto& tx = *pTx;
+        const auto& id = witness_ ? tx.WTXID() : tx.ID();
+        const auto match = positions_.find(CalculateShortID(id.Bytes()));
+
+        if (positions_.end() == match) { continue; }
+
+        const auto position = match->second;
+
+        if (0u < ambiguous_.count(position)) { continue; }
+
+        auto bytes = Space{};
+
+        if (false == tx.Internal().Serialize(writer(bytes)).has_value()) {
+            LogError()(OT_PRETTY_CLASS())("failed to serialize transaction")
+                .Flush();
+
+            continue;
+        }
+
+        auto& slot = transactions_.at(position);
+
+        if (slot.empty()) {
+            slot = std::move(bytes);
+            ++from_candidates_;
+            --missing_;
+        } else if (slot != bytes) {
+            // Two different transactions share this short ID so neither one
+            // can be trusted
+            slot.clear();
+            ambiguous_.emplace(position);
+            --from_candidates_;
+            ++missing_;
+        }
+    }
+
+    return (from_candidates_ > start) ? (from_candidates_ - start) : 0u;
+}
+
+auto CompactBlock::AddTransactions(const ReadView blocktxn) noexcept -> bool
+{
+    try {
+        if (false == valid(blocktxn)) {
+            throw std::runtime_error{"empty payload"};
+        }
+
+        const auto total = blocktxn.size();
+        const auto hashBytes = hash_.size();
+        auto it = reinterpret_cast<bb::ByteIterator>(blocktxn.data());
+        auto expected = hashBytes;
+
+        if (total < expected) {
+            throw std::runtime_error{"payload too short (block hash)"};
+        }
+
+        if (0 != std::memcmp(it, hash_.data(), hashBytes)) {
+            throw std::runtime_error{"wrong block hash"};
+        }
+
+        std::advance(it, hashBytes);
+        auto count = std::size_t{};
+        expected += 1u;
+
+        if (false == bb::DecodeSize(it, expected, total, count)) {
+            throw std::runtime_error{"failed to decode transaction count"};
+        }
+
+        const auto positions = Missing();
+
+        if (positions.size() != count) {
+            throw std::runtime_error{"wrong transaction count"};
+        }
+
+        auto received = UnallocatedVector<Space>{};
+        received.reserve(count);
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto data = EncodedTransaction::Deserialize(
+                api_,
+                chain_,
+                ReadView{reinterpret_cast<const char*>(it), total - expected});
+            const auto bytes = data.size();
+            received.emplace_back(
+                space(ReadView{reinterpret_cast<const char*>(it), bytes}));
+            std::advance(it, bytes);
+            expected += bytes;
+        }
+
+        if (expected != total) { throw std::runtime_error{"trailing bytes"}; }
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            transactions_.at(positions.at(i)) = std::move(received.at(i));
+        }
+
+        missing_ = 0u;
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto CompactBlock::calculate_key(
+    const api::Session& api,
+    const ReadView header,
+    const std::uint64_t nonce) noexcept(false) -> Space
+{
+    static constexpr auto key_bytes = std::size_t{16};
+    const auto encodedNonce = be::little_uint64_buf_t{nonce};
+    auto preimage = space(header);
+    const auto* n = reinterpret_cast<const std::byte*>(&encodedNonce);
+    preimage.insert(preimage.end(), n, std::next(n, sizeof(encodedNonce)));
+    auto output = Space{};
+
+    if (false == api.Crypto().Hash().Digest(
+                     opentxs::crypto::HashType::Sha256,
+                     reader(preimage),
+                     writer(output))) {
+        throw std::runtime_error{"failed to calculate short ID key"};
+    }
+
+    output.resize(key_bytes);
+
+    return output;
+}
+
+auto CompactBlock::calculate_short_id(
+    const api::Session& api,
+    const ReadView key,
+    const ReadView id) noexcept -> ShortID
+{
+    auto hash = std::array<std::byte, sizeof(ShortID)>{};
+    const auto hashed = api.Crypto().Hash().HMAC(
+        opentxs::crypto::HashType::SipHash24,
+        key,
+        id,
+        preallocated(hash.size(), hash.data()));
+
+    OT_ASSERT(hashed);
+
+    auto output = ShortID{0};
+
+    for (auto i = std::size_t{0}; i < short_id_bytes_; ++i) {
+        output |= std::to_integer<ShortID>(hash.at(i)) << (8u * i);
+    }
+
+    return output;
+}
+
+auto CompactBlock::CalculateShortID(const ReadView id) const noexcept
+    -> ShortID
+{
+    return calculate_short_id(api_, reader(key_), id);
+}
+
+auto CompactBlock::Encode(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const std::uint64_t version,
+    const std::uint64_t nonce,
+    const block::bitcoin::Block& block,
+    const AllocateOutput out) noexcept -> bool
+{
+    try {
+        if ((0u == version) || (version > SupportedVersion(chain))) {
+            throw std::runtime_error{"unsupported version"};
+        }
+
+        const auto count = block.size();
+
+        if (0u == count) { throw std::runtime_error{"empty block"}; }
+
+        auto output = Space{};
+
+        if (false == block.Header().Serialize(writer(output))) {
+            throw std::runtime_error{"failed to serialize header"};
+        }
+
+        if (header_bytes_ != output.size()) {
+            throw std::runtime_error{"unsupported header format"};
+        }
+
+        const auto key = calculate_key(api, reader(output), nonce);
+        const auto witness = 1u < version;
+        const auto append = [&](const auto* data, std::size_t size) {
+            const auto* i = reinterpret_cast<const std::byte*>(data);
+            output.insert(output.end(), i, std::next(i, size));
+        };
+        const auto encodedNonce = be::little_uint64_buf_t{nonce};
+        append(&encodedNonce, sizeof(encodedNonce));
+        const auto idCount = bb::CompactSize{count - 1u}.Encode();
+        append(idCount.data(), idCount.size());
+
+        for (auto i = std::size_t{1}; i < count; ++i) {
+            const auto& pTx = block.at(i);
+
+            if (false == bool(pTx)) {
+                throw std::runtime_error{"missing transaction"};
+            }
+
+            const auto& id = witness ? pTx->WTXID() : pTx->ID();
+            const auto shortID = be::little_uint64_buf_t{
+                calculate_short_id(api, reader(key), id.Bytes())};
+            append(&shortID, short_id_bytes_);
+        }
+
+        // Prefill only the generation transaction, at differential index 0
+        const auto prefilled = bb::CompactSize{1u}.Encode();
+        append(prefilled.data(), prefilled.size());
+        output.emplace_back(std::byte{0x0});
+        const auto& pGeneration = block.at(0u);
+
+        if ((false == bool(pGeneration)) ||
+            (false == pGeneration->Internal()
+                          .Serialize([&](const auto size) {
+                              const auto start = output.size();
+                              output.resize(start + size);
+
+                              return WritableView{
+                                  std::next(output.data(), start), size};
+                          })
+                          .has_value())) {
+            throw std::runtime_error{"failed to serialize generation"};
+        }
+
+        return copy(reader(output), out);
+    } catch (const std::exception& e) {
+        LogError()("opentxs::blockchain::p2p::bitcoin::CompactBlock::")(
+            __func__)(": ")(e.what())
+            .Flush();
+
+        return false;
+    }
+}
+
+auto CompactBlock::EncodeTransactions(
+    const block::bitcoin::Block& block,
+    const Indices& positions,
+    const AllocateOutput out) noexcept -> bool
+{
+    try {
+        const auto& hash = block.ID();
+        auto output = space(hash.Bytes());
+        const auto count = bb::CompactSize{positions.size()}.Encode();
+        output.insert(output.end(), count.begin(), count.end());
+
+        for (const auto position : positions) {
+            if (position >= block.size()) {
+                throw std::runtime_error{"position out of range"};
+            }
+
+            const auto& pTx = block.at(position);
+            const auto serialized = [&] {
+                auto tx = Space{};
+
+                if ((false == bool(pTx)) ||
+                    (false ==
+                     pTx->Internal().Serialize(writer(tx)).has_value())) {
+                    throw std::runtime_error{"failed to serialize transaction"};
+                }
+
+                return tx;
+            }();
+            output.insert(output.end(), serialized.begin(), serialized.end());
+        }
+
+        return copy(reader(output), out);
+    } catch (const std::exception& e) {
+        LogError()("opentxs::blockchain::p2p::bitcoin::CompactBlock::")(
+            __func__)(": ")(e.what())
+            .Flush();
+
+        return false;
+    }
+}
+
+auto CompactBlock::Missing() const noexcept -> Indices
+{
+    auto output = Indices{};
+    output.reserve(missing_);
+
+    for (auto i = std::size_t{0}; i < transactions_.size(); ++i) {
+        if (transactions_.at(i).empty()) { output.emplace_back(i); }
+    }
+
+    return output;
+}
+
+auto CompactBlock::Serialize(const AllocateOutput out) const noexcept -> bool
+{
+    if (false == IsComplete()) {
+        LogError()(OT_PRETTY_CLASS())("block is incomplete").Flush();
+
+        return false;
+    }
+
+    auto output = Space{header_};
+    const auto count = bb::CompactSize{transactions_.size()}.Encode();
+    output.insert(output.end(), count.begin(), count.end());
+
+    for (const auto& tx : transactions_) {
+        output.insert(output.end(), tx.begin(), tx.end());
+    }
+
+    return copy(reader(output), out);
+}
+
+auto CompactBlock::SupportedVersion(const blockchain::Type chain) noexcept
+    -> std::uint64_t
+{
+    switch (chain) {
+        // PacketCrypt proofs follow the header so the HeaderAndShortIDs
+        // encoding can not represent these blocks
+        case blockchain::Type::PKT:
+        case blockchain::Type::PKT_testnet: {
+
+            return 0u;
+        }
+        default: {
+        }
+    }
+
+    try {
+        const auto& data = params::Data::Chains().at(chain);
+
+        return data.segwit_ ? 2u : 1u;
+    } catch (...) {
+
+        return 0u;
+    }
+}
+
+CompactBlock::~CompactBlock() = default;
+}  // namespace opentxs::blockchain::p2p::bitcoin
@@ -0,0 +1,142 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace api
+{
+class Session;
+}  // namespace api
+
+namespace blockchain
+{
+namespace block
+{
+namespace bitcoin
+{
+class Block;
+class Transaction;
+}  // namespace bitcoin
+}  // namespace block
+}  // namespace blockchain
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::blockchain::p2p::bitcoin
+{
+// BIP-152 HeaderAndShortIDs which is being turned back into a full block.
+//
+// Positions are filled first from candidate (mempool) transactions whose
+// short ID matches and then from a BlockTransactions payload answering a
+// getblocktxn request for whatever is still missing. A short ID which
+// matches more than one candidate leaves its position missing so that the
+// transaction will be requested from the peer instead.
+class CompactBlock
+{
+public:
+    using ShortID = std::uint64_t;
+    using Indices = UnallocatedVector<std::size_t>;
+    using Candidates =
+        UnallocatedVector<std::shared_ptr<const block::bitcoin::Transaction>>;
+
+    // Returns the HeaderAndShortIDs encoding of a block with only the
+    // generation transaction prefilled
+    static auto Encode(
+        const api::Session& api,
+        const blockchain::Type chain,
+        const std::uint64_t version,
+        const std::uint64_t nonce,
+        const block::bitcoin::Block& block,
+        const AllocateOutput out) noexcept -> bool;
+    // Returns the BlockTransactions encoding of the transactions at the
+    // specified positions
+    static auto EncodeTransactions(
+        const block::bitcoin::Block& block,
+        const Indices& positions,
+        const AllocateOutput out) noexcept -> bool;
+    // Returns the highest compact block version this implementation supports
+    // for the specified chain, or zero if compact blocks can not be used
+    static auto SupportedVersion(const blockchain::Type chain) noexcept
+        -> std::uint64_t;
+
+    auto CalculateShortID(const ReadView id) const noexcept -> ShortID;
+    // Number of positions filled from candidate transactions
+    auto FromCandidates() const noexcept -> std::size_t
+    {
+        return from_candidates_;
+    }
+    auto Hash() const noexcept -> const block::Hash& { return hash_; }
+    auto IsComplete() const noexcept -> bool { return 0u == missing_; }
+    auto Missing() const noexcept -> Indices;
+    // Number of transactions which were included in the compact block
+    auto Prefilled() const noexcept -> std::size_t { return prefilled_; }
+    auto Serialize(const AllocateOutput out) const noexcept -> bool;
+    auto size() const noexcept -> std::size_t { return transactions_.size(); }
+
+    auto AddCandidates(const Candidates& transactions) noexcept -> std::size_t;
+    // Fills every missing position, in order, from a BlockTransactions
+    // payload. Returns false if the payload is not a complete answer to a
+    // request for the positions returned by Missing().
+    auto AddTransactions(const ReadView blocktxn) noexcept -> bool;
+
+    // Throws std::runtime_error if the payload is malformed or if two
+    // transactions in the block have the same short ID
+    CompactBlock(
+        const api::Session& api,
+        const blockchain::Type chain,
+        const std::uint64_t version,
+        const ReadView payload) noexcept(false);
+    CompactBlock() = delete;
+    CompactBlock(const CompactBlock&) = delete;
+    CompactBlock(CompactBlock&&) = delete;
+    auto operator=(const CompactBlock&) -> CompactBlock& = delete;
+    auto operator=(CompactBlock&&) -> CompactBlock& = delete;
+
+    ~CompactBlock();
+
+private:
+    using Positions = UnallocatedMap<ShortID, std::size_t>;
+
+    static constexpr auto header_bytes_ = std::size_t{80};
+    static constexpr auto short_id_bytes_ = std::size_t{6};
+
+    const api::Session& api_;
+    const blockchain::Type chain_;
+    const bool witness_;
+    Space header_;
+    block::Hash hash_;
+    Space key_;
+    UnallocatedVector<Space> transactions_;
+    Positions positions_;
+    UnallocatedSet<std::size_t> ambiguous_;
+    std::size_t prefilled_;
+    std::size_t from_candidates_;
+    std::size_t missing_;
+
+    static auto calculate_key(
+        const api::Session& api,
+        const ReadView header,
+        const std::uint64_t nonce) noexcept(false) -> Space;
+    static auto calculate_short_id(
+        const api::Session& api,
+        const ReadView key,
+        const ReadView id) noexcept -> ShortID;
+};
+}  // namespace opentxs::blockchain::p2p::bitcoin
@@ -35,6 +35,7 @@
 #include "internal/blockchain/p2p/P2P.hpp"
 #include "internal/blockchain/p2p/bitcoin/Factory.hpp"
 #include "internal/blockchain/p2p/bitcoin/message/Message.hpp"
+#include "internal/network/zeromq/message/Message.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/api/crypto/Util.hpp"
@@ -210,6 +211,11 @@ Peer::Peer(
           get_local_services(protocol_, chain_, policy, localServices))
     , relay_(relay)
     , get_headers_()
+    , compact_version_(0)
+    , compact_blocks_()
+    , compact_order_()
+    , compact_candidates_()
+    , compact_stats_()
 {
     init();
 }
@@ -312,6 +318,61 @@ auto Peer::broadcast_transaction(zmq::Message&& in) noexcept -> void
     send(msg.Transmit());
 }
 
+auto Peer::finish_compact_block(
+    PendingCompactBlock&& pending,
+    const bool requested) noexcept -> void
+{
+    auto& stats = compact_stats_;
+    const auto& compact = *pending.first;
+    const auto received = pending.second;
+    auto bytes = Space{};
+
+    try {
+        if (false == compact.Serialize(writer(bytes))) {
+            throw std::runtime_error("Failed to serialize block");
+        }
+
+        // Validation catches a reconstruction which used the wrong
+        // transaction for a short ID since the merkle root will not match
+        submit_block(
+            api_.Factory().BitcoinBlock(chain_, reader(bytes)), reader(bytes));
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+        ++stats.failed_;
+        request_full_block(compact.Hash());
+
+        return;
+    }
+
+    if (requested) {
+        ++stats.requested_;
+    } else {
+        ++stats.reconstructed_;
+    }
+
+    stats.compact_bytes_ += received;
+    stats.block_bytes_ += bytes.size();
+    const auto saved = (stats.block_bytes_ > stats.compact_bytes_)
+                           ? (stats.block_bytes_ - stats.compact_bytes_)
+                           : std::size_t{0};
+    log_(OT_PRETTY_CLASS())("reconstructed block ")(compact.Hash().asHex())(
+        " using ")(received)(" of ")(bytes.size())(" bytes. ")(
+        stats.received_)(" compact blocks received from ")(
+        address_.Display())(": ")(stats.reconstructed_)(
+        " reconstructed from mempool, ")(stats.requested_)(
+        " after getblocktxn, ")(stats.failed_)(" failed, ")(saved)(
+        " bytes saved")
+        .Flush();
+}
+
+auto Peer::forget_compact_block(const block::Hash& hash) noexcept -> void
+{
+    compact_blocks_.erase(hash);
+    compact_order_.erase(
+        std::remove(compact_order_.begin(), compact_order_.end(), hash),
+        compact_order_.end());
+}
+
 auto Peer::get_body_size(const zmq::Frame& header) const noexcept -> std::size_t
 {
     OT_ASSERT(HeaderType::Size() == header.size());
@@ -372,6 +433,46 @@ auto Peer::get_local_services(
     return output;
 }
 
+auto Peer::mempool_candidates() noexcept -> CompactBlock::Candidates
+{
+    using Mempool = node::internal::Mempool;
+    auto& [position, cached] = compact_candidates_;
+
+    while (true) {
+        const auto [txids, next] =
+            mempool_.Dump(position, Mempool::dump_batch_);
+
+        if (txids.empty()) { break; }
+
+        for (const auto& txid : txids) {
+            if (auto tx = mempool_.Query(txid); tx) {
+                cached.emplace_back(std::move(tx));
+            }
+        }
+
+        position = next;
+    }
+
+    auto output = CompactBlock::Candidates{};
+    output.reserve(cached.size());
+    cached.erase(
+        std::remove_if(
+            cached.begin(),
+            cached.end(),
+            [&](const auto& weak) {
+                auto tx = weak.lock();
+
+                if (false == bool(tx)) { return true; }
+
+                output.emplace_back(std::move(tx));
+
+                return false;
+            }),
+        cached.end());
+
+    return output;
+}
+
 auto Peer::nonce(const api::Session& api) noexcept -> Nonce
 {
     Nonce output{0};
@@ -465,34 +566,9 @@ auto Peer::process_block(
             throw std::runtime_error("Invalid payload");
         }
 
-        auto submit{true};
-        auto block = api_.Factory().BitcoinBlock(chain_, payload.Bytes());
-
-        if (!block) { throw std::runtime_error("Failed to instantiate block"); }
-
-        if (false == block_.Validate(*block)) {
-            throw std::runtime_error("Invalid block");
-        }
-
-        if (block_job_) {
-            auto header = headers_.LoadHeader(block->Header().Hash());
-
-            if (!header) { throw std::runtime_error("Failed to load header"); }
-
-            submit = !block_job_.Download(header->Position(), std::move(block));
-
-            if (block_job_.isDownloaded()) { reset_block_job(); }
-        }
-
-        if (submit) {
-            using Task = node::internal::Network::Task;
-            network_.Submit([&] {
-                auto work = MakeWork(Task::SubmitBlock);
-                work.AddFrame(payload);
-
-                return work;
-            }());
-        }
+        submit_block(
+            api_.Factory().BitcoinBlock(chain_, payload.Bytes()),
+            payload.Bytes());
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
     }
@@ -518,7 +594,36 @@ auto Peer::process_blocktxn(
         return;
     }
 
-    // TODO
+    const auto transactions = pMessage->BlockTransactions();
+    const auto bytes = transactions->Bytes();
+
+    if (block::Hash{}.size() > bytes.size()) {
+        LogError()(OT_PRETTY_CLASS())("invalid blocktxn payload").Flush();
+
+        return;
+    }
+
+    auto i = compact_blocks_.find(block::Hash{bytes.substr(0, 32)});
+
+    if (compact_blocks_.end() == i) {
+        log_(OT_PRETTY_CLASS())("ignoring unrequested blocktxn from ")(
+            address_.Display())
+            .Flush();
+
+        return;
+    }
+
+    auto pending = std::move(i->second);
+    forget_compact_block(pending.first->Hash());
+    auto& [compact, received] = pending;
+    received += payload.size();
+
+    if (compact->AddTransactions(bytes)) {
+        finish_compact_block(std::move(pending), true);
+    } else {
+        ++compact_stats_.failed_;
+        request_full_block(compact->Hash());
+    }
 }
 
 auto Peer::process_cfcheckpt(
@@ -739,7 +844,97 @@ auto Peer::process_cmpctblock(
         return;
     }
 
-    // TODO
+    const auto version = compact_version_.load();
+
+    if (0u == version) {
+        log_(OT_PRETTY_CLASS())("ignoring unnegotiated cmpctblock from ")(
+            address_.Display())
+            .Flush();
+
+        return;
+    }
+
+    const auto raw = pMessage->HeaderAndShortIDs();
+    ++compact_stats_.received_;
+    auto pCompact = std::unique_ptr<CompactBlock>{};
+
+    try {
+        pCompact = std::make_unique<CompactBlock>(
+            api_, chain_, version, raw->Bytes());
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+        ++compact_stats_.failed_;
+
+        // A short ID collision or an unparseable transaction does not mean
+        // the header is bad so fall back to downloading the full block
+        try {
+            const auto header = api_.Factory().BlockHeader(
+                chain_, raw->Bytes().substr(0, 80));
+
+            if (header) { request_full_block(header->Hash()); }
+        } catch (...) {
+        }
+
+        return;
+    }
+
+    auto& compact = *pCompact;
+
+    if (0u < compact_blocks_.count(compact.Hash())) {
+        // NOTE the short IDs of this block were already matched against the
+        // mempool and the rest have been requested with getblocktxn
+        log_(OT_PRETTY_CLASS())("ignoring repeated cmpctblock for ")(
+            compact.Hash().asHex())(" from ")(address_.Display())
+            .Flush();
+
+        return;
+    }
+
+    compact.AddCandidates(mempool_candidates());
+    log_(OT_PRETTY_CLASS())("block ")(compact.Hash().asHex())(" has ")(
+        compact.size())(" transactions: ")(compact.Prefilled())(
+        " prefilled, ")(compact.FromCandidates())(" from mempool")
+        .Flush();
+    auto pending = PendingCompactBlock{std::move(pCompact), payload.size()};
+
+    if (compact.IsComplete()) {
+        finish_compact_block(std::move(pending), false);
+
+        return;
+    }
+
+    const auto pRequest =
+        std::unique_ptr<Message>{factory::BitcoinP2PGetblocktxn(
+            api_,
+            chain_,
+            api_.Factory().DataFromBytes(compact.Hash().Bytes()),
+            compact.Missing())};
+
+    if (false == bool(pRequest)) {
+        LogError()(OT_PRETTY_CLASS())("Failed to construct getblocktxn")
+            .Flush();
+        request_full_block(compact.Hash());
+
+        return;
+    }
+
+    log_("sending getblocktxn message to ")(display_chain_)(" peer ")(
+        address_.Display())
+        .Flush();
+    const auto& request = *pRequest;
+    send(request.Transmit());
+    static constexpr auto limit = std::size_t{16};
+
+    // The block oracle requests blocks again if a peer never answers so
+    // abandoned reconstructions only need to be bounded
+    while (limit <= compact_order_.size()) {
+        compact_blocks_.erase(compact_order_.front());
+        compact_order_.pop_front();
+        ++compact_stats_.failed_;
+    }
+
+    compact_order_.emplace_back(compact.Hash());
+    compact_blocks_.emplace(compact.Hash(), std::move(pending));
 }
 
 auto Peer::process_feefilter(
@@ -890,7 +1085,44 @@ auto Peer::process_getblocktxn(
         return;
     }
 
-    // TODO
+    const auto& message = *pMessage;
+    const auto hash = message.getBlockHash();
+    auto future =
+        network_.BlockOracle().LoadBitcoin(block::Hash{hash->Bytes()});
+
+    if (std::future_status::ready != future.wait_for(0ms)) {
+        log_(OT_PRETTY_CLASS())("block ")(hash->asHex())(" requested by ")(
+            address_.Display())(" is not available")
+            .Flush();
+
+        return;
+    }
+
+    const auto pBlock = future.get();
+    auto serialized = api_.Factory().Data();
+
+    const auto encoded =
+        pBlock && CompactBlock::EncodeTransactions(
+                      *pBlock, message.getIndices(), serialized->WriteInto());
+
+    if (false == encoded) {
+        LogError()(OT_PRETTY_CLASS())("failed to encode transactions for ")(
+            address_.Display())
+            .Flush();
+
+        return;
+    }
+
+    const auto pMsg = std::unique_ptr<Message>{
+        factory::BitcoinP2PBlocktxn(api_, chain_, serialized)};
+
+    OT_ASSERT(pMsg);
+
+    log_("sending blocktxn message to ")(display_chain_)(" peer ")(
+        address_.Display())
+        .Flush();
+    const auto& msg = *pMsg;
+    send(msg.Transmit());
 }
 
 auto Peer::process_getcfcheckpt(
@@ -1053,49 +1285,36 @@ auto Peer::process_getcfilters(
         return;
     }
 
-    // TODO allocator
-    auto data = Vector<GCS>{};
-    data.reserve(count);
-    const auto& filters = network_.FilterOracle();
     const auto type = message.Type();
     const auto hashes = headers_.BestHashes(startHeight, stopHash);
+    auto batch = MakeWork(Task::SendMessage);
+    batch.Internal().Reserve(2u * count + 1u);
+    auto serialized = bool{true};
+    const auto loaded = filter_.LoadEncodedFilters(
+        type, hashes, [&](const auto& hash, const auto filter) {
+            serialized &= factory::BitcoinP2PCfilterFrames(
+                api_, chain_, type, hash, filter, batch);
+        });
 
-    for (const auto& hash : hashes) {
-        const auto& cfilter = data.emplace_back(
-            filters.LoadFilter(type, hash, data.get_allocator()));
-
-        if (false == cfilter.IsValid()) { break; }
-    }
-
-    if (data.size() != count) {
+    if (loaded != count) {
         LogError()(OT_PRETTY_CLASS())(
             "Failed to load all filters, requested (")(count)("), loaded (")(
-            data.size())(")")
+            loaded)(")")
             .Flush();
 
         return;
     }
 
-    OT_ASSERT(data.size() == hashes.size());
-
-    auto h{hashes.begin()};
-
-    for (auto g{data.begin()}; g != data.end(); ++g, ++h) {
-        auto pOut = std::unique_ptr<message::internal::Cfilter>{
-            factory::BitcoinP2PCfilter(api_, chain_, type, *h, *g)};
-
-        if (false == bool(pOut)) {
-            LogError()(OT_PRETTY_CLASS())("Failed to construct reply").Flush();
-
-            return;
-        }
+    if (false == serialized) {
+        LogError()(OT_PRETTY_CLASS())("Failed to construct reply").Flush();
 
-        log_("sending cfilter message to ")(display_chain_)(" peer ")(
-            address_.Display())
-            .Flush();
-        const auto& message = *pOut;
-        send(message.Transmit());
+        return;
     }
+
+    log_("sending ")(count)(" cfilter messages to ")(display_chain_)(
+        " peer ")(address_.Display())
+        .Flush();
+    send(std::move(batch));
 }
 
 auto Peer::process_getdata(
@@ -1184,9 +1403,50 @@ auto Peer::process_getdata(
                     notFound.emplace_back(inv);
                 }
             } break;
+            case Type::MsgCmpctBlock: {
+                const auto version = [&] {
+                    const auto negotiated = compact_version_.load();
+
+                    return (0u == negotiated)
+                               ? CompactBlock::SupportedVersion(chain_)
+                               : negotiated;
+                }();
+                const auto& oracle = network_.BlockOracle();
+                auto future =
+                    oracle.LoadBitcoin(block::Hash{inv.hash_->Bytes()});
+                const auto have =
+                    (0u < version) &&
+                    (std::future_status::ready == future.wait_for(0ms));
+                const auto pBlock = have ? future.get() : nullptr;
+                auto serialized = api_.Factory().Data();
+                const auto encoded =
+                    pBlock && CompactBlock::Encode(
+                                  api_,
+                                  chain_,
+                                  version,
+                                  nonce(api_),
+                                  *pBlock,
+                                  serialized->WriteInto());
+
+                if (encoded) {
+                    const auto pMsg = std::unique_ptr<Message>{
+                        factory::BitcoinP2PCmpctblock(
+                            api_, chain_, serialized)};
+
+                    OT_ASSERT(pMsg);
+
+                    log_("sending cmpctblock message to ")(display_chain_)(
+                        " peer ")(address_.Display())
+                        .Flush();
+
+                    const auto& msg = *pMsg;
+                    send(msg.Transmit());
+                } else {
+                    notFound.emplace_back(inv);
+                }
+            } break;
             case Type::None:
             case Type::MsgFilteredBlock:
-            case Type::MsgCmpctBlock:
             case Type::MsgWitnessTx:
             case Type::MsgWitnessBlock:
             case Type::MsgFilteredWitnessBlock:
@@ -1657,7 +1917,16 @@ auto Peer::process_sendcmpct(
         return;
     }
 
-    // TODO
+    // The peer sends one sendcmpct per version it supports. Only the version
+    // which matches the short ID calculation used on this chain is useful.
+    const auto version = pMessage->version();
+
+    if (version == CompactBlock::SupportedVersion(chain_)) {
+        compact_version_.store(version);
+        log_(OT_PRETTY_CLASS())("compact blocks version ")(
+            version)(" enabled for ")(address_.Display())
+            .Flush();
+    }
 }
 
 auto Peer::process_sendheaders(
@@ -1720,6 +1989,20 @@ auto Peer::process_verack(
         return;
     }
 
+    if (const auto version = CompactBlock::SupportedVersion(chain_);
+        (0u < version) && (70014 <= protocol_.load())) {
+        const auto pMsg = std::unique_ptr<Message>{
+            factory::BitcoinP2PSendcmpct(api_, chain_, false, version)};
+
+        if (pMsg) {
+            log_("sending sendcmpct message to ")(display_chain_)(" peer ")(
+                address_.Display())
+                .Flush();
+            const auto& msg = *pMsg;
+            send(msg.Transmit());
+        }
+    }
+
     state_.handshake_.first_action_ = true;
     check_handshake();
 }
@@ -1771,28 +2054,7 @@ auto Peer::process_version(
 
 auto Peer::reconcile_mempool() noexcept -> void
 {
-    const auto local = mempool_.Dump();
-    const auto remote = [&] {
-        auto out = UnallocatedSet<UnallocatedCString>{};
-        std::copy(
-            known_transactions_.begin(),
-            known_transactions_.end(),
-            std::inserter(out, out.end()));
-
-        return out;
-    }();
-    const auto missing = [&] {
-        auto out = UnallocatedVector<UnallocatedCString>{};
-        out.reserve(local.size());
-        std::set_difference(
-            local.begin(),
-            local.end(),
-            remote.begin(),
-            remote.end(),
-            std::back_inserter(out));
-
-        return out;
-    }();
+    using Mempool = node::internal::Mempool;
     using Inventory = blockchain::bitcoin::Inventory;
     using Type = Inventory::Type;
     const auto type = [&] {
@@ -1807,9 +2069,21 @@ auto Peer::reconcile_mempool() noexcept -> void
         }
     }();
     auto inv = UnallocatedVector<Inventory>{};
+    auto position = Mempool::Cursor{0};
 
-    for (const auto& hash : missing) {
-        inv.emplace_back(type, api_.Factory().DataFromBytes(hash));
+    while (true) {
+        const auto [txids, next] =
+            mempool_.Dump(position, Mempool::dump_batch_);
+
+        if (txids.empty()) { break; }
+
+        for (const auto& txid : txids) {
+            if (0u < known_transactions_.count(txid)) { continue; }
+
+            inv.emplace_back(type, api_.Factory().DataFromBytes(txid));
+        }
+
+        position = next;
     }
 
     broadcast_inv(std::move(inv));
@@ -1851,10 +2125,14 @@ auto Peer::request_block(zmq::Message&& in) noexcept -> void
     auto blocks = UnallocatedVector<BlockList>{};
     blocks.emplace_back();
     static constexpr auto limit = std::size_t{50000};
+    // The peer answers with a full block instead if the requested block is
+    // too far from its tip to be relayed in compact form
+    const auto type =
+        (0u < compact_version_.load()) ? Type::MsgCmpctBlock : Type::MsgBlock;
 
     for (auto i = std::size_t{1}; i < body.size(); ++i) {
         auto& list = blocks.back();
-        list.emplace_back(Type::MsgBlock, api_.Factory().Data(body.at(1)));
+        list.emplace_back(type, api_.Factory().Data(body.at(i)));
 
         if (limit <= list.size()) { blocks.emplace_back(); }
     }
@@ -2071,6 +2349,28 @@ auto Peer::request_checkpoint_filter_header() noexcept -> void
     }
 }
 
+auto Peer::request_full_block(const block::Hash& hash) noexcept -> void
+{
+    using Inventory = blockchain::bitcoin::Inventory;
+    auto inv = UnallocatedVector<Inventory>{};
+    inv.emplace_back(
+        Inventory::Type::MsgBlock, api_.Factory().DataFromBytes(hash.Bytes()));
+    auto pMessage = std::unique_ptr<Message>{
+        factory::BitcoinP2PGetdata(api_, chain_, std::move(inv))};
+
+    if (false == bool(pMessage)) {
+        LogError()(OT_PRETTY_CLASS())("Failed to construct getdata").Flush();
+
+        return;
+    }
+
+    log_("sending getdata(block) message to ")(display_chain_)(" peer ")(
+        address_.Display())
+        .Flush();
+    const auto& message = *pMessage;
+    send(message.Transmit());
+}
+
 auto Peer::request_headers() noexcept -> void
 {
     static const auto blank = block::Hash{};
@@ -2192,5 +2492,38 @@ auto Peer::start_handshake() noexcept -> void
     }
 }
 
+auto Peer::submit_block(
+    std::shared_ptr<const block::bitcoin::Block> block,
+    const ReadView bytes) noexcept(false) -> void
+{
+    auto submit{true};
+
+    if (!block) { throw std::runtime_error("Failed to instantiate block"); }
+
+    if (false == block_.Validate(*block)) {
+        throw std::runtime_error("Invalid block");
+    }
+
+    if (block_job_) {
+        auto header = headers_.LoadHeader(block->Header().Hash());
+
+        if (!header) { throw std::runtime_error("Failed to load header"); }
+
+        submit = !block_job_.Download(header->Position(), std::move(block));
+
+        if (block_job_.isDownloaded()) { reset_block_job(); }
+    }
+
+    if (submit) {
+        using Task = node::internal::Network::Task;
+        network_.Submit([&] {
+            auto work = MakeWork(Task::SubmitBlock);
+            work.AddFrame(bytes.data(), bytes.size());
+
+            return work;
+        }());
+    }
+}
+
 Peer::~Peer() { Shutdown(); }
 }  // namespace opentxs::blockchain::p2p::bitcoin::implementation
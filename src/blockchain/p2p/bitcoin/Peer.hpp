@@ -8,11 +8,14 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <future>
 #include <iosfwd>
 #include <memory>
 #include <type_traits>
+#include <utility>
 
+#include "blockchain/p2p/bitcoin/CompactBlock.hpp"
 #include "blockchain/p2p/bitcoin/Header.hpp"
 #include "blockchain/p2p/bitcoin/Message.hpp"
 #include "blockchain/p2p/peer/Peer.hpp"
@@ -46,6 +49,15 @@ namespace bitcoin
 class Inventory;
 }  // namespace bitcoin
 
+namespace block
+{
+namespace bitcoin
+{
+class Block;
+class Transaction;
+}  // namespace bitcoin
+}  // namespace block
+
 namespace node
 {
 namespace internal
@@ -148,6 +160,29 @@ private:
         Time start_{};
     };
 
+    // Compact blocks received from this peer, for reporting how much
+    // bandwidth they save and how often mempool reconstruction succeeds
+    struct CompactBlockStats {
+        std::size_t received_{};
+        std::size_t reconstructed_{};
+        std::size_t requested_{};
+        std::size_t failed_{};
+        std::size_t compact_bytes_{};
+        std::size_t block_bytes_{};
+    };
+
+    // Mempool transactions offered to compact block reconstruction. Each
+    // cmpctblock only dumps the part of the mempool which was added since
+    // cursor_, and transactions which the mempool has dropped expire.
+    struct CompactCandidates {
+        node::internal::Mempool::Cursor cursor_{};
+        UnallocatedVector<std::weak_ptr<const block::bitcoin::Transaction>>
+            transactions_{};
+    };
+
+    using PendingCompactBlock =
+        std::pair<std::unique_ptr<CompactBlock>, std::size_t>;
+
     static const UnallocatedMap<Command, CommandFunction> command_map_;
     static const ProtocolVersion default_protocol_version_{70015};
     static const UnallocatedCString user_agent_;
@@ -158,6 +193,12 @@ private:
     const UnallocatedSet<p2p::Service> local_services_;
     std::atomic<bool> relay_;
     Request get_headers_;
+    std::atomic<std::uint64_t> compact_version_;
+    UnallocatedMap<block::Hash, PendingCompactBlock> compact_blocks_;
+    // Hashes in compact_blocks_, oldest first
+    UnallocatedDeque<block::Hash> compact_order_;
+    CompactCandidates compact_candidates_;
+    CompactBlockStats compact_stats_;
 
     static auto get_local_services(
         const ProtocolVersion version,
@@ -176,6 +217,11 @@ private:
     auto broadcast_block(zmq::Message&& message) noexcept -> void final;
     auto broadcast_inv_transaction(ReadView txid) noexcept -> void final;
     auto broadcast_transaction(zmq::Message&& message) noexcept -> void final;
+    auto finish_compact_block(
+        PendingCompactBlock&& pending,
+        const bool requested) noexcept -> void;
+    auto forget_compact_block(const block::Hash& hash) noexcept -> void;
+    auto mempool_candidates() noexcept -> CompactBlock::Candidates;
     auto ping() noexcept -> void final;
     auto pong(Nonce) noexcept -> void final;
     auto process_message(zmq::Message&& message) noexcept -> void final;
@@ -183,6 +229,7 @@ private:
     auto request_addresses() noexcept -> void final;
     auto request_block(zmq::Message&& message) noexcept -> void final;
     auto request_blocks() noexcept -> void final;
+    auto request_full_block(const block::Hash& hash) noexcept -> void;
     auto request_cfheaders() noexcept -> void final;
     auto request_cfilter() noexcept -> void final;
     auto request_checkpoint_block_header() noexcept -> void final;
@@ -194,6 +241,9 @@ private:
     auto request_transactions(
         UnallocatedVector<blockchain::bitcoin::Inventory>&&) noexcept -> void;
     auto start_handshake() noexcept -> void final;
+    auto submit_block(
+        std::shared_ptr<const block::bitcoin::Block> block,
+        const ReadView bytes) noexcept(false) -> void;
 
     auto process_addr(
         std::unique_ptr<HeaderType> header,
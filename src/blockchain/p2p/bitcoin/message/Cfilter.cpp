@@ -22,9 +22,13 @@
 #include "internal/blockchain/p2p/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/p2p/bitcoin/message/Message.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "opentxs/blockchain/p2p/Types.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
+#include "opentxs/network/zeromq/message/Frame.hpp"
+#include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 
@@ -132,6 +136,57 @@ auto BitcoinP2PCfilter(
         return out;
     }());
 }
+
+auto BitcoinP2PCfilterFrames(
+    const api::Session& api,
+    const blockchain::Type network,
+    const blockchain::cfilter::Type type,
+    const blockchain::block::Hash& hash,
+    const ReadView encodedFilter,
+    network::zeromq::Message& out) noexcept -> bool
+{
+    namespace bitcoin = blockchain::p2p::bitcoin;
+    using Prefix = bitcoin::message::implementation::Cfilter::BitcoinFormat;
+    using CompactSize = network::blockchain::bitcoin::CompactSize;
+
+    try {
+        const auto prefix = Prefix{network, type, hash};
+        const auto size = CompactSize(encodedFilter.size()).Encode();
+        const auto bytes = sizeof(prefix) + size.size() + encodedFilter.size();
+        auto payload = network::zeromq::Frame{};
+        auto view = payload.WriteInto()(bytes);
+
+        if (false == view.valid(bytes)) {
+            throw std::runtime_error{"failed to allocate output space"};
+        }
+
+        auto* i = view.as<std::byte>();
+        std::memcpy(i, static_cast<const void*>(&prefix), sizeof(prefix));
+        std::advance(i, sizeof(prefix));
+        std::memcpy(i, size.data(), size.size());
+        std::advance(i, size.size());
+        std::memcpy(i, encodedFilter.data(), encodedFilter.size());
+        auto checksum = Data::Factory();
+
+        const auto hashed = blockchain::P2PMessageHash(
+            api, network, payload.Bytes(), checksum->WriteInto());
+
+        if (false == hashed) {
+            throw std::runtime_error{"failed to calculate checksum"};
+        }
+
+        const auto header = bitcoin::Header::BitcoinFormat{
+            network, bitcoin::Command::cfilter, bytes, checksum};
+        out.AddFrame(static_cast<const void*>(&header), sizeof(header));
+        out.AddFrame(std::move(payload));
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()("opentxs::factory::")(__func__)(": ")(e.what()).Flush();
+
+        return false;
+    }
+}
 }  // namespace opentxs::factory
 
 namespace opentxs::blockchain::p2p::bitcoin::message::implementation
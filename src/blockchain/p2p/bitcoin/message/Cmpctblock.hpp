@@ -44,6 +44,11 @@ namespace opentxs::blockchain::p2p::bitcoin::message
 class Cmpctblock final : public implementation::Message
 {
 public:
+    auto HeaderAndShortIDs() const noexcept -> OTData
+    {
+        return raw_cmpctblock_;
+    }
+
     Cmpctblock(
         const api::Session& api,
         const blockchain::Type network,
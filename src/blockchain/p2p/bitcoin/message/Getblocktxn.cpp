@@ -8,9 +8,11 @@
 #include "blockchain/p2p/bitcoin/message/Getblocktxn.hpp"  // IWYU pragma: associated
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <stdexcept>
 #include <utility>
 
@@ -82,6 +84,13 @@ auto BitcoinP2PGetblocktxn(
     UnallocatedVector<std::size_t> txn_indices;
 
     if (indicesCount > 0) {
+        // Indices are differentially encoded on the wire (BIP-152). No block
+        // holds more transactions than a 16 bit index can address, which also
+        // keeps the running index far away from overflow.
+        static constexpr auto limit = std::size_t{
+            std::numeric_limits<std::uint16_t>::max()} + 1u;
+        std::size_t next{0};
+
         for (std::size_t ii = 0; ii < indicesCount; ii++) {
             expectedSize += sizeof(std::byte);
 
@@ -103,7 +112,17 @@ auto BitcoinP2PGetblocktxn(
                 return nullptr;
             }
 
-            txn_indices.push_back(txnIndex);
+            if ((limit - next) <= txnIndex) {
+                LogError()("opentxs::factory::")(__func__)(
+                    ": Txn index out of range at entry index ")(ii)
+                    .Flush();
+
+                return nullptr;
+            }
+
+            const auto position = next + txnIndex;
+            txn_indices.push_back(position);
+            next = position + 1u;
         }
     }
     // --------------------------------------------------------
@@ -147,10 +166,17 @@ auto Getblocktxn::payload(AllocateOutput out) const noexcept -> bool
             Data::Factory(CompactSize(txn_indices_.size()).Encode()));
         bytes += count->size();
 
+        auto next = std::size_t{0};
+
         for (const auto& index : txn_indices_) {
-            const auto& cs =
-                data.emplace_back(Data::Factory(CompactSize(index).Encode()));
+            if (index < next) {
+                throw std::runtime_error{"indices not sorted"};
+            }
+
+            const auto& cs = data.emplace_back(
+                Data::Factory(CompactSize(index - next).Encode()));
             bytes += cs->size();
+            next = index + 1u;
         }
 
         auto output = out(bytes);
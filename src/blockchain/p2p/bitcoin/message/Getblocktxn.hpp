@@ -51,6 +51,7 @@ public:
     {
         return Data::Factory(block_hash_);
     }
+    // Absolute transaction positions, in ascending order
     auto getIndices() const noexcept -> const UnallocatedVector<std::size_t>&
     {
         return txn_indices_;
@@ -475,6 +475,16 @@ auto Peer::reset_cfilter_job() noexcept -> void
 
 auto Peer::send(std::pair<zmq::Frame, zmq::Frame>&& frames) noexcept
     -> SendStatus
+{
+    auto& [header, payload] = frames;
+    auto out = MakeWork(Task::SendMessage);
+    out.AddFrame(std::move(header));
+    out.AddFrame(std::move(payload));
+
+    return send(std::move(out));
+}
+
+auto Peer::send(zmq::Message&& batch) noexcept -> SendStatus
 {
     try {
         if (false == state_.connect_.future_.get()) {
@@ -489,17 +499,9 @@ auto Peer::send(std::pair<zmq::Frame, zmq::Frame>&& frames) noexcept
 
     if (running_.load()) {
         auto data = send_promises_.NewPromise();
-        pipeline_.Push([&] {
-            auto& [future, promise] = data;
-            auto& [header, payload] = frames;
-            auto out = MakeWork(Task::SendMessage);
-            out.AddFrame(std::move(header));
-            out.AddFrame(std::move(payload));
-            out.AddFrame(promise);
-
-            return out;
-        }());
         auto& [future, promise] = data;
+        batch.AddFrame(promise);
+        pipeline_.Push(std::move(batch));
 
         return std::move(future);
     } else {
@@ -678,16 +680,29 @@ auto Peer::transmit(zmq::Message&& message) noexcept -> void
 {
     if (false == running_.load()) { return; }
 
-    OT_ASSERT(message.Body().size() > 3)
-
     auto body = message.Body();
-    auto& header = body.at(1);
-    auto& payload = body.at(2);
-    const auto& promiseFrame = body.at(3);
+    const auto frames = body.size();
+
+    OT_ASSERT(3u < frames);
+    OT_ASSERT(0u == (frames % 2u));
+
+    // NOTE the frames between the task and the promise are one or more
+    // header and payload pairs which must be written in order
+    const auto& promiseFrame = body.at(frames - 1u);
     const auto index = promiseFrame.as<int>();
     auto success = bool{false};
     auto postcondition =
         ScopeGuard{[&] { send_promises_.SetPromise(index, success); }};
+
+    for (auto i = std::size_t{1}; i < (frames - 1u); i += 2u) {
+        if (false == transmit(body.at(i), body.at(i + 1u))) { return; }
+    }
+
+    success = true;
+}
+
+auto Peer::transmit(zmq::Frame& header, zmq::Frame& payload) noexcept -> bool
+{
     log_(OT_PRETTY_CLASS())("Sending ")(header.size() + payload.size())(
         " byte message:")
         .Flush();
@@ -718,7 +733,7 @@ auto Peer::transmit(zmq::Message&& message) noexcept -> void
                     .Flush();
                 disconnect();
 
-                return;
+                return false;
             }
         }
     } catch (const std::exception& e) {
@@ -727,19 +742,19 @@ auto Peer::transmit(zmq::Message&& message) noexcept -> void
             .Flush();
         disconnect();
 
-        return;
+        return false;
     }
 
     if (result) {
         log_(OT_PRETTY_CLASS())("Sent ")(payload.size())(" bytes").Flush();
-        success = true;
     } else {
         log_("Disconnecting ")(display_chain_)(" peer ")(address_.Display())(
             " due to unspecified transmit error.")
             .Flush();
-        success = false;
         disconnect();
     }
+
+    return result;
 }
 
 auto Peer::update_address_activity() noexcept -> void
@@ -294,6 +294,9 @@ protected:
     auto reset_cfheader_job() noexcept -> void;
     auto reset_cfilter_job() noexcept -> void;
     auto send(std::pair<zmq::Frame, zmq::Frame>&& data) noexcept -> SendStatus;
+    // Sends a SendMessage work message containing any number of header and
+    // payload pairs as a single operation
+    auto send(zmq::Message&& batch) noexcept -> SendStatus;
     auto update_address_services(
         const UnallocatedSet<p2p::Service>& services) noexcept -> void;
     auto verifying() noexcept -> bool
@@ -376,6 +379,7 @@ private:
     auto start_verify() noexcept -> void;
     auto subscribe() noexcept -> void;
     auto transmit(zmq::Message&& message) noexcept -> void;
+    auto transmit(zmq::Frame& header, zmq::Frame& payload) noexcept -> bool;
     auto update_address_activity() noexcept -> void;
     auto verify() noexcept -> void;
 
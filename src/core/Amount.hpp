@@ -5,14 +5,18 @@
 
 #pragma once
 
+#include <boost/config.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/endian/buffers.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
+#include <array>
 #include <cstdint>
 #include <exception>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 #include "internal/core/Amount.hpp"
@@ -26,9 +30,22 @@ namespace be = boost::endian;
 
 namespace opentxs
 {
+// Amounts are fixed point numbers with amount::fractional_bits_ fractional
+// bits. Values which fit in a native 128 bit integer are kept in small_ and
+// use native arithmetic. Any operation which would overflow the native type
+// is performed on amount::Integer instead and the result is demoted back to
+// the native representation if possible.
 class Amount::Imp final : virtual public internal::Amount
 {
 public:
+#if defined(BOOST_HAS_INT128)
+    using Small = boost::int128_type;
+    using UnsignedSmall = boost::uint128_type;
+#else
+    using Small = std::int64_t;
+    using UnsignedSmall = std::uint64_t;
+#endif
+
     static auto factory_signed(long long rhs) noexcept -> Imp*
     {
         return std::make_unique<Imp>(rhs).release();
@@ -46,66 +63,82 @@ public:
     {
         return extract_int<std::uint64_t>();
     }
-    auto operator<(const Imp& rhs) const { return amount_ < rhs.amount_; }
+    auto IsSmall() const noexcept -> bool { return small_.has_value(); }
+    auto operator<(const Imp& rhs) const { return compare(rhs) < 0; }
 
     template <typename T>
     auto operator<(const T rhs) const
     {
-        return amount_ < shift_left(rhs);
+        return compare(from(rhs)) < 0;
     }
-    auto operator>(const Imp& rhs) const { return amount_ > rhs.amount_; }
+    auto operator>(const Imp& rhs) const { return compare(rhs) > 0; }
 
     template <typename T>
     auto operator>(const T rhs) const
     {
-        return amount_ > shift_left(rhs);
+        return compare(from(rhs)) > 0;
     }
 
-    auto operator==(const Imp& rhs) const { return amount_ == rhs.amount_; }
+    auto operator==(const Imp& rhs) const { return compare(rhs) == 0; }
 
     template <typename T>
     auto operator==(const T rhs) const
     {
-        return amount_ == shift_left(rhs);
+        return compare(from(rhs)) == 0;
     }
 
-    auto operator!=(const Imp& rhs) const { return amount_ != rhs.amount_; }
+    auto operator!=(const Imp& rhs) const { return compare(rhs) != 0; }
 
     template <typename T>
     auto operator!=(const T rhs) const
     {
-        return amount_ != shift_left(rhs);
+        return compare(from(rhs)) != 0;
     }
 
-    auto operator<=(const Imp& rhs) const { return amount_ <= rhs.amount_; }
+    auto operator<=(const Imp& rhs) const { return compare(rhs) <= 0; }
 
     template <typename T>
     auto operator<=(const T rhs) const
     {
-        return amount_ <= shift_left(rhs);
+        return compare(from(rhs)) <= 0;
     }
 
-    auto operator>=(const Imp& rhs) const { return amount_ >= rhs.amount_; }
+    auto operator>=(const Imp& rhs) const { return compare(rhs) >= 0; }
 
     template <typename T>
     auto operator>=(const T rhs) const
     {
-        return amount_ >= shift_left(rhs);
+        return compare(from(rhs)) >= 0;
     }
 
     auto operator+(const Imp& rhs) const noexcept(false) -> Imp
     {
-        return amount_ + rhs.amount_;
+        if (auto out = Small{};
+            both_small(rhs) && add(*small_, *rhs.small_, out)) {
+            return native(out);
+        }
+
+        return big() + rhs.big();
     }
 
     auto operator-(const Imp& rhs) const noexcept(false) -> Imp
     {
-        return amount_ - rhs.amount_;
+        if (auto out = Small{};
+            both_small(rhs) && sub(*small_, *rhs.small_, out)) {
+            return native(out);
+        }
+
+        return big() - rhs.big();
     }
 
     auto operator*(const Imp& rhs) const noexcept(false) -> Imp
     {
-        const auto total = amount_ * rhs.amount_;
+        if (auto out = Small{};
+            both_small(rhs) && mul(*small_, *rhs.small_, out)) {
+            return native(truncate(out));
+        }
+
+        const auto total = big() * rhs.big();
         auto imp = Imp{total};
         return imp.shift_right();
     }
@@ -113,59 +146,90 @@ public:
     template <typename T>
     auto operator*(const T rhs) const noexcept(false) -> Imp
     {
-        return amount_ * rhs;
+        if (auto out = Small{};
+            small_.has_value() && mul(*small_, Small(rhs), out)) {
+            return native(out);
+        }
+
+        return big() * rhs;
     }
 
     auto operator/(const Imp& rhs) const noexcept(false) -> Imp
     {
-        const auto total = amount_ / rhs.amount_;
+        if (auto out = Small{}; both_small(rhs) &&
+                                div(*small_, *rhs.small_, out) &&
+                                mul(out, scale_, out)) {
+            return native(out);
+        }
+
+        const auto total = big() / rhs.big();
         return Imp::shift_left(total);
     }
 
     template <typename T>
     auto operator/(const T rhs) const noexcept(false) -> Imp
     {
-        return amount_ / rhs;
+        if (auto out = Small{};
+            small_.has_value() && div(*small_, Small(rhs), out)) {
+            return native(out);
+        }
+
+        return big() / rhs;
     }
 
     auto operator%(const Imp& rhs) const noexcept(false) -> Imp
     {
-        return amount_ % rhs.amount_;
+        if (auto out = Small{};
+            both_small(rhs) && mod(*small_, *rhs.small_, out)) {
+            return native(out);
+        }
+
+        return big() % rhs.big();
     }
 
     template <typename T>
     auto operator%(const T rhs) const noexcept(false) -> Imp
     {
-        return amount_ % shift_left(rhs);
+        return operator%(from(rhs));
     }
 
     auto operator*=(const Imp& amount) noexcept(false) -> Imp&
     {
-        auto total = amount_ * amount.amount_;
-        amount_ = Imp(total).shift_right();
-        return *this;
+        const auto result = operator*(amount);
+
+        return operator=(result);
     }
 
     auto operator+=(const Imp& amount) noexcept(false) -> Imp&
     {
-        amount_ += amount.amount_;
-        return *this;
+        const auto result = operator+(amount);
+
+        return operator=(result);
     }
 
     auto operator-=(const Imp& amount) noexcept(false) -> Imp&
     {
-        amount_ -= amount.amount_;
-        return *this;
+        const auto result = operator-(amount);
+
+        return operator=(result);
     }
 
-    auto operator-() -> Imp { return -amount_; }
+    auto operator-() -> Imp
+    {
+        if (auto out = Small{};
+            small_.has_value() && sub(Small{0}, *small_, out)) {
+            return native(out);
+        }
+
+        return -big();
+    }
 
     auto Serialize(const AllocateOutput dest) const noexcept -> bool
     {
         auto amount = UnallocatedCString{};
 
         try {
-            amount = amount_.str();
+            amount = small_.has_value() ? to_string(*small_) : amount_.str();
         } catch (const std::exception& e) {
             LogError()(OT_PRETTY_CLASS())("Error serializing amount: ")(
                 e.what())
@@ -179,19 +243,30 @@ public:
     auto SerializeBitcoin(const AllocateOutput dest) const noexcept
         -> bool final
     {
-        const auto backend = shift_right();
-        if (backend < 0 || backend > std::numeric_limits<std::int64_t>::max())
-            return false;
-
         auto amount = std::int64_t{};
-        try {
-            amount = backend.convert_to<std::int64_t>();
-        } catch (const std::exception& e) {
-            LogError()(OT_PRETTY_CLASS())("Error serializing bitcoin amount: ")(
-                e.what())
-                .Flush();
-            return false;
+
+        if (small_.has_value()) {
+            const auto backend = truncate(*small_);
+
+            if (backend < 0) { return false; }
+
+            amount = static_cast<std::int64_t>(backend);
+        } else {
+            const auto backend = shift_right();
+            if (backend < 0 ||
+                backend > std::numeric_limits<std::int64_t>::max())
+                return false;
+
+            try {
+                amount = backend.convert_to<std::int64_t>();
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Error serializing bitcoin amount: ")(e.what())
+                    .Flush();
+                return false;
+            }
         }
+
         const auto buffer = be::little_int64_buf_t(amount);
 
         const auto view =
@@ -204,12 +279,23 @@ public:
 
     auto ToFloat() const noexcept -> amount::Float final
     {
-        return amount::IntegerToFloat(amount_);
+        return amount::IntegerToFloat(big());
     }
 
     template <typename T>
     auto extract_int() const noexcept -> T
     {
+        if (small_.has_value()) {
+            const auto value = truncate(*small_);
+            using Limits = std::numeric_limits<T>;
+
+            if ((Small(Limits::min()) <= value) &&
+                (Small(Limits::max()) >= value)) {
+
+                return static_cast<T>(value);
+            }
+        }
+
         try {
             return shift_right().convert_to<T>();
         } catch (const std::exception& e) {
@@ -224,7 +310,7 @@ public:
     auto extract_float() const noexcept -> T
     {
         try {
-            return amount_.convert_to<T>() / shift_left(1).convert_to<T>();
+            return big().convert_to<T>() / shift_left(1).convert_to<T>();
         } catch (const std::exception& e) {
             LogError()(OT_PRETTY_CLASS())("Error converting Amount to float: ")(
                 e.what())
@@ -247,51 +333,50 @@ public:
 
     auto shift_right() const -> amount::Integer
     {
-        if (amount_ < 0) {
-            auto tmp = -amount_;
+        const auto amount = big();
+
+        if (amount < 0) {
+            auto tmp = -amount;
             tmp >>= amount::fractional_bits_;
             return -tmp;
         } else {
-            return amount_ >> amount::fractional_bits_;
+            return amount >> amount::fractional_bits_;
         }
     }
 
     Imp() noexcept
-        : amount_{}
+        : small_{native_ ? std::optional<Small>{0} : std::nullopt}
+        , amount_{}
     {
     }
     Imp(const amount::Integer& rhs) noexcept
-        : amount_{rhs}
+        : small_{demote(rhs)}
+        , amount_{small_.has_value() ? amount::Integer{} : rhs}
     {
     }
     Imp(amount::Integer&& rhs) noexcept
-        : amount_{std::move(rhs)}
+        : small_{demote(rhs)}
+        , amount_{small_.has_value() ? amount::Integer{} : std::move(rhs)}
     {
     }
     Imp(long long amount) noexcept
-        : amount_{shift_left(amount)}
+        : Imp(static_cast<Small>(amount), amount)
     {
     }
 
     Imp(unsigned long long amount) noexcept
-        : amount_{shift_left(amount)}
+        : Imp(static_cast<Small>(amount), amount)
     {
     }
     Imp(std::string_view str, bool normalize = false) noexcept(false)
-        : amount_{amount::Integer{str}}
+        : Imp(parse(str, normalize))
     {
-        if (normalize) {
-            if (amount_ < 0) {
-                amount_ = -(-amount_ << amount::fractional_bits_);
-            } else {
-                amount_ <<= amount::fractional_bits_;
-            }
-        }
     }
     Imp(const Imp&) noexcept = default;
     Imp(Imp&& rhs) noexcept = delete;
     auto operator=(const Imp& imp) -> Imp&
     {
+        small_ = imp.small_;
         amount_ = imp.amount_;
         return *this;
     }
@@ -300,6 +385,208 @@ public:
     ~Imp() final = default;
 
 private:
+    struct Native {
+    };
+
+#if defined(BOOST_HAS_INT128)
+    static constexpr auto native_{true};
+    static constexpr auto scale_ = Small{1} << amount::fractional_bits_;
+    static constexpr auto small_max_ =
+        static_cast<Small>(~UnsignedSmall{0} >> 1u);
+    static constexpr auto small_min_ = -small_max_ - 1;
+#else
+    static constexpr auto native_{false};
+    static constexpr auto scale_ = Small{1};
+    static constexpr auto small_max_ = Small{0};
+    static constexpr auto small_min_ = Small{0};
+#endif
+
+    std::optional<Small> small_;
     amount::Integer amount_;
+
+    template <typename T>
+    static auto from(const T rhs) noexcept -> Imp
+    {
+        if constexpr (std::is_signed_v<T>) {
+            return Imp{static_cast<long long>(rhs)};
+        } else {
+            return Imp{static_cast<unsigned long long>(rhs)};
+        }
+    }
+    static auto add(const Small lhs, const Small rhs, Small& out) noexcept
+        -> bool
+    {
+#if defined(BOOST_HAS_INT128)
+        return false == __builtin_add_overflow(lhs, rhs, &out);
+#else
+        return false;
+#endif
+    }
+    static auto demote(const amount::Integer& rhs) noexcept
+        -> std::optional<Small>
+    {
+#if defined(BOOST_HAS_INT128)
+        static const auto limit = amount::Integer{1} << 127u;
+        const auto negative = rhs < 0;
+        const auto magnitude = negative ? amount::Integer{-rhs} : rhs;
+
+        if (magnitude >= limit) { return std::nullopt; }
+
+        const auto mask =
+            amount::Integer{std::numeric_limits<std::uint64_t>::max()};
+        const auto low = static_cast<amount::Integer>(magnitude & mask)
+                             .convert_to<std::uint64_t>();
+        const auto high = static_cast<amount::Integer>(magnitude >> 64u)
+                              .convert_to<std::uint64_t>();
+        const auto value =
+            static_cast<Small>((UnsignedSmall{high} << 64u) | low);
+
+        return negative ? -value : value;
+#else
+        return std::nullopt;
+#endif
+    }
+    static auto div(const Small lhs, const Small rhs, Small& out) noexcept
+        -> bool
+    {
+        if ((0 == rhs) || ((small_min_ == lhs) && (-1 == rhs))) {
+            return false;
+        }
+
+        out = lhs / rhs;
+
+        return true;
+    }
+    static auto native(const Small value) noexcept -> Imp
+    {
+        return Imp{Native{}, value};
+    }
+    static auto mod(const Small lhs, const Small rhs, Small& out) noexcept
+        -> bool
+    {
+        if ((0 == rhs) || ((small_min_ == lhs) && (-1 == rhs))) {
+            return false;
+        }
+
+        out = lhs % rhs;
+
+        return true;
+    }
+    static auto mul(const Small lhs, const Small rhs, Small& out) noexcept
+        -> bool
+    {
+#if defined(BOOST_HAS_INT128)
+        return false == __builtin_mul_overflow(lhs, rhs, &out);
+#else
+        return false;
+#endif
+    }
+    static auto parse(std::string_view str, bool normalize) noexcept(false)
+        -> amount::Integer
+    {
+        auto output = amount::Integer{str};
+
+        if (normalize) {
+            if (output < 0) {
+                output = -(-output << amount::fractional_bits_);
+            } else {
+                output <<= amount::fractional_bits_;
+            }
+        }
+
+        return output;
+    }
+    static auto promote(const Small rhs) noexcept -> amount::Integer
+    {
+#if defined(BOOST_HAS_INT128)
+        const auto negative = rhs < 0;
+        const auto magnitude = negative ? UnsignedSmall(0) - UnsignedSmall(rhs)
+                                        : UnsignedSmall(rhs);
+        auto output =
+            amount::Integer{static_cast<std::uint64_t>(magnitude >> 64u)};
+        output <<= 64u;
+        output |= static_cast<std::uint64_t>(magnitude);
+
+        return negative ? amount::Integer{-output} : output;
+#else
+        return amount::Integer{rhs};
+#endif
+    }
+    static auto sub(const Small lhs, const Small rhs, Small& out) noexcept
+        -> bool
+    {
+#if defined(BOOST_HAS_INT128)
+        return false == __builtin_sub_overflow(lhs, rhs, &out);
+#else
+        return false;
+#endif
+    }
+    static auto to_string(const Small rhs) -> UnallocatedCString
+    {
+        const auto negative = rhs < 0;
+        auto magnitude = negative ? UnsignedSmall(0) - UnsignedSmall(rhs)
+                                  : UnsignedSmall(rhs);
+        // 2^128 has 39 decimal digits
+        auto buffer = std::array<char, 41>{};
+        auto* end = buffer.data() + buffer.size();
+        auto* i = end;
+
+        do {
+            *(--i) =
+                static_cast<char>('0' + static_cast<int>(magnitude % 10u));
+            magnitude /= 10u;
+        } while (0u < magnitude);
+
+        if (negative) { *(--i) = '-'; }
+
+        return UnallocatedCString{i, end};
+    }
+    // NOTE rounds toward zero to match shift_right()
+    static auto truncate(const Small rhs) noexcept -> Small
+    {
+        return rhs / scale_;
+    }
+
+    auto big() const noexcept -> amount::Integer
+    {
+        return small_.has_value() ? promote(*small_) : amount_;
+    }
+    auto both_small(const Imp& rhs) const noexcept -> bool
+    {
+        return small_.has_value() && rhs.small_.has_value();
+    }
+    auto compare(const Imp& rhs) const noexcept -> int
+    {
+        if (both_small(rhs)) {
+            const auto& lhs = *small_;
+            const auto& other = *rhs.small_;
+
+            return (lhs < other) ? -1 : ((other < lhs) ? 1 : 0);
+        }
+
+        return big().compare(rhs.big());
+    }
+
+    Imp(Native, const Small value) noexcept
+        : small_{value}
+        , amount_{}
+    {
+    }
+    template <typename T>
+    Imp(const Small value, const T amount) noexcept
+        : small_{}
+        , amount_{}
+    {
+        auto out = Small{};
+        const auto fits =
+            (small_max_ / scale_ >= value) && (small_min_ / scale_ <= value);
+
+        if (fits && (static_cast<T>(value) == amount) &&
+            mul(value, scale_, out)) {
+            small_ = out;
+        } else {
+            amount_ = shift_left(amount);
+        }
+    }
 };
 }  // namespace opentxs
@@ -13,6 +13,7 @@
 #include <stdexcept>
 #include <utility>
 
+#include "crypto/library/VerificationCache.hpp"
 #include "internal/api/crypto/Symmetric.hpp"
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/crypto/key/Key.hpp"
@@ -801,11 +802,17 @@ auto Asymmetric::Verify(const Data& plaintext, const proto::Signature& sig)
         return false;
     }
 
-    const auto output = engine().Verify(
+    const auto hashType = translate(sig.hashtype());
+    const auto output = crypto::VerificationCache::Get().Check(
+        api_,
         plaintext.Bytes(),
         PublicKey(),
         sig.signature(),
-        translate(sig.hashtype()));
+        hashType,
+        [&] {
+            return engine().Verify(
+                plaintext.Bytes(), PublicKey(), sig.signature(), hashType);
+        });
 
     if (false == output) {
         LogError()(OT_PRETTY_CLASS())("Invalid signature").Flush();
@@ -14,6 +14,7 @@ extern "C" {
 #include <cstddef>
 #include <cstring>
 
+#include "crypto/library/VerificationCache.hpp"
 #include "internal/otx/common/crypto/Signature.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/OT.hpp"
@@ -204,6 +205,9 @@ auto AsymmetricProvider::VerifyContractSignature(
         return out;
     }();
 
-    return Verify(reader(plaintext), key, signature->Bytes(), hashType);
+    return VerificationCache::Get().Check(
+        api, reader(plaintext), key, signature->Bytes(), hashType, [&] {
+            return Verify(reader(plaintext), key, signature->Bytes(), hashType);
+        });
 }
 }  // namespace opentxs::crypto::implementation
@@ -0,0 +1,154 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                           // IWYU pragma: associated
+#include "1_Internal.hpp"                         // IWYU pragma: associated
+#include "crypto/library/VerificationCache.hpp"  // IWYU pragma: associated
+
+#include <cstring>
+#include <utility>
+
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/Session.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs::crypto
+{
+VerificationCache::VerificationCache(const std::size_t limit) noexcept
+    : limit_(limit)
+    , lock_()
+    , lru_()
+    , index_()
+    , hits_(0)
+    , misses_(0)
+{
+}
+
+auto VerificationCache::Get() noexcept -> VerificationCache&
+{
+    static auto cache = VerificationCache{65536};
+
+    return cache;
+}
+
+auto VerificationCache::add(Key&& key) noexcept -> void
+{
+    auto lock = Lock{lock_};
+
+    if (0u < index_.count(key)) { return; }
+
+    lru_.emplace_front(std::move(key));
+    index_.emplace(lru_.front(), lru_.begin());
+
+    while (lru_.size() > limit_) {
+        index_.erase(lru_.back());
+        lru_.pop_back();
+    }
+}
+
+auto VerificationCache::Check(
+    const api::Session& api,
+    const ReadView plaintext,
+    const ReadView pubkey,
+    const ReadView signature,
+    const crypto::HashType type,
+    const Verify& verify) noexcept -> bool
+{
+    auto id = key(api, plaintext, pubkey, signature, type);
+
+    if (false == id.has_value()) { return verify(); }
+
+    if (find(*id)) {
+        if (0u == (++hits_ % report_interval_)) { report(); }
+
+        return true;
+    }
+
+    if (0u == (++misses_ % report_interval_)) { report(); }
+
+    if (false == verify()) { return false; }
+
+    add(std::move(*id));
+
+    return true;
+}
+
+auto VerificationCache::find(const Key& key) noexcept -> bool
+{
+    auto lock = Lock{lock_};
+    const auto i = index_.find(key);
+
+    if (index_.end() == i) { return false; }
+
+    lru_.splice(lru_.begin(), lru_, i->second);
+
+    return true;
+}
+
+auto VerificationCache::GetStats() const noexcept -> Stats
+{
+    auto lock = Lock{lock_};
+
+    return {hits_.load(), misses_.load(), lru_.size()};
+}
+
+auto VerificationCache::key(
+    const api::Session& api,
+    const ReadView plaintext,
+    const ReadView pubkey,
+    const ReadView signature,
+    const crypto::HashType type) noexcept -> std::optional<Key>
+{
+    auto output = Key{
+        type, UnallocatedCString{pubkey}, UnallocatedCString{signature}, {}};
+    auto& digest = output.digest_;
+
+    if (false == api.Crypto().Hash().Digest(
+                     crypto::HashType::Blake2b256,
+                     plaintext,
+                     preallocated(digest.size(), digest.data()))) {
+        LogError()(OT_PRETTY_STATIC(VerificationCache))(
+            "Failed to calculate cache key")
+            .Flush();
+
+        return std::nullopt;
+    }
+
+    return output;
+}
+
+auto VerificationCache::Key::operator==(const Key& rhs) const noexcept -> bool
+{
+    return (type_ == rhs.type_) && (digest_ == rhs.digest_) &&
+           (signature_ == rhs.signature_) && (pubkey_ == rhs.pubkey_);
+}
+
+auto VerificationCache::KeyHash::operator()(const Key& key) const noexcept
+    -> std::size_t
+{
+    // NOTE the digest is cryptographic so no further hashing is required
+    auto output = std::size_t{};
+
+    static_assert(sizeof(output) <= sizeof(key.digest_));
+
+    std::memcpy(&output, key.digest_.data(), sizeof(output));
+
+    return output;
+}
+
+auto VerificationCache::report() const noexcept -> void
+{
+    const auto stats = GetStats();
+    const auto total = stats.hits_ + stats.misses_;
+    const auto rate = (0u == total) ? 0u : ((100u * stats.hits_) / total);
+    LogDetail()(OT_PRETTY_CLASS())("signature verification cache: ")(
+        stats.size_)(" entries, ")(stats.hits_)(" hits, ")(stats.misses_)(
+        " misses (")(rate)("% hit rate)")
+        .Flush();
+}
+}  // namespace opentxs::crypto
@@ -0,0 +1,111 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <robin_hood.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+#include "opentxs/crypto/HashType.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace api
+{
+class Session;
+}  // namespace api
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::crypto
+{
+// Process-wide record of signatures which have already been verified
+// successfully. Entries hold the hash type, public key and signature along
+// with a BLAKE2b-256 digest of the signed content, which is hashed in place.
+// Failed verifications are never cached.
+class VerificationCache
+{
+public:
+    struct Stats {
+        std::uint64_t hits_{};
+        std::uint64_t misses_{};
+        std::size_t size_{};
+    };
+
+    using Verify = std::function<bool()>;
+
+    static auto Get() noexcept -> VerificationCache&;
+
+    auto Check(
+        const api::Session& api,
+        const ReadView plaintext,
+        const ReadView key,
+        const ReadView signature,
+        const crypto::HashType type,
+        const Verify& verify) noexcept -> bool;
+    auto GetStats() const noexcept -> Stats;
+
+    VerificationCache(const std::size_t limit) noexcept;
+
+    ~VerificationCache() = default;
+
+private:
+    using Digest = std::array<std::byte, 32>;
+
+    struct Key {
+        crypto::HashType type_{};
+        UnallocatedCString pubkey_{};
+        UnallocatedCString signature_{};
+        Digest digest_{};
+
+        auto operator==(const Key& rhs) const noexcept -> bool;
+    };
+
+    struct KeyHash {
+        auto operator()(const Key& key) const noexcept -> std::size_t;
+    };
+
+    using LRU = UnallocatedList<Key>;
+    using Index = robin_hood::unordered_flat_map<Key, LRU::iterator, KeyHash>;
+
+    static constexpr auto report_interval_ = std::uint64_t{65536};
+
+    const std::size_t limit_;
+    mutable std::mutex lock_;
+    LRU lru_;
+    Index index_;
+    std::atomic<std::uint64_t> hits_;
+    std::atomic<std::uint64_t> misses_;
+
+    static auto key(
+        const api::Session& api,
+        const ReadView plaintext,
+        const ReadView key,
+        const ReadView signature,
+        const crypto::HashType type) noexcept -> std::optional<Key>;
+
+    auto add(Key&& key) noexcept -> void;
+    auto find(const Key& key) noexcept -> bool;
+    auto report() const noexcept -> void;
+
+    VerificationCache() = delete;
+    VerificationCache(const VerificationCache&) = delete;
+    VerificationCache(VerificationCache&&) = delete;
+    auto operator=(const VerificationCache&) -> VerificationCache& = delete;
+    auto operator=(VerificationCache&&) -> VerificationCache& = delete;
+};
+}  // namespace opentxs::crypto
@@ -100,6 +100,14 @@ auto AccountActivityQt::balancePolarity() const noexcept -> int
     return imp_->parent_.BalancePolarity();
 }
 
+auto AccountActivityQt::canFetchMore(const QModelIndex& parent) const noexcept
+    -> bool
+{
+    if (parent.isValid()) { return false; }
+
+    return imp_->parent_.CanLoadMore();
+}
+
 auto AccountActivityQt::depositChains() const noexcept -> QVariantList
 {
     const auto input = imp_->parent_.DepositChains();
@@ -116,6 +124,13 @@ auto AccountActivityQt::displayBalance() const noexcept -> QString
     return imp_->parent_.DisplayBalance().c_str();
 }
 
+auto AccountActivityQt::fetchMore(const QModelIndex& parent) noexcept -> void
+{
+    if (parent.isValid()) { return; }
+
+    imp_->parent_.LoadMore();
+}
+
 auto AccountActivityQt::getAmountValidator() const noexcept -> AmountValidator*
 {
     return &imp_->parent_.AmountValidator();
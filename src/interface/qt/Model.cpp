@@ -8,8 +8,10 @@
 #include "opentxs/interface/qt/Model.hpp"  // IWYU pragma: associated
 
 #include <QByteArray>
+#include <QTimer>
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -26,6 +28,7 @@
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Options.hpp"
 
 namespace opentxs::ui::qt::internal
 {
@@ -82,6 +85,14 @@ struct Model::Imp {
         auto lock = Lock{data_lock_};
         do_move_row(lock, newParent, newBefore, row);
     }
+    auto FinishUpdates() noexcept -> void
+    {
+        scheduled_ = false;
+
+        for (auto& op : queue_) { commit(op); }
+
+        queue_.clear();
+    }
     auto GetChild(const ui::internal::Row* parent, int index) const noexcept
         -> ui::internal::Row*
     {
@@ -168,6 +179,10 @@ struct Model::Imp {
     }
 
     auto GetRoot() const noexcept -> QObject* { return qt_parent_; }
+    auto GetUpdateInterval() const noexcept -> std::chrono::milliseconds
+    {
+        return interval_;
+    }
 
     auto GetRowCount(ui::internal::Row* row) const noexcept -> int
     {
@@ -208,6 +223,24 @@ struct Model::Imp {
             do_move_row(lock, newParent, newBefore, row);
         }
     }
+    auto QueueUpdate(qt::Model& model, Update&& op) noexcept -> void
+    {
+        if (0 == interval_.count()) {
+            auto queue = Queue{};
+            queue.emplace_back(std::move(op));
+            replay(model, queue);
+
+            return;
+        }
+
+        queue_.emplace_back(std::move(op));
+
+        if (false == scheduled_) {
+            scheduled_ = true;
+            QTimer::singleShot(
+                interval_, &model, [this, &model] { flush(model); });
+        }
+    }
     auto SetColumnCount(Row* parent, int count) noexcept -> void
     {
         auto lock = Lock{data_lock_};
@@ -233,18 +266,24 @@ struct Model::Imp {
         role_data_ = std::move(data);
     }
 
-    Imp(QObject* parent) noexcept
+    Imp(QObject* parent, std::chrono::milliseconds interval) noexcept
         : parent_lock_()
         , data_lock_()
         , qt_parent_(parent)
+        , interval_(interval)
         , parent_(nullptr)
         , role_data_()
         , map_()
+        , queue_()
+        , scheduled_(false)
     {
         map_[ID(nullptr)];
     }
 
 private:
+    using Queue = UnallocatedVector<Update>;
+    using Iterator = Queue::iterator;
+
     struct RowData {
         const ui::internal::Row* parent_;
         const std::shared_ptr<ui::internal::Row> pointer_;
@@ -334,14 +373,106 @@ private:
 
     static constexpr auto root_row_id_ = RowID{-1};
     static constexpr auto invalid_index_{-1};
+    static constexpr auto reset_threshold_ = std::size_t{256};
 
     mutable std::mutex parent_lock_;
     mutable std::mutex data_lock_;
     QObject* qt_parent_;
+    const std::chrono::milliseconds interval_;
     std::atomic<qt::Model*> parent_;
     RoleData role_data_;
     UnallocatedMap<RowID, RowData> map_;
+    // NOTE the update queue is only accessed from the thread of the qt::Model
+    // which delivers the updates
+    Queue queue_;
+    bool scheduled_;
+
+    auto changed(
+        qt::Model& model,
+        const UnallocatedMap<int, ui::internal::Row*>& rows) noexcept -> void
+    {
+        const auto announce = [&](auto first, auto last, int columns) {
+            if (0 >= columns) { return; }
+
+            const auto topLeft = model.make_index(GetIndex(first->second));
+            const auto bottomRight =
+                model.createIndex(last->first, columns - 1, last->second);
+            emit model.dataChanged(topLeft, bottomRight, {});
+        };
+        auto first = rows.begin();
+        auto last = first;
+        auto columns = GetColumnCount(first->second);
+
+        for (auto i = std::next(first); rows.end() != i; ++i) {
+            if (i->first > (last->first + 1)) {
+                announce(first, last, columns);
+                first = i;
+                columns = invalid_index_;
+            }
+
+            last = i;
+            columns = std::max(columns, GetColumnCount(i->second));
+        }
 
+        announce(first, last, columns);
+    }
+    auto changed(qt::Model& model, ui::internal::Row* parent) noexcept -> void
+    {
+        const auto ancestor = model.make_index(GetIndex(parent));
+        const auto rows = GetRowCount(parent);
+        const auto columns = GetColumnCount(parent);
+
+        if ((0 < rows) && (0 < columns)) {
+            emit model.dataChanged(
+                model.index(0, 0, ancestor),
+                model.index(rows - 1, columns - 1, ancestor),
+                {});
+        }
+    }
+    auto changes(qt::Model& model, Iterator i, const Iterator end) noexcept
+        -> Iterator
+    {
+        auto rows = UnallocatedMap<
+            ui::internal::Row*,
+            UnallocatedMap<int, ui::internal::Row*>>{};
+        auto all = UnallocatedSet<ui::internal::Row*>{};
+
+        for (; (end != i) && (Update::Type::change == i->type_); ++i) {
+            if (nullptr == i->row_) {
+                all.emplace(i->parent_);
+            } else {
+                const auto index = GetIndex(i->row_);
+
+                if (index.valid_) { rows[i->parent_][index.row_] = i->row_; }
+            }
+        }
+
+        for (auto* parent : all) {
+            rows.erase(parent);
+            changed(model, parent);
+        }
+
+        for (const auto& [parent, indices] : rows) { changed(model, indices); }
+
+        return i;
+    }
+    auto commit(Update& op) noexcept -> void
+    {
+        switch (op.type_) {
+            case Update::Type::remove: {
+                do_delete_row(op.row_);
+            } break;
+            case Update::Type::insert: {
+                do_insert_row(op.parent_, op.after_, std::move(op.pointer_));
+            } break;
+            case Update::Type::move: {
+                do_move_row(op.parent_, op.after_, op.row_);
+            } break;
+            case Update::Type::change:
+            default: {
+            }
+        }
+    }
     auto do_delete_row(const Lock&, const ui::internal::Row* item) noexcept
         -> void
     {
@@ -440,6 +571,24 @@ private:
         }
     }
 
+    auto flush(qt::Model& model) noexcept -> void
+    {
+        scheduled_ = false;
+        auto queue = Queue{};
+        queue.swap(queue_);
+
+        if (queue.empty()) { return; }
+
+        if (reset_threshold_ < queue.size()) {
+            model.beginResetModel();
+
+            for (auto& op : queue) { commit(op); }
+
+            model.endResetModel();
+        } else {
+            replay(model, queue);
+        }
+    }
     auto get_helper() noexcept -> ModelHelper&
     {
         static thread_local auto map =
@@ -450,6 +599,89 @@ private:
         return it->second;
     }
 
+    auto inserts(qt::Model& model, Iterator i, const Iterator end) noexcept
+        -> Iterator
+    {
+        auto* parent = i->parent_;
+        auto* after = i->after_;
+        auto block = UnallocatedSet<const ui::internal::Row*>{after};
+        auto stop = i;
+
+        // NOTE every row in the run is inserted either after the row preceding
+        // the run or after another row from the run, so the run occupies a
+        // contiguous range once all of its rows have been inserted
+        for (; (end != stop) && (Update::Type::insert == stop->type_) &&
+               (parent == stop->parent_) && (0 < block.count(stop->after_));
+             ++stop) {
+            block.emplace(stop->pointer_.get());
+        }
+
+        const auto ancestor = model.make_index(GetIndex(parent));
+        const auto pos = [&] {
+            if (nullptr == after) { return 0; }
+
+            return GetIndex(after).row_ + 1;
+        }();
+        const auto count = static_cast<int>(std::distance(i, stop));
+        model.beginInsertRows(ancestor, pos, pos + count - 1);
+
+        for (; i != stop; ++i) { commit(*i); }
+
+        model.endInsertRows();
+
+        return stop;
+    }
+    auto move(qt::Model& model, Update& op) noexcept -> void
+    {
+        const auto from = model.make_index(GetParent(op.row_));
+        const auto to = model.make_index(GetIndex(op.parent_));
+        const auto start = GetIndex(op.row_).row_;
+        const auto end = [&] {
+            if (nullptr == op.after_) { return 0; }
+
+            return GetIndex(op.after_).row_ + 1;
+        }();
+
+        if (model.beginMoveRows(from, start, start, to, end)) {
+            commit(op);
+            model.endMoveRows();
+        } else {
+            OT_FAIL;
+        }
+    }
+    auto remove(qt::Model& model, Update& op) noexcept -> void
+    {
+        const auto parent = model.make_index(GetParent(op.row_));
+        const auto start = GetIndex(op.row_).row_;
+        model.beginRemoveRows(parent, start, start);
+        commit(op);
+        model.endRemoveRows();
+    }
+    auto replay(qt::Model& model, Queue& queue) noexcept -> void
+    {
+        const auto end = queue.end();
+
+        for (auto i = queue.begin(); end != i;) {
+            switch (i->type_) {
+                case Update::Type::change: {
+                    i = changes(model, i, end);
+                } break;
+                case Update::Type::insert: {
+                    i = inserts(model, i, end);
+                } break;
+                case Update::Type::remove: {
+                    remove(model, *i);
+                    ++i;
+                } break;
+                case Update::Type::move:
+                default: {
+                    move(model, *i);
+                    ++i;
+                }
+            }
+        }
+    }
+
     Imp() = delete;
     Imp(const Imp&) = delete;
     Imp(Imp&&) = delete;
@@ -457,8 +689,8 @@ private:
     Imp& operator=(Imp&&) = delete;
 };
 
-Model::Model(QObject* parent) noexcept
-    : imp_(std::make_unique<Imp>(parent).release())
+Model::Model(QObject* parent, std::chrono::milliseconds interval) noexcept
+    : imp_(std::make_unique<Imp>(parent, interval).release())
 {
     static const auto wrapperType = qRegisterMetaType<RowWrapper>();
     static const auto pointerType = qRegisterMetaType<ui::internal::Row*>();
@@ -501,6 +733,8 @@ auto Model::do_move_row(
     imp_->do_move_row(newParent, newBefore, row);
 }
 
+auto Model::finish_updates() noexcept -> void { imp_->FinishUpdates(); }
+
 auto Model::GetChild(ui::internal::Row* parent, int index) const noexcept
     -> ui::internal::Row*
 {
@@ -539,6 +773,11 @@ auto Model::GetRowCount(ui::internal::Row* row) const noexcept -> int
     return imp_->GetRowCount(row);
 }
 
+auto Model::GetUpdateInterval() const noexcept -> std::chrono::milliseconds
+{
+    return imp_->GetUpdateInterval();
+}
+
 auto Model::InsertRow(
     ui::internal::Row* parent,
     ui::internal::Row* after,
@@ -555,6 +794,11 @@ auto Model::MoveRow(
     imp_->MoveRow(newParent, newBefore, row);
 }
 
+auto Model::queue_update(qt::Model& model, Update&& op) noexcept -> void
+{
+    imp_->QueueUpdate(model, std::move(op));
+}
+
 auto Model::SetColumnCount(Row* parent, int count) noexcept -> void
 {
     imp_->SetColumnCount(parent, count);
@@ -724,24 +968,19 @@ auto Model::changeRow(
     ui::internal::Row* parent,
     ui::internal::Row* item) noexcept -> void
 {
+    using Type = internal::Model::Update::Type;
+
     if (nullptr != internal_) {
-        const auto topLeft = make_index(internal_->GetIndex(item));
-        const auto bottomRight = createIndex(
-            topLeft.row(),
-            internal_->GetColumnCount(item) - 1,
-            topLeft.internalPointer());
-        emit dataChanged(topLeft, bottomRight, {});
+        internal_->queue_update(*this, {Type::change, parent, nullptr, item});
     }
 }
 
 auto Model::deleteRow(ui::internal::Row* item) noexcept -> void
 {
+    using Type = internal::Model::Update::Type;
+
     if (nullptr != internal_) {
-        const auto parent = make_index(internal_->GetParent(item));
-        const auto start = internal_->GetIndex(item).row_;
-        beginRemoveRows(parent, start, start);
-        internal_->do_delete_row(item);
-        endRemoveRows();
+        internal_->queue_update(*this, {Type::remove, nullptr, nullptr, item});
     }
 }
 
@@ -750,18 +989,13 @@ auto Model::insertRow(
     ui::internal::Row* after,
     RowWrapper wrapper) noexcept -> void
 {
+    using Type = internal::Model::Update::Type;
     auto& row = wrapper.row_;
+    auto* item = row.get();
 
     if (nullptr != internal_) {
-        const auto ancestor = make_index(internal_->GetIndex(parent));
-        const auto pos = [&] {
-            if (nullptr == after) { return 0; }
-
-            return internal_->GetIndex(after).row_ + 1;
-        }();
-        beginInsertRows(ancestor, pos, pos);
-        internal_->do_insert_row(parent, after, row);
-        endInsertRows();
+        internal_->queue_update(
+            *this, {Type::insert, parent, after, item, std::move(row)});
     }
 }
 
@@ -770,22 +1004,11 @@ auto Model::moveRow(
     ui::internal::Row* newBefore,
     ui::internal::Row* item) noexcept -> void
 {
-    if (nullptr != internal_) {
-        const auto from = make_index(internal_->GetParent(item));
-        const auto to = make_index(internal_->GetIndex(newParent));
-        const auto start = internal_->GetIndex(item).row_;
-        const auto end = [&] {
-            if (nullptr == newBefore) { return 0; }
+    using Type = internal::Model::Update::Type;
 
-            return internal_->GetIndex(newBefore).row_ + 1;
-        }();
-
-        if (beginMoveRows(from, start, start, to, end)) {
-            internal_->do_move_row(newParent, newBefore, item);
-            endMoveRows();
-        } else {
-            OT_FAIL;
-        }
+    if (nullptr != internal_) {
+        internal_->queue_update(
+            *this, {Type::move, newParent, newBefore, item});
     }
 }
 
@@ -878,6 +1101,7 @@ Model::~Model()
     setParent(nullptr);
 
     if (nullptr != internal_) {
+        internal_->finish_updates();
         internal_->ClearParent();
         internal_ = nullptr;
     }
@@ -888,7 +1112,8 @@ namespace opentxs::ui::internal
 {
 auto List::MakeQT(const api::Session& api) noexcept -> ui::qt::internal::Model*
 {
-    return std::make_unique<ui::qt::internal::Model>(api.QtRootObject())
+    return std::make_unique<ui::qt::internal::Model>(
+               api.QtRootObject(), api.GetOptions().UIUpdateInterval())
         .release();
 }
 }  // namespace opentxs::ui::internal
@@ -23,6 +23,7 @@
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/block/Types.hpp"
 #include "opentxs/core/Amount.hpp"
 #include "opentxs/core/Types.hpp"
 #include "opentxs/core/contract/ServerContract.hpp"
@@ -139,6 +140,11 @@ public:
 
         return polarity(balance_);
     }
+    auto BlockchainHeight() const noexcept -> blockchain::block::Height override
+    {
+        return -1;
+    }
+    auto CanLoadMore() const noexcept -> bool override { return false; }
     auto ClearCallbacks() const noexcept -> void final;
     auto Contract() const noexcept -> const contract::Unit& final
     {
@@ -164,6 +170,7 @@ public:
 
         return display_balance(balance_);
     }
+    auto LoadMore() const noexcept -> void override {}
     auto Notary() const noexcept -> const contract::Server& final
     {
         return notary_.get();
@@ -7,9 +7,12 @@
 #include "1_Internal.hpp"  // IWYU pragma: associated
 #include "interface/ui/accountactivity/BlockchainAccountActivity.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <functional>
 #include <future>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <string_view>
@@ -31,13 +34,18 @@
 #include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Endpoints.hpp"
 #include "opentxs/api/session/Factory.hpp"
+#include "opentxs/api/session/Storage.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"
 #include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
 #include "opentxs/blockchain/crypto/Account.hpp"
 #include "opentxs/blockchain/crypto/AddressStyle.hpp"
 #include "opentxs/blockchain/node/HeaderOracle.hpp"
 #include "opentxs/blockchain/node/Manager.hpp"
+#include "opentxs/blockchain/node/TxoState.hpp"
+#include "opentxs/blockchain/node/Wallet.hpp"
 #include "opentxs/core/AccountType.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/PaymentCode.hpp"
@@ -96,6 +104,11 @@ BlockchainAccountActivity::BlockchainAccountActivity(
           zmq::socket::Direction::Connect))
     , progress_()
     , height_(0)
+    , requested_(load_batch_)
+    , available_(0)
+    , loaded_()
+    , foreign_()
+    , pending_()
 {
     const auto connected = balance_socket_->Start(
         Widget::api_.Endpoints().BlockchainBalance().data());
@@ -120,6 +133,11 @@ BlockchainAccountActivity::BlockchainAccountActivity(
     }());
 }
 
+auto BlockchainAccountActivity::CanLoadMore() const noexcept -> bool
+{
+    return (requested_.load() + prefetch_) < available_.load();
+}
+
 auto BlockchainAccountActivity::DepositAddress(
     const blockchain::Type chain) const noexcept -> UnallocatedCString
 {
@@ -146,28 +164,160 @@ auto BlockchainAccountActivity::display_balance(
 
 auto BlockchainAccountActivity::load_thread() noexcept -> void
 {
-    const auto transactions =
-        [&]() -> UnallocatedVector<blockchain::block::pTxid> {
-        try {
-            const auto& chain =
-                Widget::api_.Network().Blockchain().GetChain(chain_);
-            height_ = chain.HeaderOracle().BestChain().first;
+    using Height = blockchain::block::Height;
+    using Txid = blockchain::block::pTxid;
+    using State = blockchain::node::TxoState;
+
+    struct Candidate {
+        // NOTE transactions of unknown height are treated as the most recent
+        Height height_{std::numeric_limits<Height>::max()};
+        bool exact_{false};
+    };
 
-            return chain.Internal().GetTransactions(primary_id_);
-        } catch (...) {
+    auto index = UnallocatedMap<Txid, Candidate>{};
+
+    try {
+        const auto& chain =
+            Widget::api_.Network().Blockchain().GetChain(chain_);
+        height_.store(chain.HeaderOracle().BestChain().first);
 
-            return {};
+        for (auto& txid : chain.Internal().GetTransactions(primary_id_)) {
+            index.try_emplace(std::move(txid));
         }
-    }();
+
+        // NOTE the wallet already knows the height at which every output was
+        // mined so the index can be ordered without loading any transactions.
+        // The mined position of a confirmed spend belongs to the spending
+        // transaction so it only bounds the height of the transaction which
+        // created the output.
+        const auto outputs =
+            chain.Wallet().GetOutputs(primary_id_, State::All);
+
+        for (const auto& [outpoint, output] : outputs) {
+            const auto txid =
+                Widget::api_.Factory().DataFromBytes(outpoint.Txid());
+            auto i = index.find(txid);
+
+            if (index.end() == i) { continue; }
+
+            auto& [height, exact] = i->second;
+            const auto mined = output->Internal().MinedPosition().first;
+
+            switch (output->Internal().State()) {
+                case State::ConfirmedSpend:
+                case State::OrphanedSpend: {
+                    if (false == exact) { height = std::min(height, mined); }
+                } break;
+                default: {
+                    height = mined;
+                    exact = true;
+                }
+            }
+        }
+    } catch (...) {
+    }
+
+    // NOTE transactions which spend from the account without creating any
+    // outputs for it are not in the wallet index. The nym's activity records
+    // include them but are not separated by chain, so they compete for the
+    // requested range with the indexed transactions until they have been
+    // loaded once. The ones which belong to other chains are then remembered
+    // in foreign_ and skipped.
+    const auto activity =
+        Widget::api_.Storage().BlockchainTransactionList(primary_id_);
+    auto extra = UnallocatedSet<Txid>{};
+
+    for (const auto& txid : activity) {
+        if (0u < foreign_.count(txid)) {
+            extra.emplace(txid);
+
+            continue;
+        }
+
+        auto [i, added] = index.try_emplace(txid);
+
+        if (false == added) { continue; }
+
+        if (auto j = loaded_.find(txid); loaded_.end() != j) {
+            const auto height = j->second;
+
+            if (0 <= height) { i->second = {height, true}; }
+        }
+    }
+
+    for (auto i = foreign_.begin(); i != foreign_.end();) {
+        if (0u == extra.count(*i)) {
+            i = foreign_.erase(i);
+        } else {
+            ++i;
+        }
+    }
+
     auto active = UnallocatedSet<AccountActivityRowID>{};
+    const auto is_stale = [&](const Txid& txid, const Candidate& candidate) {
+        const auto i = loaded_.find(txid);
+
+        if (loaded_.end() == i) { return true; }
+
+        const auto& loaded = i->second;
 
-    for (const auto& txid : transactions) {
-        if (const auto id = process_txid(txid); id.has_value()) {
-            active.emplace(id.value());
+        if (candidate.exact_) { return loaded != candidate.height_; }
+
+        // NOTE an unconfirmed transaction may have been mined since it was
+        // loaded. Reorgs are handled by process_reorg.
+        return 0 > loaded;
+    };
+
+    for (auto i = loaded_.begin(); i != loaded_.end();) {
+        const auto& txid = i->first;
+
+        if (0u == index.count(txid)) {
+            i = loaded_.erase(i);
+        } else {
+            ++i;
         }
     }
 
+    // NOTE only the most recent transactions in the index are loaded, up to
+    // the number requested by views plus the prefetch margin
+    static const auto recency = [](const Height height) {
+        return (0 > height) ? std::numeric_limits<Height>::max() : height;
+    };
+    auto order = UnallocatedVector<std::pair<Height, const Txid*>>{};
+    order.reserve(index.size());
+
+    for (const auto& [txid, candidate] : index) {
+        active.emplace(row_id(txid));
+        order.emplace_back(recency(candidate.height_), &txid);
+    }
+
+    const auto window = std::min(order.size(), requested_.load() + prefetch_);
+    std::partial_sort(
+        order.begin(),
+        std::next(order.begin(), window),
+        order.end(),
+        [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    order.resize(window);
+    available_.store(index.size());
+    pending_.clear();
+    pending_.reserve(order.size());
+
+    // NOTE pending_ is consumed from the back so the most recent transactions
+    // (starting with unconfirmed ones) are loaded first
+    for (auto i = order.rbegin(); i != order.rend(); ++i) {
+        const auto& txid = *(i->second);
+
+        if (is_stale(txid, index.at(txid))) { pending_.emplace_back(txid); }
+    }
+
     delete_inactive(active);
+
+    if (state_machine()) { trigger(); }
+}
+
+auto BlockchainAccountActivity::LoadMore() const noexcept -> void
+{
+    pipeline_.Push(MakeWork(Work::load));
 }
 
 auto BlockchainAccountActivity::pipeline(const Message& in) noexcept -> void
@@ -219,6 +369,9 @@ auto BlockchainAccountActivity::pipeline(const Message& in) noexcept -> void
         case Work::sync: {
             process_sync(in);
         } break;
+        case Work::load: {
+            process_load();
+        } break;
         case Work::init: {
             startup();
             finish_startup();
@@ -245,6 +398,7 @@ auto BlockchainAccountActivity::print(Work type) noexcept -> const char*
         {Work::reorg, "reorg"},
         {Work::statechange, "statechange"},
         {Work::sync, "sync"},
+        {Work::load, "load"},
         {Work::init, "init"},
         {Work::statemachine, "statemachine"},
     };
@@ -337,9 +491,18 @@ auto BlockchainAccountActivity::process_contact(const Message& in) noexcept
 auto BlockchainAccountActivity::process_height(
     const blockchain::block::Height height) noexcept -> void
 {
-    if (height == height_) { return; }
+    if (height == height_.exchange(height)) { return; }
 
-    height_ = height;
+    // NOTE rows calculate their confirmations on demand so the only work
+    // required here is to inform any views that displayed values may differ
+    rows_modified();
+}
+
+auto BlockchainAccountActivity::process_load() noexcept -> void
+{
+    if (false == CanLoadMore()) { return; }
+
+    requested_ += load_batch_;
     load_thread();
 }
 
@@ -354,7 +517,20 @@ auto BlockchainAccountActivity::process_reorg(const Message& in) noexcept
 
     if (chain != chain_) { return; }
 
+    const auto ancestor = body.at(3).as<blockchain::block::Height>();
     process_height(body.at(5).as<blockchain::block::Height>());
+
+    // NOTE transactions mined above the common ancestor will be reloaded, all
+    // others are left alone
+    for (auto i = loaded_.begin(); i != loaded_.end();) {
+        if (i->second > ancestor) {
+            i = loaded_.erase(i);
+        } else {
+            ++i;
+        }
+    }
+
+    load_thread();
 }
 
 auto BlockchainAccountActivity::process_state(const Message& in) noexcept
@@ -431,25 +607,22 @@ auto BlockchainAccountActivity::process_txid(const Message& in) noexcept -> void
 auto BlockchainAccountActivity::process_txid(const Data& txid) noexcept
     -> std::optional<AccountActivityRowID>
 {
-    const auto rowID = AccountActivityRowID{
-        blockchain_thread_item_id(Widget::api_.Crypto(), chain_, txid),
-        proto::PAYMENTEVENTTYPE_COMPLETE};
+    const auto rowID = row_id(txid);
     auto pTX = Widget::api_.Crypto().Blockchain().LoadTransactionBitcoin(txid);
 
     if (false == bool(pTX)) { return std::nullopt; }
 
     const auto& tx = pTX->Internal();
+    const auto mined = tx.ConfirmationHeight();
+    loaded_.insert_or_assign(OTData{txid}, mined);
 
-    if (false == contains(tx.Chains(), chain_)) { return std::nullopt; }
-
-    const auto sortKey{tx.Timestamp()};
-    const auto conf = [&]() -> int {
-        const auto height = tx.ConfirmationHeight();
+    if (false == contains(tx.Chains(), chain_)) {
+        foreign_.emplace(OTData{txid});
 
-        if ((0 > height) || (height > height_)) { return 0; }
+        return std::nullopt;
+    }
 
-        return static_cast<int>(height_ - height) + 1;
-    }();
+    const auto sortKey{tx.Timestamp()};
     auto custom = CustomData{
         new proto::PaymentWorkflow(),
         new proto::PaymentEvent(),
@@ -459,13 +632,21 @@ auto BlockchainAccountActivity::process_txid(const Data& txid) noexcept
             Widget::api_.Crypto().Blockchain().ActivityDescription(
                 primary_id_, chain_, tx)},
         new OTData{tx.ID()},
-        new int{conf},
+        new blockchain::block::Height{mined},
     };
     add_item(rowID, sortKey, custom);
 
     return std::move(rowID);
 }
 
+auto BlockchainAccountActivity::row_id(const Data& txid) const noexcept
+    -> AccountActivityRowID
+{
+    return {
+        blockchain_thread_item_id(Widget::api_.Crypto(), chain_, txid),
+        proto::PAYMENTEVENTTYPE_COMPLETE};
+}
+
 auto BlockchainAccountActivity::Send(
     const UnallocatedCString& address,
     const Amount& amount,
@@ -508,6 +689,18 @@ auto BlockchainAccountActivity::Send(
 
 auto BlockchainAccountActivity::startup() noexcept -> void { load_thread(); }
 
+auto BlockchainAccountActivity::state_machine() noexcept -> bool
+{
+    for (auto i = std::size_t{0}; i < load_batch_; ++i) {
+        if (pending_.empty()) { break; }
+
+        process_txid(pending_.back());
+        pending_.pop_back();
+    }
+
+    return false == pending_.empty();
+}
+
 auto BlockchainAccountActivity::ValidateAddress(
     const UnallocatedCString& in) const noexcept -> bool
 {
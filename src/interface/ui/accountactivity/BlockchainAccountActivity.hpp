@@ -8,6 +8,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <mutex>
 #include <optional>
 #include <string_view>
@@ -95,6 +96,11 @@ namespace opentxs::ui::implementation
 class BlockchainAccountActivity final : public AccountActivity
 {
 public:
+    auto BlockchainHeight() const noexcept -> blockchain::block::Height final
+    {
+        return height_.load();
+    }
+    auto CanLoadMore() const noexcept -> bool final;
     auto ContractID() const noexcept -> UnallocatedCString final
     {
         return opentxs::blockchain::UnitID(Widget::api_, chain_).str();
@@ -115,6 +121,7 @@ public:
     {
         return blockchain::internal::Ticker(chain_);
     }
+    auto LoadMore() const noexcept -> void final;
     auto Name() const noexcept -> UnallocatedCString final
     {
         return opentxs::blockchain::AccountName(chain_);
@@ -212,21 +219,41 @@ private:
         reorg = value(WorkType::BlockchainReorg),
         statechange = value(WorkType::BlockchainStateChange),
         sync = value(WorkType::BlockchainSyncProgress),
+        load = OT_ZMQ_INTERNAL_SIGNAL + 0,
         init = OT_ZMQ_INIT_SIGNAL,
         statemachine = OT_ZMQ_STATE_MACHINE_SIGNAL,
     };
 
+    using Loaded =
+        UnallocatedMap<blockchain::block::pTxid, blockchain::block::Height>;
+
+    // NOTE maximum number of transactions loaded per pass of the state
+    // machine. The first pass happens during startup so this also determines
+    // how many of the most recent transactions are visible once the model
+    // becomes usable. Views request more in increments of the same size.
+    static constexpr auto load_batch_ = std::size_t{100};
+    // NOTE number of transactions loaded in advance of those requested by
+    // views
+    static constexpr auto prefetch_ = std::size_t{50};
+
     const blockchain::Type chain_;
     mutable Amount confirmed_;
     OTZMQListenCallback balance_cb_;
     OTZMQDealerSocket balance_socket_;
     Progress progress_;
-    blockchain::block::Height height_;
+    std::atomic<blockchain::block::Height> height_;
+    std::atomic<std::size_t> requested_;
+    std::atomic<std::size_t> available_;
+    Loaded loaded_;
+    // NOTE activity records for the nym which belong to other chains
+    UnallocatedSet<blockchain::block::pTxid> foreign_;
+    UnallocatedVector<blockchain::block::pTxid> pending_;
 
     static auto print(Work type) noexcept -> const char*;
 
     auto display_balance(opentxs::Amount value) const noexcept
         -> UnallocatedCString final;
+    auto row_id(const Data& txid) const noexcept -> AccountActivityRowID;
 
     auto load_thread() noexcept -> void;
     auto pipeline(const Message& in) noexcept -> void final;
@@ -235,6 +262,7 @@ private:
     auto process_contact(const Message& in) noexcept -> void;
     auto process_height(const blockchain::block::Height height) noexcept
         -> void;
+    auto process_load() noexcept -> void;
     auto process_reorg(const Message& in) noexcept -> void;
     auto process_state(const Message& in) noexcept -> void;
     auto process_sync(const Message& in) noexcept -> void;
@@ -242,6 +270,7 @@ private:
     auto process_txid(const Data& txid) noexcept
         -> std::optional<AccountActivityRowID>;
     auto startup() noexcept -> void final;
+    auto state_machine() noexcept -> bool final;
 
     BlockchainAccountActivity() = delete;
     BlockchainAccountActivity(const BlockchainAccountActivity&) = delete;
@@ -45,13 +45,25 @@ BlockchainBalanceItem::BlockchainBalanceItem(
     , txid_(txid)
     , amount_(amount)
     , memo_(memo)
-    , confirmations_(extract_custom<int>(custom, 6))
+    , mined_(extract_custom<blockchain::block::Height>(custom, 6))
 {
     // NOTE Avoids memory leaks
     extract_custom<proto::PaymentWorkflow>(custom, 0);
     extract_custom<proto::PaymentEvent>(custom, 1);
 }
 
+auto BlockchainBalanceItem::Confirmations() const noexcept -> int
+{
+    // NOTE calculated on demand so that new blocks do not require any rows to
+    // be reindexed
+    const auto mined = mined_.load();
+    const auto best = parent_.BlockchainHeight();
+
+    if ((0 > mined) || (mined > best)) { return 0; }
+
+    return static_cast<int>(best - mined) + 1;
+}
+
 auto BlockchainBalanceItem::Contacts() const noexcept
     -> UnallocatedVector<UnallocatedCString>
 {
@@ -97,7 +109,7 @@ auto BlockchainBalanceItem::reindex(
     const auto amount = tx.NetBalanceChange(nym_id_);
     const auto memo = tx.Memo();
     const auto text = extract_custom<UnallocatedCString>(custom, 4);
-    const auto conf = extract_custom<int>(custom, 6);
+    const auto mined = extract_custom<blockchain::block::Height>(custom, 6);
 
     OT_ASSERT(chain_ == chain);
     OT_ASSERT(txid_ == txid);
@@ -118,7 +130,7 @@ auto BlockchainBalanceItem::reindex(
         output |= true;
     }
 
-    if (auto previous = confirmations_.exchange(conf); previous != conf) {
+    if (auto previous = mined_.exchange(mined); previous != mined) {
         output |= true;
     }
 
@@ -15,6 +15,7 @@
 #include "internal/util/Mutex.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/block/Types.hpp"
 #include "opentxs/core/Amount.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
@@ -71,7 +72,7 @@ public:
     {
         return effective_amount();
     }
-    auto Confirmations() const noexcept -> int final { return confirmations_; }
+    auto Confirmations() const noexcept -> int final;
     auto Contacts() const noexcept
         -> UnallocatedVector<UnallocatedCString> final;
     auto DisplayAmount() const noexcept -> UnallocatedCString final;
@@ -103,7 +104,7 @@ private:
     const OTData txid_;
     opentxs::Amount amount_;
     UnallocatedCString memo_;
-    std::atomic_int confirmations_;
+    std::atomic<blockchain::block::Height> mined_;
 
     auto effective_amount() const noexcept -> opentxs::Amount final
     {
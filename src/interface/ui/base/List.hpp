@@ -278,6 +278,14 @@ protected:
 
         UpdateNotify();
     }
+    // NOTE for changes which affect how every row is displayed but which do
+    // not require any row to be reindexed
+    auto rows_modified() noexcept -> void
+    {
+        if (qt_model_) { qt_model_->ChangeRow(qt_parent(), nullptr); }
+
+        UpdateNotify();
+    }
 
     // NOTE lists that are also rows call this constructor
     List(
@@ -5,11 +5,13 @@
 
 #pragma once
 
+#include <memory>
 #include <string_view>
 
 #include "opentxs/api/crypto/Blockchain.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
 #include "opentxs/blockchain/crypto/Types.hpp"
+#include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -45,6 +47,9 @@ namespace opentxs::api::crypto::internal
 class Blockchain : virtual public api::crypto::Blockchain
 {
 public:
+    using Transactions = UnallocatedVector<
+        std::unique_ptr<opentxs::blockchain::block::bitcoin::Transaction>>;
+
     virtual auto Contacts() const noexcept -> const api::session::Contacts& = 0;
     virtual auto KeyEndpoint() const noexcept -> std::string_view = 0;
     virtual auto KeyGenerated(
@@ -82,6 +87,12 @@ public:
         const Chain chain,
         const opentxs::blockchain::block::bitcoin::Transaction& transaction,
         const PasswordPrompt& reason) const noexcept -> bool = 0;
+    /// Equivalent to calling ProcessTransaction for each transaction, but
+    /// stores and indexes the whole batch at once
+    virtual auto ProcessTransactions(
+        const Chain chain,
+        Transactions&& transactions,
+        const PasswordPrompt& reason) const noexcept -> bool = 0;
     /// Throws std::runtime_error if type is invalid
     virtual auto PubkeyHash(
         const opentxs::blockchain::Type chain,
@@ -250,6 +250,13 @@ public:
     {
         return {};
     }
+    auto ProcessTransactions(
+        const Chain,
+        Transactions&&,
+        const PasswordPrompt&) const noexcept -> bool final
+    {
+        return {};
+    }
     auto PubkeyHash(const opentxs::blockchain::Type, const Data&) const
         noexcept(false) -> OTData final
     {
@@ -35,6 +35,14 @@ namespace common
 class Database;
 }  // namespace common
 }  // namespace database
+
+namespace node
+{
+namespace blockoracle
+{
+class BlockCache;
+}  // namespace blockoracle
+}  // namespace node
 }  // namespace blockchain
 
 namespace network
@@ -60,6 +68,8 @@ class Blockchain
 public:
     virtual auto BlockAvailable() const noexcept
         -> const opentxs::network::zeromq::socket::Publish& = 0;
+    virtual auto BlockCache() const noexcept
+        -> const opentxs::blockchain::node::blockoracle::BlockCache& = 0;
     virtual auto BlockQueueUpdate() const noexcept
         -> const opentxs::network::zeromq::socket::Publish& = 0;
     virtual auto Database() const noexcept
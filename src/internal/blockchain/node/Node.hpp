@@ -12,6 +12,7 @@
 #include <boost/thread/thread.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <future>
 #include <iosfwd>
 #include <memory>
@@ -280,6 +281,8 @@ struct FilterDatabase {
     using CFHeaderParams =
         std::tuple<block::Hash, cfilter::Header, cfilter::Hash>;
     using CFilterParams = std::pair<block::Hash, GCS>;
+    using EncodedFilterVisitor =
+        std::function<void(const block::Hash& block, const ReadView filter)>;
 
     virtual auto FilterHeaderTip(const cfilter::Type type) const noexcept
         -> block::Position = 0;
@@ -294,6 +297,15 @@ struct FilterDatabase {
         const cfilter::Type type,
         const ReadView block,
         alloc::Default alloc) const noexcept -> blockchain::GCS = 0;
+    // Passes the BIP-158 encoding of each filter, in order, to the visitor
+    // without constructing a GCS. Stops at the first missing filter and
+    // returns the number of filters visited. The view passed to the visitor
+    // is only valid for the duration of the call and the visitor must not
+    // call back into the database.
+    virtual auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const EncodedFilterVisitor& visitor) const noexcept -> std::size_t = 0;
     virtual auto LoadFilters(
         const cfilter::Type type,
         const Vector<block::Hash>& blocks) const noexcept -> Vector<GCS> = 0;
@@ -329,6 +341,11 @@ struct FilterOracle : virtual public node::FilterOracle {
     virtual auto GetFilterJob() const noexcept -> CfilterJob = 0;
     virtual auto GetHeaderJob() const noexcept -> CfheaderJob = 0;
     virtual auto Heartbeat() const noexcept -> void = 0;
+    virtual auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const FilterDatabase::EncodedFilterVisitor& visitor) const noexcept
+        -> std::size_t = 0;
     virtual auto LoadFilterOrResetTip(
         const cfilter::Type type,
         const block::Position& position,
@@ -382,8 +399,17 @@ struct HeaderDatabase {
 };
 
 struct Mempool {
-    virtual auto Dump() const noexcept
-        -> UnallocatedSet<UnallocatedCString> = 0;
+    // Position of an incremental dump. Pass the returned cursor back to Dump
+    // to resume after the last transaction already seen.
+    using Cursor = std::uint64_t;
+    using Dumped = std::pair<UnallocatedVector<UnallocatedCString>, Cursor>;
+    // Transaction ids with their package fee rate in units per 1000 vbytes
+    using Ranked = UnallocatedVector<std::pair<UnallocatedCString, Amount>>;
+
+    static constexpr auto dump_batch_ = std::size_t{1000};
+
+    virtual auto Dump(const Cursor position, const std::size_t count)
+        const noexcept -> Dumped = 0;
     virtual auto Query(ReadView txid) const noexcept
         -> std::shared_ptr<const block::bitcoin::Transaction> = 0;
     virtual auto Submit(ReadView txid) const noexcept -> bool = 0;
@@ -391,6 +417,7 @@ struct Mempool {
         -> UnallocatedVector<bool> = 0;
     virtual auto Submit(std::unique_ptr<const block::bitcoin::Transaction> tx)
         const noexcept -> void = 0;
+    virtual auto Top(const std::size_t count) const noexcept -> Ranked = 0;
 
     virtual auto Heartbeat() noexcept -> void = 0;
 
@@ -698,6 +725,8 @@ struct WalletDatabase {
         const proto::BlockchainTransactionProposal& tx) noexcept -> bool = 0;
     virtual auto AdvanceTo(const block::Position& pos) noexcept -> bool = 0;
     virtual auto CancelProposal(const Identifier& id) noexcept -> bool = 0;
+    // Removes a proposal which does not have any outputs reserved for it
+    virtual auto DeleteProposal(const Identifier& id) noexcept -> bool = 0;
     virtual auto FinalizeReorg(
         storage::lmdb::LMDB::Transaction& tx,
         const block::Position& pos) noexcept -> bool = 0;
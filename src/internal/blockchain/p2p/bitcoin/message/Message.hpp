@@ -87,6 +87,7 @@ namespace network
 namespace zeromq
 {
 class Frame;
+class Message;
 }  // namespace zeromq
 }  // namespace network
 // }  // namespace v1
@@ -468,6 +469,16 @@ auto BitcoinP2PCfilter(
     const blockchain::block::Hash& hash,
     const blockchain::GCS& filter)
     -> blockchain::p2p::bitcoin::message::internal::Cfilter*;
+// Appends the header and payload frames of a cfilter message for a filter
+// which is already in its BIP-158 encoding. The frames are identical to those
+// produced by Transmit() on the equivalent Cfilter message.
+auto BitcoinP2PCfilterFrames(
+    const api::Session& api,
+    const blockchain::Type network,
+    const blockchain::cfilter::Type type,
+    const blockchain::block::Hash& hash,
+    const ReadView encodedFilter,
+    network::zeromq::Message& out) noexcept -> bool;
 auto BitcoinP2PCmpctblock(
     const api::Session& api,
     std::unique_ptr<blockchain::p2p::bitcoin::Header> pHeader,
@@ -642,6 +642,9 @@ struct AccountActivity : virtual public List,
 
     virtual auto last(const implementation::AccountActivityRowID& id)
         const noexcept -> bool = 0;
+    // NOTE safe for child rows to call at any time
+    virtual auto BlockchainHeight() const noexcept
+        -> blockchain::block::Height = 0;
     // WARNING potential race condition. Child rows must never call this
     // except when directed by parent object
     virtual auto Contract() const noexcept -> const contract::Unit& = 0;
@@ -1668,7 +1671,9 @@ struct Model {
     auto GetRoot() const noexcept -> QObject*;
     auto GetRoleData() const noexcept -> RoleData;
     auto GetRowCount(ui::internal::Row* row) const noexcept -> int;
+    auto GetUpdateInterval() const noexcept -> std::chrono::milliseconds;
 
+    // NOTE a null row indicates every child of parent has changed
     auto ChangeRow(ui::internal::Row* parent, ui::internal::Row* row) noexcept
         -> void;
     auto ClearParent() noexcept -> void;
@@ -1687,7 +1692,7 @@ struct Model {
     auto SetRoleData(RoleData&& data) noexcept -> void;
     auto SetParent(qt::Model& parent) noexcept -> void;
 
-    Model(QObject* parent) noexcept;
+    Model(QObject* parent, std::chrono::milliseconds interval) noexcept;
 
     ~Model();
 
@@ -1696,6 +1701,18 @@ private:
 
     struct Imp;
 
+    // NOTE row operations delivered to a qt::Model are held for the update
+    // interval, then replayed to attached views
+    struct Update {
+        enum class Type { change, remove, insert, move };
+
+        Type type_{};
+        ui::internal::Row* parent_{nullptr};
+        ui::internal::Row* after_{nullptr};
+        ui::internal::Row* row_{nullptr};
+        std::shared_ptr<ui::internal::Row> pointer_{};
+    };
+
     Imp* imp_;
 
     auto do_delete_row(ui::internal::Row* row) noexcept -> void;
@@ -1707,6 +1724,9 @@ private:
         ui::internal::Row* newParent,
         ui::internal::Row* newBefore,
         ui::internal::Row* row) noexcept -> void;
+    // NOTE applies queued row operations without notifying any views
+    auto finish_updates() noexcept -> void;
+    auto queue_update(qt::Model& model, Update&& op) noexcept -> void;
 
     Model() = delete;
     Model(const Model&) = delete;
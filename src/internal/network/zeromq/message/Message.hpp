@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "Proto.hpp"
 #include "internal/network/zeromq/Types.hpp"
 
@@ -34,6 +36,8 @@ public:
         -> zeromq::Frame& = 0;
     virtual auto ExtractFront() noexcept -> zeromq::Frame = 0;
     virtual auto Prepend(SocketID id) noexcept -> zeromq::Frame& = 0;
+    // Preallocates space for the specified number of additional frames
+    virtual auto Reserve(const std::size_t frames) noexcept -> void = 0;
 
     virtual ~Message() = default;
 };
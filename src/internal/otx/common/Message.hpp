@@ -16,6 +16,7 @@
 #include "opentxs/Version.hpp"
 #include "opentxs/core/Armored.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Numbers.hpp"
 
@@ -136,6 +137,14 @@ public:
     static auto Type(const UnallocatedCString& type) -> MessageType;
     static auto ReplyCommand(const MessageType type) -> UnallocatedCString;
 
+    // Wire encodings of a signed message. The binary encoding omits the ascii
+    // armoring and is only used with peers which advertised support for it
+    // during registration.
+    auto Encode(const bool binary) const -> UnallocatedCString;
+
+    // Returns false if the bytes do not contain a valid message
+    auto Decode(const ReadView bytes, const bool binary) -> bool;
+
     ~Message() final;
 
     auto VerifyContractID() const -> bool final;
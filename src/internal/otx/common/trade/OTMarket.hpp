@@ -6,11 +6,13 @@
 #pragma once
 
 #include <irrxml/irrXML.hpp>
+#include <cstddef>
 #include <cstdint>
 
 #include "internal/otx/common/Contract.hpp"
 #include "internal/otx/common/cron/OTCron.hpp"
 #include "internal/otx/common/trade/OTOffer.hpp"
+#include "internal/otx/common/trade/OrderBook.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
@@ -59,14 +61,6 @@ class PasswordPrompt;
 #define MAX_MARKET_QUERY_DEPTH                                                 \
     50  // todo add this to the ini file. (Now that we actually have one.)
 
-// Multiple offers, mapped by price limit.
-// Using multi-map since there will be more than one offer for each single
-// price.
-// (Map would only allow a single item on the map for each price.)
-using mapOfOffers = UnallocatedMultimap<Amount, OTOffer*>;
-// The same offers are also mapped (uniquely) to transaction number.
-using mapOfOffersTrnsNum = UnallocatedMap<Amount, OTOffer*>;
-
 // A market has a list of OTOffers for all the bids, and another list of
 // OTOffers for all the asks.
 // Presumably the server will have different markets for different instrument
@@ -122,8 +116,8 @@ public:
     auto GetHighestBidPrice() -> Amount;
     auto GetLowestAskPrice() -> Amount;
 
-    auto GetBidCount() -> mapOfOffers::size_type { return m_mapBids.size(); }
-    auto GetAskCount() -> mapOfOffers::size_type { return m_mapAsks.size(); }
+    auto GetBidCount() -> std::size_t { return book_.BidCount(); }
+    auto GetAskCount() -> std::size_t { return book_.AskCount(); }
     void SetInstrumentDefinitionID(
         const identifier::UnitDefinition& INSTRUMENT_DEFINITION_ID)
     {
@@ -207,11 +201,10 @@ private:
 
     OTDB::TradeListMarket* m_pTradeList{nullptr};
 
-    mapOfOffers m_mapBids;  // The buyers, ordered by price limit
-    mapOfOffers m_mapAsks;  // The sellers, ordered by price limit
-
-    mapOfOffersTrnsNum m_mapOffers;  // All of the offers on a single list,
-                                     // ordered by transaction number.
+    // The buyers and sellers, ordered by price limit and then by the time
+    // they were added. The book only indexes the offers. The market owns them
+    // and deletes them when they are removed or the market is released.
+    otx::OrderBook book_;
 
     OTNotaryID m_NOTARY_ID;  // Always store this in any object that's
                              // associated with a specific server.
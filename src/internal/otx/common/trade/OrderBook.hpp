@@ -0,0 +1,114 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+class OTOffer;
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::otx
+{
+// Resting offers for one market, grouped into price levels. Offers at the same
+// price are matched in the order they were added. Market orders rest at price
+// zero and are never reported as the best bid or ask.
+//
+// The book does not own the offers it holds.
+class OrderBook
+{
+public:
+    struct Level {
+        Amount price_{};
+        Amount volume_{};
+        std::size_t offers_{};
+    };
+
+    using Levels = UnallocatedVector<Level>;
+    using Offers = UnallocatedVector<OTOffer*>;
+    // Return false to stop the iteration
+    using Visitor = std::function<bool(OTOffer&)>;
+
+    auto AskCount() const noexcept -> std::size_t { return asks_.count_; }
+    auto AskVolume() const noexcept -> const Amount& { return asks_.volume_; }
+    // Returns zero if there are no limit asks
+    auto BestAsk() const noexcept -> Amount;
+    // Returns zero if there are no limit bids
+    auto BestBid() const noexcept -> Amount;
+    auto BidCount() const noexcept -> std::size_t { return bids_.count_; }
+    auto BidVolume() const noexcept -> const Amount& { return bids_.volume_; }
+    // True if the best bid is at least the best ask
+    auto Crosses() const noexcept -> bool;
+    // Returns up to count price levels starting from the best price, skipping
+    // market orders
+    auto Depth(const bool bids, const std::size_t count) const noexcept
+        -> Levels;
+    auto Find(const std::int64_t number) const noexcept -> OTOffer*;
+    // Returns up to count limit offers in matching order
+    auto Top(const bool bids, const std::size_t count) const noexcept
+        -> Offers;
+    // Visits the offers on one side in matching order
+    auto Visit(const bool bids, const Visitor& visitor) const noexcept -> void;
+
+    // Returns false if an offer with the same transaction number is present
+    auto Add(OTOffer& offer) noexcept -> bool;
+    // Removes every offer and returns them so the caller can delete them
+    auto Clear() noexcept -> Offers;
+    // Records that amount of the offer has been traded
+    auto Fill(const std::int64_t number, const Amount& amount) noexcept
+        -> void;
+    // Returns nullptr if the offer is not present
+    auto Remove(const std::int64_t number) noexcept -> OTOffer*;
+
+    OrderBook() noexcept;
+
+    ~OrderBook();
+
+private:
+    using Queue = UnallocatedList<OTOffer*>;
+
+    struct PriceLevel {
+        Amount volume_;
+        Queue offers_;
+    };
+
+    // Levels are sorted by ascending price on both sides. Bids are visited in
+    // reverse.
+    using PriceLevels = UnallocatedMap<Amount, PriceLevel>;
+
+    struct Side {
+        PriceLevels levels_{};
+        std::size_t count_{};
+        Amount volume_{};
+    };
+
+    struct Position {
+        bool bid_;
+        PriceLevels::iterator level_;
+        Queue::iterator offer_;
+    };
+
+    Side bids_;
+    Side asks_;
+    UnallocatedUnorderedMap<std::int64_t, Position> index_;
+
+    OrderBook(const OrderBook&) = delete;
+    OrderBook(OrderBook&&) = delete;
+    auto operator=(const OrderBook&) -> OrderBook& = delete;
+    auto operator=(OrderBook&&) -> OrderBook& = delete;
+};
+}  // namespace opentxs::otx
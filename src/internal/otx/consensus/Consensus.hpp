@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "internal/otx/Types.hpp"
 #include "internal/util/Editor.hpp"
 #include "internal/util/Mutex.hpp"
@@ -49,11 +51,16 @@ namespace opentxs::otx::context::internal
 class Base : virtual public opentxs::otx::context::Base
 {
 public:
+    using NumberVisitor = std::function<void(const TransactionNumber)>;
+
     virtual auto GetContract(const Lock& lock) const -> proto::Context = 0;
     auto Internal() const noexcept -> const internal::Base& final
     {
         return *this;
     }
+    using opentxs::otx::context::Base::IssuedNumbers;
+    // Visits the issued numbers in ascending order without copying them
+    virtual auto IssuedNumbers(const NumberVisitor& visitor) const -> void = 0;
     virtual auto Nymfile(const PasswordPrompt& reason) const
         -> std::unique_ptr<const opentxs::NymFile> = 0;
     virtual auto ValidateContext(const Lock& lock) const -> bool = 0;
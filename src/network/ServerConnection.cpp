@@ -23,6 +23,7 @@
 #include "internal/api/session/Endpoints.hpp"
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/network/zeromq/message/Message.hpp"
+#include "internal/otx/Types.hpp"
 #include "internal/otx/common/Message.hpp"
 #include "internal/serialization/protobuf/Check.hpp"
 #include "internal/serialization/protobuf/verify/ServerReply.hpp"
@@ -32,8 +33,6 @@
 #include "opentxs/api/session/Endpoints.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
-#include "opentxs/core/Armored.hpp"
-#include "opentxs/core/String.hpp"
 #include "opentxs/core/contract/ServerContract.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/identity/Nym.hpp"
@@ -101,6 +100,7 @@ ServerConnection::ServerConnection(
     , notification_socket_(
           zmq.Context().PushSocket(zmq::socket::Direction::Connect))
     , last_activity_(std::time(nullptr))
+    , binary_(Flag::Factory(false))
     , sockets_ready_(Flag::Factory(false))
     , status_(Flag::Factory(false))
     , use_proxy_(Flag::Factory(false))
@@ -439,12 +439,11 @@ auto ServerConnection::Send(
 
     OT_ASSERT(false != bool(reply));
 
-    auto raw = String::Factory();
-    message.SaveContractRaw(raw);
-    auto envelope = Armored::Factory(raw);
+    const bool binary = binary_.get();
+    const auto envelope = message.Encode(binary);
 
-    if (false == envelope->Exists()) {
-        LogError()(OT_PRETTY_CLASS())("Failed to armor message").Flush();
+    if (envelope.empty()) {
+        LogError()(OT_PRETTY_CLASS())("Failed to encode message").Flush();
 
         return output;
     }
@@ -453,7 +452,12 @@ auto ServerConnection::Send(
     Cleanup cleanup(socketLock, *this, status, reply);
     auto sendresult = get_sync(socketLock).Send([&] {
         auto out = zeromq::Message{};
-        out.AddFrame(envelope->Get());
+
+        // NOTE notaries which predate the binary encoding expect a single
+        // armored frame
+        if (binary) { out.AddFrame(WorkType::OTXLegacyBinary); }
+
+        out.AddFrame(envelope);
 
         return out;
     }());
@@ -470,11 +474,17 @@ auto ServerConnection::Send(
         LogError()(OT_PRETTY_CLASS())("Reply timeout.").Flush();
         cleanup.SetStatus(otx::client::SendResult::TIMEOUT);
 
+        // NOTE the notary may have been replaced by a version which does not
+        // understand binary messages. Fall back to armored messages until the
+        // next registration.
+        if (binary) { binary_->Off(); }
+
         return output;
     }
 
     try {
         const auto body = in.Body();
+        auto binaryReply{false};
         const auto& payload = [&] {
             if (0u == body.size()) {
                 throw std::runtime_error{"Empty reply"};
@@ -499,6 +509,11 @@ auto ServerConnection::Send(
 
                         return body.at(1);
                     }
+                    case WorkType::OTXLegacyBinary: {
+                        binaryReply = true;
+
+                        return body.at(1);
+                    }
                     default: {
                         throw std::runtime_error{"Unsupported message type"};
                     }
@@ -510,21 +525,21 @@ auto ServerConnection::Send(
             throw std::runtime_error{"Invalid reply message"};
         }
 
-        const auto serialized = [&] {
-            const auto armored = [&] {
-                auto out = Armored::Factory();
-                out->Set(UnallocatedCString{payload.Bytes()}.c_str());
-
-                return out;
-            }();
-            auto out = String::Factory();
-            armored->GetString(out);
-
-            return out;
-        }();
-        const auto loaded = replymessage->LoadContractFromString(serialized);
+        const auto loaded = replymessage->Decode(payload.Bytes(), binaryReply);
 
         if (loaded) {
+            const auto accepted =
+                replymessage->m_bSuccess && replymessage->m_bBool &&
+                (MessageType::registerNymResponse ==
+                 Message::Type(replymessage->m_strCommand->Get()));
+
+            if (accepted && (false == binary_.get())) {
+                LogDetail()(OT_PRETTY_CLASS())(
+                    "Notary accepted binary messages")
+                    .Flush();
+                binary_->On();
+            }
+
             reply = std::move(replymessage);
         } else {
             LogError()(OT_PRETTY_CLASS())(
@@ -113,6 +113,8 @@ private:
     OTZMQRequestSocket socket_;
     OTZMQPushSocket notification_socket_;
     std::atomic<std::time_t> last_activity_{0};
+    // Set once the notary has agreed to unarmored messages
+    OTFlag binary_;
     OTFlag sockets_ready_;
     OTFlag status_;
     OTFlag use_proxy_;
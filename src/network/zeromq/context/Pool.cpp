@@ -11,7 +11,9 @@
 #include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <thread>
 
@@ -32,13 +34,18 @@ Pool::Pool(const Context& parent) noexcept
     , batches_()
     , batch_index_()
     , socket_index_()
+    , placement_()
 {
     for (unsigned int n{0}; n < count_; ++n) { threads_.try_emplace(n, *this); }
+
+    placement_.modify([&](auto& data) { data.assigned_.assign(count_, 0u); });
 }
 
 auto Pool::Alloc(BatchID id) noexcept -> alloc::Resource*
 {
-    return get(id).Alloc();
+    if (auto* thread = get(id); nullptr != thread) { return thread->Alloc(); }
+
+    return nullptr;
 }
 
 auto Pool::BelongsToThreadPool(const std::thread::id id) const noexcept -> bool
@@ -69,14 +76,34 @@ auto Pool::DoModify(SocketID id, const ModifyCallback& cb) noexcept -> bool
     }
 }
 
-auto Pool::get(BatchID id) const noexcept -> const context::Thread&
+auto Pool::find(BatchID id) const noexcept -> std::optional<unsigned int>
+{
+    auto placement = placement_.lock_shared();
+    const auto& batches = placement->batches_;
+
+    if (auto i = batches.find(id); batches.end() != i) { return i->second; }
+
+    return std::nullopt;
+}
+
+auto Pool::get(BatchID id) const noexcept -> const context::Thread*
 {
-    return threads_.at(id % count_);
+    if (const auto index = find(id); index.has_value()) {
+
+        return &threads_.at(*index);
+    }
+
+    return nullptr;
 }
 
-auto Pool::get(BatchID id) noexcept -> context::Thread&
+auto Pool::get(BatchID id) noexcept -> context::Thread*
 {
-    return threads_.at(id % count_);
+    if (const auto index = find(id); index.has_value()) {
+
+        return &threads_.at(*index);
+    }
+
+    return nullptr;
 }
 
 auto Pool::MakeBatch(Vector<socket::Type>&& types) noexcept -> internal::Handle
@@ -96,6 +123,7 @@ auto Pool::MakeBatch(const BatchID id, Vector<socket::Type>&& types) noexcept
 
     assert(added);
 
+    place(id);
     auto& batch = it->second;
 
     return {parent_.Internal(), batch};
@@ -107,20 +135,84 @@ auto Pool::Modify(SocketID id, ModifyCallback cb) noexcept -> AsyncResult
 
     if (ticket) { return {}; }
 
-    try {
-        auto [batch, socket] = [&] {
-            auto socket_index = socket_index_.lock_shared();
-            return socket_index->at(id);
-        }();
+    const auto batch = [&]() -> std::optional<BatchID> {
+        auto socket_index = socket_index_.lock_shared();
 
-        return get(batch).Modify(id, std::move(cb));
-    } catch (...) {
+        if (auto i = socket_index->find(id); socket_index->end() != i) {
 
-        return {};
+            return i->second.first;
+        }
+
+        return std::nullopt;
+    }();
+
+    if (false == batch.has_value()) { return {}; }
+
+    if (auto* thread = get(*batch); nullptr != thread) {
+
+        return thread->Modify(id, std::move(cb));
+    }
+
+    return {};
+}
+
+auto Pool::place(BatchID id) const noexcept -> unsigned int
+{
+    if (const auto index = find(id); index.has_value()) { return *index; }
+
+    auto handle = placement_.lock();
+    auto& data = *handle;
+
+    if (auto i = data.batches_.find(id); data.batches_.end() != i) {
+        return i->second;
     }
+
+    // NOTE a batch stays on the thread it was first assigned to for its
+    // entire lifetime since its allocator and thread id are handed out to
+    // the owning actor. Load is therefore balanced at placement time by
+    // choosing the thread with the fewest batches plus the least recent
+    // socket and message activity. The scan starts from the old modulo
+    // assignment so ties spread evenly.
+    const auto start = static_cast<unsigned int>(id % count_);
+    auto best = start;
+    auto lowest = std::numeric_limits<std::size_t>::max();
+
+    for (auto n = 0u; n < count_; ++n) {
+        const auto index = (start + n) % count_;
+        const auto load = data.assigned_.at(index) + threads_.at(index).Load();
+
+        if (load < lowest) {
+            best = index;
+            lowest = load;
+        }
+    }
+
+    data.batches_.emplace(id, best);
+    ++data.assigned_.at(best);
+
+    return best;
+}
+
+auto Pool::PreallocateBatch() const noexcept -> BatchID
+{
+    const auto id = GetBatchID();
+    place(id);
+
+    return id;
 }
 
-auto Pool::PreallocateBatch() const noexcept -> BatchID { return GetBatchID(); }
+auto Pool::release(BatchID id) noexcept -> void
+{
+    placement_.modify([&](auto& data) {
+        if (auto i = data.batches_.find(id); data.batches_.end() != i) {
+            auto& count = data.assigned_.at(i->second);
+
+            if (0u < count) { --count; }
+
+            data.batches_.erase(i);
+        }
+    });
+}
 
 auto Pool::Shutdown() noexcept -> void { stop(); }
 
@@ -138,7 +230,7 @@ auto Pool::Start(BatchID id, StartArgs&& sockets) noexcept
             throw std::runtime_error{"batch already exists"};
         }
 
-        auto& thread = get(id);
+        auto& thread = threads_.at(place(id));
 
         if (thread.Add(id, std::move(sockets))) {
 
@@ -155,27 +247,45 @@ auto Pool::Start(BatchID id, StartArgs&& sockets) noexcept
 
 auto Pool::Stop(BatchID id) noexcept -> std::future<bool>
 {
-    try {
-        auto sockets = [&] {
-            auto out = UnallocatedVector<socket::Raw*>{};
-            auto batch_index = batch_index_.lock_shared();
-            for (const auto& sID : batch_index->at(id)) {
-                auto socket_index = socket_index_.lock_shared();
-                out.emplace_back(socket_index->at(sID).second);
-            }
-
-            return out;
-        }();
-        auto& thread = get(id);
-
-        return thread.Remove(id, std::move(sockets));
-    } catch (...) {
+    const auto failed = [] {
         auto promise = std::promise<bool>{};
         auto output = promise.get_future();
         promise.set_value(false);
 
         return output;
+    };
+    auto* thread = get(id);
+    auto sockets = [&]() -> std::optional<UnallocatedVector<socket::Raw*>> {
+        auto batch_index = batch_index_.lock_shared();
+        const auto batch = batch_index->find(id);
+
+        if (batch_index->end() == batch) { return std::nullopt; }
+
+        auto out = UnallocatedVector<socket::Raw*>{};
+        auto socket_index = socket_index_.lock_shared();
+
+        for (const auto& sID : batch->second) {
+            if (auto i = socket_index->find(sID); socket_index->end() != i) {
+                out.emplace_back(i->second.second);
+            }
+        }
+
+        return out;
+    }();
+
+    if (false == sockets.has_value()) {
+        // NOTE a batch which was created or preallocated but never started
+        // will never be passed to UpdateIndex by its thread so its placement
+        // is released here when the batch is destroyed
+        batches_.modify([&](auto& batches) { batches.erase(id); });
+        release(id);
+
+        return failed();
     }
+
+    if (nullptr == thread) { return failed(); }
+
+    return thread->Remove(id, std::move(*sockets));
 }
 
 auto Pool::stop() noexcept -> void
@@ -188,20 +298,26 @@ auto Pool::stop() noexcept -> void
         batches_.modify([](auto& map) { map.clear(); });
         batch_index_.modify([](auto& map) { map.clear(); });
         socket_index_.modify([](auto& map) { map.clear(); });
+        placement_.modify([](auto& data) {
+            data.batches_.clear();
+            std::fill(data.assigned_.begin(), data.assigned_.end(), 0u);
+        });
     }
 }
 
 auto Pool::Thread(BatchID id) const noexcept -> zeromq::internal::Thread*
 {
-    auto& thread = static_cast<zeromq::internal::Thread&>(
-        const_cast<Pool*>(this)->get(id));
-
-    return &thread;
+    return const_cast<Pool*>(this)->get(id);
 }
 
 auto Pool::ThreadID(BatchID id) const noexcept -> std::thread::id
 {
-    return get(id).ID();
+    if (const auto* thread = get(id); nullptr != thread) {
+
+        return thread->ID();
+    }
+
+    return {};
 }
 
 auto Pool::UpdateIndex(BatchID id, StartArgs&& sockets) noexcept -> void
@@ -238,6 +354,7 @@ auto Pool::UpdateIndex(BatchID id) noexcept -> void
     });
 
     batches_.modify([&](auto& batch) { batch.erase(id); });
+    release(id);
 }
 
 Pool::~Pool() { stop(); }
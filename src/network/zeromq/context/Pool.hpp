@@ -6,8 +6,10 @@
 #include <cs_ordered_guarded.h>
 #include <robin_hood.h>
 #include <atomic>
+#include <cstddef>
 #include <future>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <thread>
 #include <tuple>
@@ -99,6 +101,11 @@ public:
     ~Pool() final;
 
 private:
+    struct Placement {
+        robin_hood::unordered_flat_map<BatchID, unsigned int> batches_{};
+        UnallocatedVector<std::size_t> assigned_{};
+    };
+
     const Context& parent_;
     const unsigned int count_;
     std::atomic<bool> running_;
@@ -107,10 +114,17 @@ private:
     libguarded::ordered_guarded<Batches, std::shared_mutex> batches_;
     libguarded::ordered_guarded<BatchIndex, std::shared_mutex> batch_index_;
     libguarded::ordered_guarded<SocketIndex, std::shared_mutex> socket_index_;
+    mutable libguarded::ordered_guarded<Placement, std::shared_mutex>
+        placement_;
 
-    auto get(BatchID id) const noexcept -> const context::Thread&;
+    // Returns the thread a batch was placed on without placing it
+    auto find(BatchID id) const noexcept -> std::optional<unsigned int>;
+    // Returns nullptr if the batch was never placed or was released
+    auto get(BatchID id) const noexcept -> const context::Thread*;
+    auto place(BatchID id) const noexcept -> unsigned int;
+    auto release(BatchID id) noexcept -> void;
 
-    auto get(BatchID id) noexcept -> context::Thread&;
+    auto get(BatchID id) noexcept -> context::Thread*;
     auto stop() noexcept -> void;
 
     Pool() = delete;
@@ -36,6 +36,8 @@ namespace opentxs::network::zeromq::context
 Thread::Thread(zeromq::internal::Pool& parent) noexcept
     : parent_(parent)
     , shutdown_(false)
+    , sockets_(0)
+    , activity_(0)
     , null_(factory::ZMQSocketNull())
     , alloc_()
     , gate_()
@@ -62,7 +64,9 @@ auto Thread::Add(BatchID id, StartArgs&& args) noexcept -> bool
         return out;
     }();
     parent_.UpdateIndex(id, std::move(args));
-    data_.modify_detach([data = std::move(sockets)](auto& guarded) {
+    data_.modify_detach([this, data = std::move(sockets)](auto& guarded) {
+        sockets_ += data.size();
+
         for (auto [socket, cb] : data) {
             assert(cb);
 
@@ -79,11 +83,34 @@ auto Thread::Add(BatchID id, StartArgs&& args) noexcept -> bool
     return true;
 }
 
+auto Thread::has_message(void* socket) const noexcept -> bool
+{
+    int events{0};
+    std::size_t eventsBytes{sizeof(events)};
+    const bool haveOption =
+        (-1 != ::zmq_getsockopt(socket, ZMQ_EVENTS, &events, &eventsBytes));
+
+    if (false == haveOption) {
+        std::cerr << (OT_PRETTY_CLASS())
+                  << "Failed to check socket events error:\n"
+                  << ::zmq_strerror(zmq_errno()) << std::endl;
+
+        return false;
+    }
+
+    return ZMQ_POLLIN == (events & ZMQ_POLLIN);
+}
+
 auto Thread::join() noexcept -> void
 {
     if (thread_.handle_.joinable()) { thread_.handle_.join(); }
 }
 
+auto Thread::Load() const noexcept -> std::size_t
+{
+    return sockets_.load() + (activity_.load() >> activity_decay_);
+}
+
 auto Thread::Modify(SocketID socket, ModifyCallback cb) noexcept -> AsyncResult
 {
     const auto ticket = gate_.get();
@@ -134,12 +161,14 @@ auto Thread::poll(Items& data) noexcept -> void
 
         return;
     } else if (0 == events) {
+        record_activity(0u);
 
         return;
     }
 
     const auto& v = data.items_;
     auto c = data.data_.begin();
+    auto received = std::size_t{0};
 
     for (auto s = v.begin(), end = v.end(); s != end; ++s, ++c) {
         auto& item = *s;
@@ -147,10 +176,19 @@ auto Thread::poll(Items& data) noexcept -> void
         if (ZMQ_POLLIN != item.revents) { continue; }
 
         auto& socket = item.socket;
-        auto message = Message{};
+        const auto& callback = *c;
+
+        // NOTE drain up to drain_budget_ messages from each ready socket so a
+        // busy socket does not pay for a full zmq_poll round per message,
+        // while still bounding how long the other sockets wait
+        for (auto n = std::size_t{0}; n < drain_budget_; ++n) {
+            if ((0u < n) && (false == has_message(socket))) { break; }
+
+            auto message = Message{};
+
+            if (false == receive_message(socket, message)) { break; }
 
-        if (receive_message(socket, message)) {
-            const auto& callback = *c;
+            ++received;
 
             try {
                 callback(std::move(message));
@@ -158,6 +196,8 @@ auto Thread::poll(Items& data) noexcept -> void
             }
         }
     }
+
+    record_activity(received);
 }
 
 auto Thread::receive_message(void* socket, Message& message) noexcept -> bool
@@ -208,6 +248,14 @@ auto Thread::receive_message(void* socket, Message& message) noexcept -> bool
     return true;
 }
 
+auto Thread::record_activity(std::size_t received) noexcept -> void
+{
+    // NOTE exponentially decayed sum of messages per poll round, scaled by
+    // 2^activity_decay_
+    const auto previous = activity_.load();
+    activity_.store(previous - (previous >> activity_decay_) + received);
+}
+
 auto Thread::Remove(BatchID id, UnallocatedVector<socket::Raw*>&& data) noexcept
     -> std::future<bool>
 {
@@ -238,6 +286,7 @@ auto Thread::Remove(BatchID id, UnallocatedVector<socket::Raw*>&& data) noexcept
                 } else {
                     s = guarded.items_.erase(s);
                     c = guarded.data_.erase(c);
+                    --sockets_;
                 }
             }
 
@@ -262,9 +311,10 @@ auto Thread::run() noexcept -> void
 auto Thread::Shutdown() noexcept -> void
 {
     shutdown_ = true;
-    data_.modify_detach([](auto& data) {
+    data_.modify_detach([this](auto& data) {
         data.items_.clear();
         data.data_.clear();
+        sockets_ = 0;
     });
     wait();
 }
@@ -8,6 +8,7 @@
 #include <cs_deferred_guarded.h>
 #include <zmq.h>
 #include <atomic>
+#include <cstddef>
 #include <future>
 #include <mutex>
 #include <queue>
@@ -65,6 +66,9 @@ public:
     {
         return thread_.handle_.get_id();
     }
+    /// Number of registered sockets plus the recent number of messages
+    /// received per poll round
+    auto Load() const noexcept -> std::size_t;
     auto Modify(SocketID socket, ModifyCallback cb) noexcept
         -> AsyncResult final;
     auto Remove(BatchID id, UnallocatedVector<socket::Raw*>&& sockets) noexcept
@@ -98,17 +102,24 @@ private:
 
     using Data = libguarded::deferred_guarded<Items, std::shared_mutex>;
 
+    static constexpr auto drain_budget_ = std::size_t{16};
+    static constexpr auto activity_decay_ = 3u;
+
     zeromq::internal::Pool& parent_;
     std::atomic_bool shutdown_;
+    std::atomic<std::size_t> sockets_;
+    std::atomic<std::size_t> activity_;
     socket::Raw null_;
     alloc::BoostPoolSync alloc_;
     Gatekeeper gate_;
     Background thread_;
     Data data_;
 
+    auto has_message(void* socket) const noexcept -> bool;
     auto join() noexcept -> void;
     auto poll(Items& data) noexcept -> void;
     auto receive_message(void* socket, Message& message) noexcept -> bool;
+    auto record_activity(std::size_t received) noexcept -> void;
     auto run() noexcept -> void;
     auto start() noexcept -> void;
     auto wait() noexcept -> void;
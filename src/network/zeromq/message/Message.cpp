@@ -376,6 +376,11 @@ auto Message::Imp::Prepend(SocketID id) noexcept -> zeromq::Frame&
     return frames_.front();
 }
 
+auto Message::Imp::Reserve(const std::size_t frames) noexcept -> void
+{
+    frames_.reserve(frames_.size() + frames);
+}
+
 auto Message::Imp::set_field(
     const std::size_t position,
     const zeromq::Frame& input) noexcept -> bool
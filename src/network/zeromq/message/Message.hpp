@@ -61,6 +61,7 @@ public:
     auto ExtractFront() noexcept -> zeromq::Frame final;
     auto Header() noexcept -> FrameSection;
     auto Prepend(SocketID id) noexcept -> zeromq::Frame& final;
+    auto Reserve(const std::size_t frames) noexcept -> void final;
     auto StartBody() noexcept -> void;
 
     Imp() noexcept;
@@ -1013,6 +1013,8 @@ auto Operation::construct_register_nym() -> std::shared_ptr<Message>
         return {};
     }
     message.m_ascPayload = api_.Factory().InternalSession().Armored(publicNym);
+    // Ask the notary to accept unarmored messages on this connection
+    message.m_bBool = true;
 
     FINISH_MESSAGE(registerNym);
 }
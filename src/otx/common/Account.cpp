@@ -202,10 +202,9 @@ auto Account::ConsensusHash(
         LogError()(OT_PRETTY_CLASS())("Empty outbox hash.").Flush();
     }
 
-    const auto& issuednumbers = context.IssuedNumbers();
-    for (const auto num : issuednumbers) {
+    context.Internal().IssuedNumbers([&](const auto num) {
         preimage->Concatenate(&num, sizeof(num));
-    }
+    });
 
     theOutput.clear();
 
@@ -23,6 +23,7 @@
 #include "internal/otx/common/StringXML.hpp"
 #include "internal/otx/common/XML.hpp"
 #include "internal/otx/common/util/Tag.hpp"
+#include "internal/otx/consensus/Consensus.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
@@ -647,9 +648,8 @@ auto Item::VerifyBalanceStatement(
             targetNumber)(" doesn't appear on Nym's issued list:")
             .Flush();
 
-        for (const auto& number : context.IssuedNumbers()) {
-            LogConsole()("    ")(number).Flush();
-        }
+        context.Internal().IssuedNumbers(
+            [](const auto number) { LogConsole()("    ")(number).Flush(); });
 
         return false;
     }
@@ -8,13 +8,20 @@
 #include "internal/otx/common/Ledger.hpp"  // IWYU pragma: associated
 
 #include <irrxml/irrXML.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
 #include "internal/api/Legacy.hpp"
+#include "internal/api/network/Asio.hpp"
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/api/session/Session.hpp"
 #include "internal/api/session/Wallet.hpp"
@@ -30,7 +37,10 @@
 #include "internal/otx/common/transaction/Helpers.hpp"
 #include "internal/otx/common/util/Tag.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
 #include "internal/util/Shared.hpp"
+#include "opentxs/api/network/Asio.hpp"
+#include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/api/session/Wallet.hpp"
@@ -50,6 +60,118 @@
 
 namespace opentxs
 {
+namespace
+{
+// Loads the full versions of a set of abbreviated box receipts on the general
+// thread pool. The calling thread also processes jobs so the batch completes
+// even if every pool thread is busy. Helpers which start after all jobs have
+// been claimed exit immediately, which is why the state is shared.
+//
+// Thread safety relies on the following:
+//  - a job only reads its own abbreviated transaction and writes its own
+//    receipt_, and the ledger itself is never passed to a worker
+//  - the job list is fixed once Run is called
+//  - OTDB::Exists and OTDB::QueryPlainString are stateless file system reads
+//    through the storage instance which was created during startup
+//  - parsing and verifying a receipt only touches the new OTTransaction
+//  - Run does not return until every job has finished, so the caller can not
+//    modify an abbreviated transaction while a worker is reading it
+struct BoxReceiptBatch final
+    : public std::enable_shared_from_this<BoxReceiptBatch> {
+    struct Job {
+        const std::int64_t number_;
+        const std::shared_ptr<OTTransaction> abbreviated_;
+        std::unique_ptr<OTTransaction> receipt_;
+
+        Job(const std::int64_t number,
+            std::shared_ptr<OTTransaction> abbreviated) noexcept
+            : number_(number)
+            , abbreviated_(std::move(abbreviated))
+            , receipt_()
+        {
+        }
+    };
+
+    const api::Session& api_;
+    const std::int64_t type_;
+
+    // Only valid before Run is called
+    auto Add(
+        const std::int64_t number,
+        std::shared_ptr<OTTransaction> abbreviated) noexcept -> void
+    {
+        OT_ASSERT(false == started_);
+        OT_ASSERT(abbreviated);
+
+        jobs_.emplace_back(number, std::move(abbreviated));
+    }
+    // Only valid after Run returns
+    auto Jobs() noexcept -> UnallocatedVector<Job>&
+    {
+        OT_ASSERT(started_);
+
+        return jobs_;
+    }
+    auto Run() noexcept -> void
+    {
+        OT_ASSERT(false == started_);
+
+        started_ = true;
+        const auto count = jobs_.size();
+
+        if (0u == count) { return; }
+
+        const auto threads =
+            std::max<std::size_t>(std::thread::hardware_concurrency(), 1u);
+        const auto helpers = std::min<std::size_t>(count, threads) - 1u;
+
+        for (auto n = std::size_t{0}; n < helpers; ++n) {
+            const auto posted = api_.Network().Asio().Internal().Post(
+                ThreadPool::General, [me = shared_from_this()] { me->work(); });
+
+            if (false == posted) { break; }
+        }
+
+        work();
+        auto lock = Lock{lock_};
+        cv_.wait(lock, [&] { return finished_ == count; });
+    }
+
+    BoxReceiptBatch(const api::Session& api, const std::int64_t type) noexcept
+        : api_(api)
+        , type_(type)
+        , started_(false)
+        , jobs_()
+        , next_(0)
+        , lock_()
+        , cv_()
+        , finished_(0)
+    {
+    }
+
+private:
+    bool started_;
+    UnallocatedVector<Job> jobs_;
+    std::atomic<std::size_t> next_;
+    std::mutex lock_;
+    std::condition_variable cv_;
+    std::size_t finished_;
+
+    auto work() noexcept -> void
+    {
+        const auto count = jobs_.size();
+
+        for (auto i = next_++; i < count; i = next_++) {
+            auto& job = jobs_[i];
+            job.receipt_ =
+                ::opentxs::LoadBoxReceipt(api_, *job.abbreviated_, type_);
+            auto lock = Lock{lock_};
+
+            if (++finished_ == count) { cv_.notify_all(); }
+        }
+    }
+};
+}  // namespace
 
 char const* const __TypeStringsLedger[] = {
     "nymbox",  // the nymbox is per user account (versus per asset account) and
@@ -244,60 +366,50 @@ auto Ledger::DeleteBoxReceipt(const std::int64_t& lTransactionNum) -> bool
 // if psetUnloaded passed in, then use it to return the #s that weren't there.
 auto Ledger::LoadBoxReceipts(UnallocatedSet<std::int64_t>* psetUnloaded) -> bool
 {
-    // Grab a copy of all the transaction #s stored inside this ledger.
-    //
-    UnallocatedSet<std::int64_t> the_set;
+    // Reading, parsing and verifying the receipts is independent for each
+    // transaction so it happens in parallel. The abbreviated transactions are
+    // only replaced afterwards, in transaction number order, by this thread.
+    auto batch = std::make_shared<BoxReceiptBatch>(
+        api_, static_cast<std::int64_t>(GetType()));
 
     for (auto& [number, pTransaction] : m_mapTransactions) {
         OT_ASSERT(pTransaction);
-        the_set.insert(number);
+
+        if (pTransaction->IsAbbreviated()) {
+            batch->Add(number, pTransaction);
+        }
     }
 
-    // Now iterate through those numbers and for each, load the box receipt.
-    //
+    batch->Run();
     bool bRetVal = true;
 
-    for (auto& it : the_set) {
-        std::int64_t lSetNum = it;
+    for (auto& job : batch->Jobs()) {
+        const auto lSetNum = job.number_;
 
-        const auto pTransaction = GetTransaction(lSetNum);
-        OT_ASSERT(pTransaction);
+        if (job.receipt_) {
+            // Remove the existing, abbreviated receipt, and replace it with
+            // the actual receipt.
+            RemoveTransaction(lSetNum);
+            AddTransaction(
+                std::shared_ptr<OTTransaction>{job.receipt_.release()});
 
-        // Failed loading the boxReceipt
-        //
-        if ((true == pTransaction->IsAbbreviated()) &&
-            (false == LoadBoxReceipt(lSetNum))) {
-            // WARNING: pTransaction must be re-Get'd below this point if
-            // needed, since pointer
-            // is bad if success on LoadBoxReceipt() call.
-            //
-            bRetVal = false;
-            auto& log = (nullptr != psetUnloaded) ? LogDebug() : LogConsole();
+            continue;
+        }
 
-            if (nullptr != psetUnloaded) { psetUnloaded->insert(lSetNum); }
+        bRetVal = false;
+        auto& log = (nullptr != psetUnloaded) ? LogDebug() : LogConsole();
 
-            log(OT_PRETTY_CLASS())("Failed calling LoadBoxReceipt on "
-                                   "abbreviated transaction number: ")(lSetNum)
-                .Flush();
-            // If psetUnloaded is passed in, then we don't want to break,
-            // because we want to
-            // populate it with the conmplete list of IDs that wouldn't load as
-            // a Box Receipt.
-            // Thus, we only break if psetUnloaded is nullptr, which is better
-            // optimization in that case.
-            // (If not building a list of all failures, then we can return at
-            // first sign of failure.)
-            //
-            if (nullptr == psetUnloaded) break;
-        }
-        // else (success), no need for a block in that case.
-    }
+        if (nullptr != psetUnloaded) { psetUnloaded->insert(lSetNum); }
+
+        log(OT_PRETTY_CLASS())("Failed calling LoadBoxReceipt on "
+                               "abbreviated transaction number: ")(lSetNum)
+            .Flush();
 
-    // You might ask, why didn't I just iterate through the transactions
-    // directly and just call
-    // LoadBoxReceipt on each one? Answer: Because that function actually
-    // deletes the transaction
-    // and replaces it with a different object, if successful.
+        // If psetUnloaded is passed in, then we don't stop at the first
+        // failure because the caller wants the complete list of IDs that
+        // wouldn't load as a Box Receipt.
+        if (nullptr == psetUnloaded) { break; }
+    }
 
     return bRetVal;
 }
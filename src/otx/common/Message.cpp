@@ -9,6 +9,7 @@
 
 #include <irrxml/irrXML.hpp>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <utility>
 
@@ -31,6 +32,7 @@
 #include "opentxs/core/identifier/Notary.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/otx/consensus/Base.hpp"
+#include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/Pimpl.hpp"
@@ -306,6 +308,57 @@ auto Message::ReplyCommand(const MessageType type) -> UnallocatedCString
     return Command(reply_command(type));
 }
 
+auto Message::Decode(const ReadView bytes, const bool binary) -> bool
+{
+    if (bytes.empty()) { return false; }
+
+    if (std::numeric_limits<std::uint32_t>::max() < bytes.size()) {
+        return false;
+    }
+
+    const auto size = static_cast<std::uint32_t>(bytes.size());
+    auto serialized = String::Factory();
+
+    if (binary) {
+        serialized->MemSet(bytes.data(), size);
+    } else {
+        auto armored = Armored::Factory();
+        armored->MemSet(bytes.data(), size);
+        armored->GetString(serialized);
+    }
+
+    if (false == serialized->Exists()) {
+        LogError()(OT_PRETTY_CLASS())("Empty serialized message.").Flush();
+
+        return false;
+    }
+
+    return LoadContractFromString(serialized);
+}
+
+auto Message::Encode(const bool binary) const -> UnallocatedCString
+{
+    auto raw = String::Factory();
+
+    if (false == SaveContractRaw(raw)) {
+        LogError()(OT_PRETTY_CLASS())("Failed to serialize message.").Flush();
+
+        return {};
+    }
+
+    if (binary) { return {raw->Get(), raw->GetLength()}; }
+
+    const auto armored = Armored::Factory(raw);
+
+    if (false == armored->Exists()) {
+        LogError()(OT_PRETTY_CLASS())("Failed to armor message.").Flush();
+
+        return {};
+    }
+
+    return {armored->Get(), armored->GetLength()};
+}
+
 auto Message::HarvestTransactionNumbers(
     otx::context::Server& context,
     bool bHarvestingForRetry,     // false until positively asserted.
@@ -1299,6 +1352,9 @@ public:
         pTag->add_attribute("publicnym", m.m_ascPayload->Get());
         pTag->add_attribute("nymboxHash", m.m_strNymboxHash->Get());
 
+        // NOTE only written when set so older notaries see the same message
+        if (m.m_bBool) { pTag->add_attribute("binary", formatBool(true)); }
+
         parent.add_tag(pTag);
     }
 
@@ -1313,6 +1369,8 @@ public:
         m.m_ascPayload->Set(xml->getAttributeValue("publicnym"));
         m.m_strNymboxHash =
             String::Factory(xml->getAttributeValue("nymboxHash"));
+        m.m_bBool = String::Factory(xml->getAttributeValue("binary"))
+                        ->Compare("true");
 
         LogDetail()(OT_PRETTY_CLASS())("Command: ")(m.m_strCommand)(
             " NymID:    ")(m.m_strNymID)(" NotaryID: ")(m.m_strNotaryID)
@@ -1339,6 +1397,9 @@ public:
         pTag->add_attribute("notaryID", m.m_strNotaryID->Get());
         pTag->add_attribute("nymboxHash", m.m_strNymboxHash->Get());
 
+        // NOTE only written when set so older clients see the same message
+        if (m.m_bBool) { pTag->add_attribute("binary", formatBool(true)); }
+
         if (m.m_bSuccess && (m.m_ascPayload->GetLength() > 2)) {
             pTag->add_tag("nymfile", m.m_ascPayload->Get());
         }
@@ -1362,6 +1423,8 @@ public:
         m.m_strNotaryID = String::Factory(xml->getAttributeValue("notaryID"));
         m.m_strNymboxHash =
             String::Factory(xml->getAttributeValue("nymboxHash"));
+        m.m_bBool = String::Factory(xml->getAttributeValue("binary"))
+                        ->Compare("true");
 
         if (m.m_bSuccess) {
             const char* pElementExpected = "nymfile";
@@ -2151,6 +2151,15 @@ auto Storage::Create(const StorageType& eStorageType, const PackType& ePackType)
             pStore = StorageFS::Instantiate();
             OT_ASSERT(nullptr != pStore);
             break;
+        case STORE_LMDB:
+            pStore = CreateStorageLMDB();
+
+            if (nullptr == pStore) {
+                LogError()(OT_PRETTY_STATIC(Storage))(
+                    "Failed: built without LMDB support.")
+                    .Flush();
+            }
+            break;
         //            case STORE_COUCH_DB:
         //                pStore = new StorageCouchDB; OT_ASSERT(nullptr !=
         //                pStore);
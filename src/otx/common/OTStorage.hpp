@@ -69,12 +69,13 @@ enum PackType  // PACKING TYPE
     PACK_TYPE_ERROR         // (Should never be.)
 };
 
-// Currently supporting filesystem, with subclasses possible via API.
+// Currently supporting filesystem and LMDB, with subclasses possible via API.
 //
 enum StorageType  // STORAGE TYPE
 {
     STORE_FILESYSTEM = 0,  // Filesystem
-    STORE_TYPE_SUBCLASS    // (Subclass provided by API client via SWIG.)
+    STORE_TYPE_SUBCLASS,   // (Subclass provided by API client via SWIG.)
+    STORE_LMDB             // Key-value store (if built with LMDB support)
 };
 
 extern const char* StoredObjectTypeStrings[];
@@ -133,6 +134,7 @@ class Storable;  // A storable object
                  // json lib...)
 class Storage;   // A storage context (database, filesystem, cloud, etc.
                  // to/from storage.)
+class StorageLMDB;
 
 // OTDB NAMESPACE "CONSTRUCTOR"
 //
@@ -582,7 +584,7 @@ public:
         const StorageType& eStorageType,
         const PackType& ePackType);  // FACTORY
 
-    StorageType GetType() const;
+    virtual StorageType GetType() const;
 };
 
 //
@@ -601,6 +603,41 @@ Storage* CreateStorageContext(
 
 Storable* CreateObject(const StoredObjectType eType);
 
+// Returns nullptr if opentxs was built without LMDB support.
+Storage* CreateStorageLMDB();
+
+// Stores dataFolder in LMDB from now on, copying its legacy filesystem layout
+// into the database the first time. Other data folders are not affected.
+// Returns false if the storage context is not STORE_LMDB or if the copy
+// failed, in which case dataFolder stays on the filesystem.
+bool MigrateFilesystemStorage(
+    Storage& storage,
+    const api::Session& api,
+    const UnallocatedCString& dataFolder);
+// Same as above, for the default storage context
+bool MigrateFilesystemStorage(
+    const api::Session& api,
+    const UnallocatedCString& dataFolder);
+
+// While an instance is alive, writes made through the default storage
+// context are committed together when it is destroyed instead of one at a
+// time. Has no effect for backends which can not batch writes.
+class StorageBatch
+{
+public:
+    StorageBatch() noexcept;
+
+    ~StorageBatch();
+
+private:
+    StorageLMDB* storage_;
+
+    StorageBatch(const StorageBatch&) = delete;
+    StorageBatch(StorageBatch&&) = delete;
+    StorageBatch& operator=(const StorageBatch&) = delete;
+    StorageBatch& operator=(StorageBatch&&) = delete;
+};
+
 // BELOW FUNCTIONS use the DEFAULT Storage context for the OTDB Namespace
 
 // Check if the values are good.
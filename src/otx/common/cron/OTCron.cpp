@@ -264,8 +264,8 @@ auto OTCron::GetMarketList(Armored& ascOutput, std::int32_t& nMarketCount)
 
         pMarketData->last_sale_date = pMarket->GetLastSaleDate();
 
-        const mapOfOffers::size_type theBidCount = pMarket->GetBidCount();
-        const mapOfOffers::size_type theAskCount = pMarket->GetAskCount();
+        const auto theBidCount = pMarket->GetBidCount();
+        const auto theAskCount = pMarket->GetAskCount();
 
         pMarketData->number_bids = std::to_string(theBidCount);
         pMarketData->number_asks = std::to_string(theAskCount);
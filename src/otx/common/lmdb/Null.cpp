@@ -0,0 +1,34 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"              // IWYU pragma: associated
+#include "1_Internal.hpp"            // IWYU pragma: associated
+#include "otx/common/OTStorage.hpp"  // IWYU pragma: associated
+
+namespace opentxs::OTDB
+{
+auto CreateStorageLMDB() -> Storage* { return nullptr; }
+
+auto MigrateFilesystemStorage(const api::Session&, const UnallocatedCString&)
+    -> bool
+{
+    return false;
+}
+
+auto MigrateFilesystemStorage(
+    Storage&,
+    const api::Session&,
+    const UnallocatedCString&) -> bool
+{
+    return false;
+}
+
+StorageBatch::StorageBatch() noexcept
+    : storage_(nullptr)
+{
+}
+
+StorageBatch::~StorageBatch() = default;
+}  // namespace opentxs::OTDB
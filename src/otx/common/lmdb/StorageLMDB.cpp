@@ -0,0 +1,671 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                     // IWYU pragma: associated
+#include "1_Internal.hpp"                   // IWYU pragma: associated
+#include "otx/common/lmdb/StorageLMDB.hpp"  // IWYU pragma: associated
+
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "internal/api/Legacy.hpp"
+#include "internal/api/session/Session.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/api/session/Session.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs::OTDB
+{
+auto CreateStorageLMDB() -> Storage* { return new StorageLMDB{}; }
+
+auto MigrateFilesystemStorage(
+    const api::Session& api,
+    const UnallocatedCString& dataFolder) -> bool
+{
+    auto* storage = GetDefaultStorage();
+
+    if (nullptr == storage) { return false; }
+
+    return MigrateFilesystemStorage(*storage, api, dataFolder);
+}
+
+auto MigrateFilesystemStorage(
+    Storage& storage,
+    const api::Session& api,
+    const UnallocatedCString& dataFolder) -> bool
+{
+    auto* lmdb = dynamic_cast<StorageLMDB*>(&storage);
+
+    if (nullptr == lmdb) { return false; }
+
+    return lmdb->Import(api, dataFolder);
+}
+
+StorageBatch::StorageBatch() noexcept
+    : storage_(dynamic_cast<StorageLMDB*>(GetDefaultStorage()))
+{
+    if (nullptr != storage_) { storage_->BeginBatch(); }
+}
+
+StorageBatch::~StorageBatch()
+{
+    if (nullptr != storage_) { storage_->EndBatch(); }
+}
+}  // namespace opentxs::OTDB
+
+namespace opentxs::OTDB
+{
+const storage::lmdb::TableNames StorageLMDB::names_{
+    {values_, "otdb"},
+    {meta_, "otdb_meta"},
+};
+
+StorageLMDB::Database::Database(const UnallocatedCString& folder) noexcept
+    : lmdb_(names_, folder, {{values_, 0}, {meta_, 0}})
+    , lock_()
+    , pending_()
+{
+}
+
+StorageLMDB::StorageLMDB() noexcept
+    : StorageFS()
+    , lock_()
+    , write_lock_()
+    , databases_()
+    , batches_(0)
+{
+}
+
+auto StorageLMDB::BeginBatch() noexcept -> void
+{
+    auto write = Lock{write_lock_};
+    ++batches_;
+}
+
+auto StorageLMDB::commit(const Lock&, Database& db) noexcept -> bool
+{
+    // NOTE readers wait while the batch is written so they never see a value
+    // which is neither pending nor committed
+    auto lock = eLock{db.lock_};
+
+    if (db.pending_.empty()) { return true; }
+
+    try {
+        auto tx = db.lmdb_.TransactionRW();
+
+        for (const auto& [key, value] : db.pending_) {
+            if (value.has_value()) {
+                const auto stored =
+                    db.lmdb_.Store(values_, key, value.value(), tx);
+
+                if (false == stored.first) {
+                    throw std::runtime_error{"Failed to store " + key};
+                }
+            } else {
+                // NOTE a missing key is not an error here
+                db.lmdb_.Delete(values_, key, tx);
+            }
+        }
+
+        if (false == tx.Finalize(true)) {
+            throw std::runtime_error{"Failed to commit transaction"};
+        }
+
+        db.pending_.clear();
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto StorageLMDB::EndBatch() noexcept -> void
+{
+    auto write = Lock{write_lock_};
+
+    OT_ASSERT(0 < batches_);
+
+    --batches_;
+    auto lock = sLock{lock_};
+
+    // NOTE every batch commits when it ends, even if another batch is still
+    // open, so that a caller never outlives its batch with uncommitted data
+    for (auto& [folder, db] : databases_) { commit(write, *db); }
+}
+
+auto StorageLMDB::erase(const UnallocatedCString& key, Database& db) noexcept
+    -> bool
+{
+    auto write = Lock{write_lock_};
+
+    if (0 < batches_) {
+        auto lock = eLock{db.lock_};
+        db.pending_[key] = std::nullopt;
+
+        return true;
+    }
+
+    return db.lmdb_.Delete(values_, key);
+}
+
+auto StorageLMDB::Exists(
+    const api::Session& api,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool
+{
+    const auto* db = get(dataFolder);
+
+    if (nullptr == db) {
+        return StorageFS::Exists(
+            api, dataFolder, strFolder, oneStr, twoStr, threeStr);
+    }
+
+    const auto key = Key(strFolder, oneStr, twoStr, threeStr);
+
+    if (key.empty()) { return false; }
+
+    return 0 < size(*db, key);
+}
+
+auto StorageLMDB::FormPathString(
+    const api::Session& api,
+    UnallocatedCString& strOutput,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> std::int64_t
+{
+    const auto* db = get(dataFolder);
+
+    if (nullptr == db) {
+        return StorageFS::FormPathString(
+            api, strOutput, dataFolder, strFolder, oneStr, twoStr, threeStr);
+    }
+
+    strOutput = Key(strFolder, oneStr, twoStr, threeStr);
+
+    if (strOutput.empty()) { return -1; }
+
+    return static_cast<std::int64_t>(size(*db, strOutput));
+}
+
+auto StorageLMDB::get(const UnallocatedCString& dataFolder) const noexcept
+    -> Database*
+{
+    auto lock = sLock{lock_};
+
+    if (auto i = databases_.find(dataFolder); databases_.end() != i) {
+
+        return i->second.get();
+    }
+
+    return nullptr;
+}
+
+auto StorageLMDB::GetType() const -> StorageType { return STORE_LMDB; }
+
+auto StorageLMDB::Import(
+    const api::Session& api,
+    const UnallocatedCString& dataFolder) noexcept -> bool
+{
+    auto write = Lock{write_lock_};
+
+    if (nullptr != get(dataFolder)) { return true; }
+
+    try {
+        const auto folder = boost::filesystem::path{dataFolder} / "otdb";
+        boost::filesystem::create_directories(folder);
+        LogVerbose()(OT_PRETTY_CLASS())("Using ")(folder.string()).Flush();
+        auto db = std::make_unique<Database>(folder.string());
+
+        // NOTE the data folder is only routed to the database once it holds
+        // every legacy file
+        if (false == import(write, api, dataFolder, *db)) { return false; }
+
+        auto lock = eLock{lock_};
+        databases_.emplace(dataFolder, std::move(db));
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto StorageLMDB::import(
+    const Lock&,
+    const api::Session& api,
+    const UnallocatedCString& dataFolder,
+    Database& db) noexcept -> bool
+{
+    namespace fs = boost::filesystem;
+    static constexpr auto marker = std::string_view{"filesystem"};
+
+    if (db.lmdb_.Exists(meta_, marker)) { return true; }
+
+    const auto& legacy = api.Internal().Legacy();
+    // NOTE Common() is the folder used by api::session::Storage, which is not
+    // part of the legacy layout
+    const auto folders = {
+        legacy.Account(),
+        legacy.Contract(),
+        legacy.Cron(),
+        legacy.ExpiredBox(),
+        legacy.Inbox(),
+        legacy.Market(),
+        legacy.Mint(),
+        legacy.Nym(),
+        legacy.Nymbox(),
+        legacy.Outbox(),
+        legacy.PaymentInbox(),
+        legacy.Receipt(),
+        legacy.RecordBox(),
+    };
+
+    try {
+        const auto root = fs::path{dataFolder};
+        using File = std::pair<UnallocatedCString, fs::path>;
+        auto files = UnallocatedVector<File>{};
+        const auto add = [&](const fs::path& file) {
+            auto parts = UnallocatedVector<UnallocatedCString>{};
+
+            for (const auto& part : file.lexically_relative(root)) {
+                parts.emplace_back(part.string());
+            }
+
+            const auto key = [&]() -> UnallocatedCString {
+                switch (parts.size()) {
+                    case 1: {
+
+                        return Key(".", parts[0], "", "");
+                    }
+                    case 2: {
+
+                        return Key(parts[0], parts[1], "", "");
+                    }
+                    case 3: {
+
+                        return Key(parts[0], parts[1], parts[2], "");
+                    }
+                    case 4: {
+
+                        return Key(parts[0], parts[1], parts[2], parts[3]);
+                    }
+                    default: {
+
+                        return {};
+                    }
+                }
+            }();
+
+            if (key.empty()) {
+                LogVerbose()(OT_PRETTY_CLASS())("Skipping ")(file.string())
+                    .Flush();
+
+                return;
+            }
+
+            files.emplace_back(key, file);
+        };
+
+        for (const auto& entry : fs::directory_iterator{root}) {
+            if (fs::is_regular_file(entry.status())) { add(entry.path()); }
+        }
+
+        for (const auto* folder : folders) {
+            const auto path = root / folder;
+
+            if (false == fs::is_directory(path)) { continue; }
+
+            for (const auto& entry : fs::recursive_directory_iterator{path}) {
+                if (fs::is_regular_file(entry.status())) { add(entry.path()); }
+            }
+        }
+
+        auto next = files.cbegin();
+
+        while (files.cend() != next) {
+            const auto count = std::min<std::ptrdiff_t>(
+                import_batch_, std::distance(next, files.cend()));
+            const auto end = std::next(next, count);
+            auto tx = db.lmdb_.TransactionRW();
+
+            for (; end != next; ++next) {
+                const auto& path = next->second;
+                auto file = std::ifstream{
+                    path.string(), std::ios::in | std::ios::binary};
+                const auto value = UnallocatedCString{
+                    std::istreambuf_iterator<char>{file},
+                    std::istreambuf_iterator<char>{}};
+
+                if (file.bad()) {
+                    throw std::runtime_error{
+                        "Failed to read " + path.string()};
+                }
+
+                if (false == db.lmdb_.Store(values_, next->first, value, tx)
+                                 .first) {
+                    throw std::runtime_error{
+                        "Failed to store " + next->first};
+                }
+            }
+
+            if (false == tx.Finalize(true)) {
+                throw std::runtime_error{"Failed to commit transaction"};
+            }
+        }
+
+        const auto stored =
+            db.lmdb_.Store(meta_, marker, std::to_string(files.size()));
+
+        if (false == stored.first) {
+            throw std::runtime_error{"Failed to record migration"};
+        }
+
+        LogDetail()(OT_PRETTY_CLASS())("Imported ")(files.size())(
+            " files from ")(dataFolder)
+            .Flush();
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto StorageLMDB::Key(
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) noexcept -> UnallocatedCString
+{
+    // NOTE these are the same rules StorageFS applies when it forms a path
+    const auto valid = [](const auto& in) { return 3 <= in.size(); };
+    const auto haveZero = valid(strFolder);
+    const auto haveTwo = valid(twoStr);
+    const auto haveThree = valid(threeStr);
+
+    if ((false == haveZero) && ("." != strFolder)) { return {}; }
+
+    if (false == valid(oneStr)) { return {}; }
+
+    if ((false == haveTwo) && haveThree) { return {}; }
+
+    auto output = UnallocatedCString{};
+
+    if (haveZero) { output.append(strFolder).append("/"); }
+
+    output.append(oneStr);
+
+    if (haveTwo) {
+        output.append("/").append(twoStr);
+
+        if (haveThree) { output.append("/").append(threeStr); }
+    }
+
+    return output;
+}
+
+auto StorageLMDB::load(
+    const Database& db,
+    const UnallocatedCString& key,
+    UnallocatedCString& value) const noexcept -> bool
+{
+    value.clear();
+
+    {
+        auto lock = sLock{db.lock_};
+
+        if (auto i = db.pending_.find(key); db.pending_.end() != i) {
+            const auto& pending = i->second;
+
+            if (false == pending.has_value()) { return false; }
+
+            value = pending.value();
+
+            return true;
+        }
+    }
+
+    return db.lmdb_.Load(
+        values_, key, [&](const auto data) -> void { value = data; });
+}
+
+auto StorageLMDB::onEraseValueByKey(
+    const api::Session& api,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool
+{
+    auto* db = get(dataFolder);
+
+    if (nullptr == db) {
+        return StorageFS::onEraseValueByKey(
+            api, dataFolder, strFolder, oneStr, twoStr, threeStr);
+    }
+
+    const auto key = Key(strFolder, oneStr, twoStr, threeStr);
+
+    if (key.empty()) {
+        LogError()(OT_PRETTY_CLASS())("Invalid location.").Flush();
+
+        return false;
+    }
+
+    if (false == erase(key, *db)) {
+        LogError()(OT_PRETTY_CLASS())("Failed to erase ")(key).Flush();
+
+        return false;
+    }
+
+    return true;
+}
+
+auto StorageLMDB::onQueryPackedBuffer(
+    const api::Session& api,
+    PackedBuffer& theBuffer,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool
+{
+    const auto* db = get(dataFolder);
+
+    if (nullptr == db) {
+        return StorageFS::onQueryPackedBuffer(
+            api, theBuffer, dataFolder, strFolder, oneStr, twoStr, threeStr);
+    }
+
+    const auto key = Key(strFolder, oneStr, twoStr, threeStr);
+
+    if (key.empty()) {
+        LogError()(OT_PRETTY_CLASS())("Invalid location.").Flush();
+
+        return false;
+    }
+
+    auto value = UnallocatedCString{};
+
+    if ((false == load(*db, key, value)) || value.empty()) {
+        LogDetail()(OT_PRETTY_CLASS())("Failure reading from ")(
+            key)(": value does not exist.")
+            .Flush();
+
+        return false;
+    }
+
+    theBuffer.SetData(
+        reinterpret_cast<const std::uint8_t*>(value.data()), value.size());
+
+    return true;
+}
+
+auto StorageLMDB::onQueryPlainString(
+    const api::Session& api,
+    UnallocatedCString& theBuffer,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool
+{
+    const auto* db = get(dataFolder);
+
+    if (nullptr == db) {
+        return StorageFS::onQueryPlainString(
+            api, theBuffer, dataFolder, strFolder, oneStr, twoStr, threeStr);
+    }
+
+    const auto key = Key(strFolder, oneStr, twoStr, threeStr);
+
+    if (key.empty()) {
+        LogError()(OT_PRETTY_CLASS())("Invalid location.").Flush();
+
+        return false;
+    }
+
+    if ((false == load(*db, key, theBuffer)) || theBuffer.empty()) {
+        LogDetail()(OT_PRETTY_CLASS())("Failure reading from ")(
+            key)(": value does not exist.")
+            .Flush();
+
+        return false;
+    }
+
+    return true;
+}
+
+auto StorageLMDB::onStorePackedBuffer(
+    const api::Session& api,
+    PackedBuffer& theBuffer,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool
+{
+    auto* db = get(dataFolder);
+
+    if (nullptr == db) {
+        return StorageFS::onStorePackedBuffer(
+            api, theBuffer, dataFolder, strFolder, oneStr, twoStr, threeStr);
+    }
+
+    const auto key = Key(strFolder, oneStr, twoStr, threeStr);
+
+    if (key.empty()) {
+        LogError()(OT_PRETTY_CLASS())("Invalid location.").Flush();
+
+        return false;
+    }
+
+    const auto value = ReadView{
+        reinterpret_cast<const char*>(theBuffer.GetData()),
+        theBuffer.GetSize()};
+
+    if (false == store(key, value, *db)) {
+        LogError()(OT_PRETTY_CLASS())("Error writing to ")(key).Flush();
+
+        return false;
+    }
+
+    return true;
+}
+
+auto StorageLMDB::onStorePlainString(
+    const api::Session& api,
+    const UnallocatedCString& theBuffer,
+    const UnallocatedCString& dataFolder,
+    const UnallocatedCString& strFolder,
+    const UnallocatedCString& oneStr,
+    const UnallocatedCString& twoStr,
+    const UnallocatedCString& threeStr) -> bool
+{
+    auto* db = get(dataFolder);
+
+    if (nullptr == db) {
+        return StorageFS::onStorePlainString(
+            api, theBuffer, dataFolder, strFolder, oneStr, twoStr, threeStr);
+    }
+
+    const auto key = Key(strFolder, oneStr, twoStr, threeStr);
+
+    if (key.empty()) {
+        LogError()(OT_PRETTY_CLASS())("Invalid location.").Flush();
+
+        return false;
+    }
+
+    if (false == store(key, theBuffer, *db)) {
+        LogError()(OT_PRETTY_CLASS())("Error writing to ")(key).Flush();
+
+        return false;
+    }
+
+    return true;
+}
+
+auto StorageLMDB::size(const Database& db, const UnallocatedCString& key)
+    const noexcept -> std::size_t
+{
+    {
+        auto lock = sLock{db.lock_};
+
+        if (auto i = db.pending_.find(key); db.pending_.end() != i) {
+            const auto& pending = i->second;
+
+            return pending.has_value() ? pending.value().size() : 0u;
+        }
+    }
+
+    auto output = std::size_t{0};
+    db.lmdb_.Load(
+        values_, key, [&](const auto data) -> void { output = data.size(); });
+
+    return output;
+}
+
+auto StorageLMDB::store(
+    const UnallocatedCString& key,
+    const ReadView value,
+    Database& db) noexcept -> bool
+{
+    auto write = Lock{write_lock_};
+
+    if (0 < batches_) {
+        auto lock = eLock{db.lock_};
+        db.pending_[key] = UnallocatedCString{value};
+
+        return true;
+    }
+
+    return db.lmdb_.Store(values_, key, value).first;
+}
+
+StorageLMDB::~StorageLMDB()
+{
+    auto write = Lock{write_lock_};
+
+    for (auto& [folder, db] : databases_) { commit(write, *db); }
+}
+}  // namespace opentxs::OTDB
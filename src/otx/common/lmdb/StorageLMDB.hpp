@@ -0,0 +1,185 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+
+#include "internal/util/Mutex.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "otx/common/OTStorage.hpp"
+#include "util/LMDB.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace api
+{
+class Session;
+}  // namespace api
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::OTDB
+{
+// Key-value replacement for StorageFS. Every (strFolder, oneStr, twoStr,
+// threeStr) location maps to the same relative path StorageFS would have
+// used, so each lookup is a single B-tree search instead of a series of
+// stat and open calls. One environment is opened per data folder.
+//
+// Only data folders passed to Import() are stored in LMDB. Every other data
+// folder is handled by StorageFS, so other sessions in the same process which
+// share the default storage context keep their files where they were.
+//
+// Writes made while a StorageBatch is alive are held in memory (and are
+// visible to readers) until the batch ends, at which point they are written
+// in a single transaction. Readers use LMDB read transactions and never wait
+// for writers except while a batch is being committed.
+class StorageLMDB final : public StorageFS
+{
+public:
+    // Returns an empty string if the location would be rejected by StorageFS
+    static auto Key(
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) noexcept -> UnallocatedCString;
+
+    auto BeginBatch() noexcept -> void;
+    auto EndBatch() noexcept -> void;
+    bool Exists(
+        const api::Session& api,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) override;
+    std::int64_t FormPathString(
+        const api::Session& api,
+        UnallocatedCString& strOutput,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) override;
+    StorageType GetType() const override;
+    // Stores dataFolder in LMDB from now on. The legacy files are copied into
+    // the database the first time this is called for a data folder.
+    auto Import(
+        const api::Session& api,
+        const UnallocatedCString& dataFolder) noexcept -> bool;
+
+    StorageLMDB() noexcept;
+
+    ~StorageLMDB() override;
+
+protected:
+    bool onStorePackedBuffer(
+        const api::Session& api,
+        PackedBuffer& theBuffer,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) override;
+    bool onQueryPackedBuffer(
+        const api::Session& api,
+        PackedBuffer& theBuffer,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) override;
+    bool onStorePlainString(
+        const api::Session& api,
+        const UnallocatedCString& theBuffer,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) override;
+    bool onQueryPlainString(
+        const api::Session& api,
+        UnallocatedCString& theBuffer,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) override;
+    bool onEraseValueByKey(
+        const api::Session& api,
+        const UnallocatedCString& dataFolder,
+        const UnallocatedCString& strFolder,
+        const UnallocatedCString& oneStr,
+        const UnallocatedCString& twoStr,
+        const UnallocatedCString& threeStr) override;
+
+private:
+    using LMDB = storage::lmdb::LMDB;
+    using Table = storage::lmdb::Table;
+    using Pending =
+        UnallocatedMap<UnallocatedCString, std::optional<UnallocatedCString>>;
+
+    struct Database {
+        LMDB lmdb_;
+        // NOTE guards pending_ only
+        mutable std::shared_mutex lock_;
+        Pending pending_;
+
+        Database(const UnallocatedCString& folder) noexcept;
+    };
+
+    using Databases =
+        UnallocatedMap<UnallocatedCString, std::unique_ptr<Database>>;
+
+    static constexpr auto values_ = Table{0};
+    static constexpr auto meta_ = Table{1};
+    static constexpr auto import_batch_ = std::size_t{1024};
+    static const storage::lmdb::TableNames names_;
+
+    // NOTE guards databases_. Entries are never removed before the destructor
+    // runs so a Database may be used after the lock is released.
+    mutable std::shared_mutex lock_;
+    // NOTE serializes writers and guards batches_
+    std::mutex write_lock_;
+    Databases databases_;
+    std::size_t batches_;
+
+    auto get(const UnallocatedCString& dataFolder) const noexcept
+        -> Database*;
+    auto load(
+        const Database& db,
+        const UnallocatedCString& key,
+        UnallocatedCString& value) const noexcept -> bool;
+    auto size(const Database& db, const UnallocatedCString& key)
+        const noexcept -> std::size_t;
+
+    auto commit(const Lock& write, Database& db) noexcept -> bool;
+    auto erase(const UnallocatedCString& key, Database& db) noexcept -> bool;
+    auto import(
+        const Lock& write,
+        const api::Session& api,
+        const UnallocatedCString& dataFolder,
+        Database& db) noexcept -> bool;
+    auto store(
+        const UnallocatedCString& key,
+        const ReadView value,
+        Database& db) noexcept -> bool;
+
+    StorageLMDB(const StorageLMDB&) = delete;
+    StorageLMDB(StorageLMDB&&) = delete;
+    auto operator=(const StorageLMDB&) -> StorageLMDB& = delete;
+    auto operator=(StorageLMDB&&) -> StorageLMDB& = delete;
+};
+}  // namespace opentxs::OTDB
@@ -7,11 +7,14 @@
 #include "1_Internal.hpp"                          // IWYU pragma: associated
 #include "internal/otx/common/trade/OTMarket.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "internal/api/Legacy.hpp"
@@ -57,9 +60,7 @@ OTMarket::OTMarket(const api::Session& api, const char* szFilename)
     : Contract(api)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
-    , m_mapOffers()
+    , book_()
     , m_NOTARY_ID(identifier::Notary::Factory())
     , m_INSTRUMENT_DEFINITION_ID(identifier::UnitDefinition::Factory())
     , m_CURRENCY_TYPE_ID(identifier::UnitDefinition::Factory())
@@ -78,9 +79,7 @@ OTMarket::OTMarket(const api::Session& api)
     : Contract(api)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
-    , m_mapOffers()
+    , book_()
     , m_NOTARY_ID(identifier::Notary::Factory())
     , m_INSTRUMENT_DEFINITION_ID(identifier::UnitDefinition::Factory())
     , m_CURRENCY_TYPE_ID(identifier::UnitDefinition::Factory())
@@ -100,9 +99,7 @@ OTMarket::OTMarket(
     : Contract(api)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
-    , m_mapOffers()
+    , book_()
     , m_NOTARY_ID(NOTARY_ID)
     , m_INSTRUMENT_DEFINITION_ID(INSTRUMENT_DEFINITION_ID)
     , m_CURRENCY_TYPE_ID(CURRENCY_TYPE_ID)
@@ -236,37 +233,27 @@ void OTMarket::UpdateContents(const PasswordPrompt& reason)
         return buf;
     }());
 
-    // Save the offers for sale.
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
+    // Offers are saved in matching order so that offers at the same price
+    // keep their priority when the market is loaded.
+    const auto save = [&](OTOffer& offer) {
+        auto strOffer = String::Factory(offer);  // Extract the offer contract
+                                                 // into string form.
         auto ascOffer =
             Armored::Factory(strOffer);  // Base64-encode that for storage.
 
         TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
         tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
+            "dateAdded", formatTimestamp(offer.GetDateAddedToMarket()));
         tag.add_tag(tagOffer);
-    }
 
-    // Save the bids.
-    for (auto& it : m_mapBids) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
+        return true;
+    };
 
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
-        auto ascOffer =
-            Armored::Factory(strOffer);  // Base64-encode that for storage.
+    // Save the offers for sale.
+    book_.Visit(false, save);
 
-        TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
-        tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
-        tag.add_tag(tagOffer);
-    }
+    // Save the bids.
+    book_.Visit(true, save);
 
     UnallocatedCString str_result;
     tag.output(str_result);
@@ -276,16 +263,7 @@ void OTMarket::UpdateContents(const PasswordPrompt& reason)
 
 auto OTMarket::GetTotalAvailableAssets() -> Amount
 {
-    Amount lTotal = 0;
-
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        lTotal += pOffer->GetAmountAvailable();
-    }
-
-    return lTotal;
+    return book_.AskVolume();
 }
 
 // Get list of offers for a particular Nym, to send that Nym
@@ -298,13 +276,19 @@ auto OTMarket::GetNym_OfferList(
     nNymOfferCount =
         0;  // Outputs the count of offers for NYM_ID (on this market.)
 
+    auto offers = otx::OrderBook::Offers{};
+    const auto collect = [&](OTOffer& offer) {
+        offers.emplace_back(&offer);
+
+        return true;
+    };
+    book_.Visit(true, collect);
+    book_.Visit(false, collect);
+
     // Loop through the offers, up to some maximum depth, and then add each
     // as a data member to an offer list, then pack it into ascOutput.
     //
-    for (auto& it : m_mapOffers) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
+    for (auto* pOffer : offers) {
         OTTrade* pTrade = pOffer->GetTrade();
 
         // We only return offers for a specific Nym ID, since this is private
@@ -501,24 +485,16 @@ auto OTMarket::GetOfferList(
         dynamic_cast<OTDB::OfferListMarket*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_OFFER_LIST_MARKET)));
 
-    //    mapOfOffers            m_mapBids;        // The buyers, ordered by
-    // price limit
-    //    mapOfOffers            m_mapAsks;        // The sellers, ordered by
-    // price limit
-
-    std::int32_t nTempDepth = 0;
+    // Only the best offers on each side are visited. Market orders are
+    // skipped.
+    const auto depth =
+        static_cast<std::size_t>(std::max<std::int64_t>(lDepth, 0));
 
-    for (auto& it : m_mapBids) {
-        if (nTempDepth++ > lDepth) break;
-
-        OTOffer* pOffer = it.second;
+    for (auto* pOffer : book_.Top(true, depth)) {
         OT_ASSERT(nullptr != pOffer);
 
         const Amount& lPriceLimit = pOffer->GetPriceLimit();
 
-        if (0 == lPriceLimit)  // Skipping any market orders.
-            continue;
-
         // OfferDataMarket
         std::unique_ptr<OTDB::BidData> pOfferData(dynamic_cast<OTDB::BidData*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_BID_DATA)));
@@ -554,12 +530,7 @@ auto OTMarket::GetOfferList(
         nOfferCount++;
     }
 
-    nTempDepth = 0;
-
-    for (auto& it : m_mapAsks) {
-        if (nTempDepth++ > lDepth) break;
-
-        OTOffer* pOffer = it.second;
+    for (auto* pOffer : book_.Top(false, depth)) {
         OT_ASSERT(nullptr != pOffer);
 
         // OfferDataMarket"
@@ -642,33 +613,17 @@ auto OTMarket::GetOfferList(
     return false;
 }
 
-// To insure that offers of a specific price are always inserted at the upper
-// bound,
-// use this:  my_mmap.insert(my_mmap.upper_bound(key), my_mmap::value_type(key,
-// val));
-// This way I can read them from the lower bound later, and always get them in
-// the
-// order received for that price.
-//
-// typedef UnallocatedMultimap<std::int64_t, OTOffer *>    mapOfOffers;
-// mapOfOffers    m_mapBids; // The buyers, ordered
-// mapOfOffers    m_mapAsks; // The sellers, ordered
-
 auto OTMarket::GetOffer(const std::int64_t& lTransactionNum) -> OTOffer*
 {
     // See if there's something there with that transaction number.
-    auto it = m_mapOffers.find(lTransactionNum);
+    OTOffer* pOffer = book_.Find(lTransactionNum);
 
-    if (it == m_mapOffers.end()) {
+    if (nullptr == pOffer) {
         // nothing found.
         return nullptr;
     }
     // Found it!
     else {
-        OTOffer* pOffer = it->second;
-
-        OT_ASSERT((nullptr != pOffer));
-
         if (pOffer->GetTransactionNum() == lTransactionNum)
             return pOffer;
         else
@@ -687,88 +642,23 @@ auto OTMarket::RemoveOffer(
     const std::int64_t& lTransactionNum,
     const PasswordPrompt& reason) -> bool
 {
-    bool bReturnValue = false;
-
-    // See if there's something there with that transaction number.
-    auto it = m_mapOffers.find(lTransactionNum);
+    // The order book finds the offer by transaction number and unlinks it
+    // from its price level without searching.
+    OTOffer* pOffer = book_.Remove(lTransactionNum);
 
     // If it's not already on the list, then there's nothing to remove.
-    if (it == m_mapOffers.end()) {
+    if (nullptr == pOffer) {
         LogError()(OT_PRETTY_CLASS())(
             "Attempt to remove non-existent Offer from Market. "
             "Transaction #: ")(lTransactionNum)(".")
             .Flush();
         return false;
     }
-    // Otherwise, if it WAS already there, remove it properly.
-    else {
-        OTOffer* pOffer = it->second;
 
-        OT_ASSERT(nullptr != pOffer);
+    delete pOffer;
+    pOffer = nullptr;
 
-        // This removes it from one list (the one indexed by transaction
-        // number.)
-        // But it's still on one of the other lists...
-        m_mapOffers.erase(it);
-
-        // The code operates the same whether ask or bid. Just use a pointer.
-        mapOfOffers* pMap = (pOffer->IsBid() ? &m_mapBids : &m_mapAsks);
-
-        // Future solution here: instead of looping through all the offers and
-        // finding it,
-        // I could just have each Offer store a copy of the iterator that's
-        // returned when
-        // it's first inserted. Later I just erase that iterator from the right
-        // list to remove. Todo.
-        OTOffer* pSameOffer = nullptr;
-
-        for (auto iii = pMap->begin(); iii != pMap->end(); ++iii) {
-            pSameOffer = iii->second;
-
-            OT_ASSERT_MSG(
-                nullptr != pSameOffer,
-                "nullptr offer pointer in OTMarket::RemoveOffer.\n");
-
-            // found it!
-            if (lTransactionNum == pSameOffer->GetTransactionNum()) {
-                pMap->erase(iii);
-                break;
-            }
-
-            // Later on, below this loop, this pointer will be nullptr or not,
-            // and
-            // I will know if it was removed.
-            pSameOffer = nullptr;
-        }
-
-        if (nullptr == pSameOffer) {
-            LogError()(OT_PRETTY_CLASS())(
-                "Removed offer from offers list, but not found on bid/ask "
-                "list.")
-                .Flush();
-        } else  // This means it was found and removed from the second list as
-                // well.
-        {
-            bReturnValue = true;  // Success.
-        }
-
-        // pOffer was found on the Offers list.
-        // pSameOffer was found on the Bid or Ask list, with the same
-        // transaction ID.
-        // They SHOULD be pointers to the SAME object.
-        // Therefore I CANNOT delete them both.
-        //
-        OT_ASSERT(pOffer == pSameOffer);
-
-        delete pOffer;
-        pOffer = nullptr;
-        pSameOffer = nullptr;
-    }
-
-    if (bReturnValue)
-        return SaveMarket(reason);  // <====== SAVE since an offer was removed.
-    else
-        return false;
+    return SaveMarket(reason);  // <====== SAVE since an offer was removed.
 }
 
 // This method demands an Offer reference in order to verify that it really
@@ -786,7 +676,6 @@ auto OTMarket::AddOffer(
     const Time tDateAddedToMarket) -> bool
 {
     const std::int64_t lTransactionNum = theOffer.GetTransactionNum();
-    const Amount& lPriceLimit = theOffer.GetPriceLimit();
 
     // Make sure the offer is even appropriate for this market...
     if (!ValidateOfferForMarket(theOffer)) {
@@ -796,24 +685,10 @@ auto OTMarket::AddOffer(
 
         if (nullptr != pTrade) pTrade->FlagForRemoval();
     } else {
-        // I store duplicate lists of offer pointers. Two multimaps ordered by
-        // price,
-        // (for buyers and sellers) and one map ordered by transaction number.
-
-        // See if there's something else already there with the same transaction
-        // number.
-        //
-        auto it = m_mapOffers.find(lTransactionNum);
-
-        // If it's not already on the list, then add it...
-        if (it == m_mapOffers.end()) {
-            m_mapOffers[lTransactionNum] = &theOffer;
-            LogTrace()(OT_PRETTY_CLASS())(
-                "Offer added as an offer to the market.")
-                .Flush();
-        }
-        // Otherwise, if it was already there, log an error.
-        else {
+        // The order book places the offer last in line at its price level
+        // unless an offer with the same transaction number is already on the
+        // market.
+        if (false == book_.Add(theOffer)) {
             LogError()(OT_PRETTY_CLASS())(
                 "Attempt to add Offer to Market with pre-existing "
                 "transaction number: ")(lTransactionNum)(".")
@@ -821,35 +696,9 @@ auto OTMarket::AddOffer(
             return false;
         }
 
-        // Okay so we successfully added it to one list (indexed by Transaction
-        // Num) and we
-        // know it validated as an offer, AND we know it wasn't already on the
-        // market.
-        //
-        // So next, let's add it to the lists that are indexed by price:
-
-        // Determine if it's a buy or sell, and add it to the right list.
-        if (theOffer.IsBid()) {
-            // No bother checking if the offer is already on this list,
-            // since the code above basically already verifies that for us.
-
-            m_mapBids.insert(
-                m_mapBids.lower_bound(lPriceLimit),  // highest bidders go
-                                                     // first, so I am last in
-                                                     // line at lower bound.
-                std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer));
-            LogTrace()(OT_PRETTY_CLASS())("Offer added as a bid to the market.")
-                .Flush();
-        } else {
-            m_mapAsks.insert(
-                m_mapAsks.upper_bound(lPriceLimit),  // lowest price sells
-                                                     // first, so I am last in
-                                                     // line at upper bound.
-                std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer));
-            LogTrace()(OT_PRETTY_CLASS())(
-                "Offer added as an ask to the market.")
-                .Flush();
-        }
+        LogTrace()(OT_PRETTY_CLASS())("Offer added as ")(
+            theOffer.IsBid() ? "a bid" : "an ask")(" to the market.")
+            .Flush();
 
         if (bSaveFile) {
             // Set this to the current date/time, since the offer is
@@ -998,47 +847,11 @@ void OTMarket::GetIdentifier(Identifier& theIdentifier) const
 
 // returns 0 if there are no bids. Otherwise returns the value of the highest
 // bid on the market.
-auto OTMarket::GetHighestBidPrice() -> Amount
-{
-    Amount lPrice = 0;
-
-    auto rr = m_mapBids.rbegin();
-
-    if (rr != m_mapBids.rend()) { lPrice = rr->first; }
-
-    return lPrice;
-}
+auto OTMarket::GetHighestBidPrice() -> Amount { return book_.BestBid(); }
 
 // returns 0 if there are no asks. Otherwise returns the value of the lowest ask
 // on the market.
-auto OTMarket::GetLowestAskPrice() -> Amount
-{
-    Amount lPrice = 0;
-
-    auto it = m_mapAsks.begin();
-
-    if (it != m_mapAsks.end()) {
-        lPrice = it->first;
-
-        // Market orders have a 0 price, so we need to skip any if they are
-        // here.
-        //
-        // Note that we don't have to do this with the highest bid price (above
-        // function) but in the case of asks, a "0 price" will undercut the
-        // other
-        // actual prices, so we need to skip any that have a 0 price.
-        //
-        while (0 == lPrice) {
-            ++it;
-
-            if (it == m_mapAsks.end()) break;
-
-            lPrice = it->first;
-        }
-    }
-
-    return lPrice;
-}
+auto OTMarket::GetLowestAskPrice() -> Amount { return book_.BestAsk(); }
 
 // This utility function is used directly below (only).
 // It is ASSUMED that the first two accounts are DEBITS, and the second two
@@ -1928,6 +1741,9 @@ void OTMarket::ProcessTrade(
                 theOtherOffer.IncrementFinishedSoFar(
                     lOtherOfferFinished);  // I was storing these up in
                                            // the loop above.
+                book_.Fill(theOffer.GetTransactionNum(), lOfferFinished);
+                book_.Fill(
+                    theOtherOffer.GetTransactionNum(), lOtherOfferFinished);
 
                 // These have updated values, so let's save them.
                 theTrade.ReleaseSignatures();
@@ -2485,19 +2301,20 @@ auto OTMarket::ProcessTrade(
     // THIS TRADE'S PRICE LIMITS. So we're going to go up the list of
     // what's available, and trade.
 
+    // Set if the trade is finished with the market before every relevant
+    // offer has been visited.
+    auto keep = std::optional<bool>{};
+
     if (theOffer.IsAsk())  // If I'm selling,
     {
-        // rbegin puts us on the upper bound of the highest bidder (any
-        // new bidders at the same price would be added at the lower
-        // bound, where they are last in line.) The upper bound, on the
-        // other hand, is first in line.  So we start there, and loop
-        // backwards until there are no other bids within my price
-        // range.
-        for (auto rr = m_mapBids.rbegin(); rr != m_mapBids.rend(); ++rr) {
+        // The order book visits the highest bidder first. Bidders at the
+        // same price are visited in the order they were added, so the
+        // first in line goes first. We loop until there are no other bids
+        // within my price range.
+        book_.Visit(true, [&](OTOffer& bid) {
             // then I want to start at the highest bidder and loop DOWN
             // until hitting my price limit.
-            OTOffer* pBid = rr->second;
-            OT_ASSERT(nullptr != pBid);
+            OTOffer* pBid = &bid;
 
             // NOTE: Market orders only process once, and they are
             // processed in the order they were added to the market.
@@ -2515,7 +2332,7 @@ auto OTMarket::ProcessTrade(
                 //          if (theOffer.IsMarketOrder() &&
                 // pBid->IsMarketOrder())
                 //              continue;
-                break;
+                return false;
             // NOTE: Why break, instead of continue? Because since we
             // are looping through the bids, from the HIGHEST down to
             // the LOWEST, and since market orders have a ZERO price, we
@@ -2561,9 +2378,10 @@ auto OTMarket::ProcessTrade(
             // all the remaining bids are even lower.)
             //
             else if (theOffer.IsLimitOrder()) {
-                pBid = nullptr;
-                return true;  // stay on cron for more processing (for
+                keep = true;  // stay on cron for more processing (for
                               // now.)
+
+                return false;
             }
 
             // The offer has no more trading to do--it's done.
@@ -2583,26 +2401,25 @@ auto OTMarket::ProcessTrade(
                     theOffer.GetAmountAvailable(), unittype)
                     .Flush();
 
-                return false;  // remove this trade from cron
+                keep = false;  // remove this trade from cron
+
+                return false;
             }
 
-            pBid = nullptr;
-        }
+            return true;
+        });
     }
     // I'm buying
     else {
-        // Begin puts us on the lower bound of the lowest seller (any
-        // new sellers at the same price would be added at the upper
-        // bound for that price, where they are last in line.) The lower
-        // bound, on the other hand, is first in line.  So we start
-        // there, and loop forwards until there are no other asks within
-        // my price range.
+        // The order book visits the lowest seller first. Sellers at the
+        // same price are visited in the order they were added, so the
+        // first in line goes first. We loop until there are no other asks
+        // within my price range.
         //
-        for (auto& it : m_mapAsks) {
+        book_.Visit(false, [&](OTOffer& ask) {
             // then I want to start at the lowest seller and loop UP
             // until hitting my price limit.
-            OTOffer* pAsk = it.second;
-            OT_ASSERT(nullptr != pAsk);
+            OTOffer* pAsk = &ask;
 
             // NOTE: Market orders only process once, and they are
             // processed in the order they were added to the market.
@@ -2619,7 +2436,7 @@ auto OTMarket::ProcessTrade(
             if (pAsk->IsMarketOrder())
                 //          if (theOffer.IsMarketOrder() &&
                 // pAsk->IsMarketOrder())
-                continue;
+                return true;
 
             // I'm buying.
             // If the ask price is less than, or equal to, my price
@@ -2651,8 +2468,9 @@ auto OTMarket::ProcessTrade(
             // Else, the ask price is higher than I am willing to pay.
             // (And all the remaining sellers are even HIGHER.)
             else if (theOffer.IsLimitOrder()) {
-                pAsk = nullptr;
-                return true;  // stay on the market for now.
+                keep = true;  // stay on the market for now.
+
+                return false;
             }
 
             // The offer has no more trading to do--it's done.
@@ -2672,13 +2490,17 @@ auto OTMarket::ProcessTrade(
                     theOffer.GetAmountAvailable(), unittype)
                     .Flush();
 
-                return false;  // remove this trade from the market.
+                keep = false;  // remove this trade from the market.
+
+                return false;
             }
 
-            pAsk = nullptr;
-        }
+            return true;
+        });
     }
 
+    if (keep.has_value()) { return keep.value(); }
+
     // Market orders only process once.
     // (So tell the caller to remove it.)
     //
@@ -2849,18 +2671,7 @@ void OTMarket::Release_Market()
 
     // If there were any dynamically allocated objects, clean them up
     // here.
-    while (!m_mapBids.empty()) {
-        OTOffer* pOffer = m_mapBids.begin()->second;
-        m_mapBids.erase(m_mapBids.begin());
-        delete pOffer;
-        pOffer = nullptr;
-    }
-    while (!m_mapAsks.empty()) {
-        OTOffer* pOffer = m_mapAsks.begin()->second;
-        m_mapAsks.erase(m_mapAsks.begin());
-        delete pOffer;
-        pOffer = nullptr;
-    }
+    for (auto* pOffer : book_.Clear()) { delete pOffer; }
 }
 
 void OTMarket::Release()
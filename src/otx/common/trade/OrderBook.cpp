@@ -0,0 +1,221 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                             // IWYU pragma: associated
+#include "1_Internal.hpp"                           // IWYU pragma: associated
+#include "internal/otx/common/trade/OrderBook.hpp"  // IWYU pragma: associated
+
+#include <iterator>
+#include <utility>
+
+#include "internal/otx/common/trade/OTOffer.hpp"
+#include "internal/util/LogMacros.hpp"
+
+namespace opentxs::otx
+{
+OrderBook::OrderBook() noexcept
+    : bids_()
+    , asks_()
+    , index_()
+{
+}
+
+auto OrderBook::Add(OTOffer& offer) noexcept -> bool
+{
+    const auto number = offer.GetTransactionNum();
+
+    if (0u < index_.count(number)) { return false; }
+
+    const auto bid = offer.IsBid();
+    const auto volume = offer.GetAmountAvailable();
+    auto& side = bid ? bids_ : asks_;
+    auto level = side.levels_.try_emplace(offer.GetPriceLimit()).first;
+    auto& offers = level->second.offers_;
+    level->second.volume_ += volume;
+    offers.emplace_back(&offer);
+    ++side.count_;
+    side.volume_ += volume;
+    index_.try_emplace(number, Position{bid, level, std::prev(offers.end())});
+
+    return true;
+}
+
+auto OrderBook::BestAsk() const noexcept -> Amount
+{
+    const auto& levels = asks_.levels_;
+    auto i = levels.begin();
+
+    if ((levels.end() != i) && (0 == i->first)) { ++i; }
+
+    if (levels.end() == i) { return 0; }
+
+    return i->first;
+}
+
+auto OrderBook::BestBid() const noexcept -> Amount
+{
+    const auto& levels = bids_.levels_;
+
+    if (levels.empty()) { return 0; }
+
+    return levels.rbegin()->first;
+}
+
+auto OrderBook::Clear() noexcept -> Offers
+{
+    auto output = Offers{};
+    output.reserve(index_.size());
+
+    for (auto* side : {&bids_, &asks_}) {
+        for (auto& [price, level] : side->levels_) {
+            std::move(
+                level.offers_.begin(),
+                level.offers_.end(),
+                std::back_inserter(output));
+        }
+
+        *side = Side{};
+    }
+
+    index_.clear();
+
+    return output;
+}
+
+auto OrderBook::Crosses() const noexcept -> bool
+{
+    const auto bid = BestBid();
+    const auto ask = BestAsk();
+
+    return (0 != bid) && (0 != ask) && (bid >= ask);
+}
+
+auto OrderBook::Depth(const bool bids, const std::size_t count) const noexcept
+    -> Levels
+{
+    auto output = Levels{};
+    const auto add = [&](const auto& item) {
+        const auto& [price, level] = item;
+
+        if (0 == price) { return true; }
+
+        output.emplace_back(Level{price, level.volume_, level.offers_.size()});
+
+        return output.size() < count;
+    };
+
+    if (0u == count) { return output; }
+
+    if (bids) {
+        const auto& levels = bids_.levels_;
+
+        for (auto i = levels.rbegin(); i != levels.rend(); ++i) {
+            if (false == add(*i)) { break; }
+        }
+    } else {
+        for (const auto& item : asks_.levels_) {
+            if (false == add(item)) { break; }
+        }
+    }
+
+    return output;
+}
+
+auto OrderBook::Fill(const std::int64_t number, const Amount& amount) noexcept
+    -> void
+{
+    const auto i = index_.find(number);
+
+    if (index_.end() == i) { return; }
+
+    const auto& position = i->second;
+    auto& side = position.bid_ ? bids_ : asks_;
+    position.level_->second.volume_ -= amount;
+    side.volume_ -= amount;
+}
+
+auto OrderBook::Find(const std::int64_t number) const noexcept -> OTOffer*
+{
+    const auto i = index_.find(number);
+
+    if (index_.end() == i) { return nullptr; }
+
+    return *(i->second.offer_);
+}
+
+auto OrderBook::Remove(const std::int64_t number) noexcept -> OTOffer*
+{
+    const auto i = index_.find(number);
+
+    if (index_.end() == i) { return nullptr; }
+
+    const auto& position = i->second;
+    auto& side = position.bid_ ? bids_ : asks_;
+    auto& level = position.level_->second;
+    auto* offer = *position.offer_;
+
+    OT_ASSERT(nullptr != offer);
+
+    const auto volume = offer->GetAmountAvailable();
+    level.volume_ -= volume;
+    level.offers_.erase(position.offer_);
+    --side.count_;
+    side.volume_ -= volume;
+
+    if (level.offers_.empty()) { side.levels_.erase(position.level_); }
+
+    index_.erase(i);
+
+    return offer;
+}
+
+auto OrderBook::Top(const bool bids, const std::size_t count) const noexcept
+    -> Offers
+{
+    auto output = Offers{};
+
+    if (0u == count) { return output; }
+
+    Visit(bids, [&](auto& offer) {
+        // NOTE market orders are at the end of the bids and at the start of
+        // the asks
+        if (offer.IsMarketOrder()) { return false == bids; }
+
+        output.emplace_back(&offer);
+
+        return output.size() < count;
+    });
+
+    return output;
+}
+
+auto OrderBook::Visit(const bool bids, const Visitor& visitor) const noexcept
+    -> void
+{
+    const auto visit = [&](const auto& item) {
+        for (auto* offer : item.second.offers_) {
+            OT_ASSERT(nullptr != offer);
+
+            if (false == visitor(*offer)) { return false; }
+        }
+
+        return true;
+    };
+
+    if (bids) {
+        const auto& levels = bids_.levels_;
+
+        for (auto i = levels.rbegin(); i != levels.rend(); ++i) {
+            if (false == visit(*i)) { return; }
+        }
+    } else {
+        for (const auto& item : asks_.levels_) {
+            if (false == visit(item)) { return; }
+        }
+    }
+}
+
+OrderBook::~OrderBook() = default;
+}  // namespace opentxs::otx
@@ -75,7 +75,7 @@ Base::Base(
     : Signable(
           api,
           local,
-          targetVersion,
+          serialized.version(),
           {},
           {},
           calculate_id(api, local, remote),
@@ -85,34 +85,29 @@ Base::Base(
               : Signatures{})
     , server_id_(server)
     , remote_nym_(remote)
-    , available_transaction_numbers_()
-    , issued_transaction_numbers_()
+    , available_transaction_numbers_(NumberSet::Load(
+          serialized.availabletransactionnumber(),
+          serialized.availabletransactionrange()))
+    , issued_transaction_numbers_(NumberSet::Load(
+          serialized.issuedtransactionnumber(),
+          serialized.issuedtransactionrange()))
     , request_number_(serialized.requestnumber())
-    , acknowledged_request_numbers_()
+    , acknowledged_request_numbers_(NumberSet::Load(
+          serialized.acknowledgedrequestnumber(),
+          UnallocatedVector<RequestNumber>{}))
     , local_nymbox_hash_(
           api_.Factory().Identifier(serialized.localnymboxhash()))
     , remote_nymbox_hash_(
           api_.Factory().Identifier(serialized.remotenymboxhash()))
     , target_version_(targetVersion)
 {
-    for (const auto& it : serialized.acknowledgedrequestnumber()) {
-        acknowledged_request_numbers_.insert(it);
-    }
-
-    for (const auto& it : serialized.availabletransactionnumber()) {
-        available_transaction_numbers_.insert(it);
-    }
-
-    for (const auto& it : serialized.issuedtransactionnumber()) {
-        issued_transaction_numbers_.insert(it);
-    }
 }
 
 auto Base::AcknowledgedNumbers() const -> UnallocatedSet<RequestNumber>
 {
     auto lock = Lock{lock_};
 
-    return acknowledged_request_numbers_;
+    return acknowledged_request_numbers_.Set();
 }
 
 auto Base::add_acknowledged_number(const Lock& lock, const RequestNumber req)
@@ -121,14 +116,14 @@ auto Base::add_acknowledged_number(const Lock& lock, const RequestNumber req)
     OT_ASSERT(verify_write_lock(lock));
 
     clear_signatures(lock);
-    auto output = acknowledged_request_numbers_.insert(req);
+    const auto output = acknowledged_request_numbers_.insert(req);
 
     while (OT_MAX_ACK_NUMS < acknowledged_request_numbers_.size()) {
         acknowledged_request_numbers_.erase(
-            acknowledged_request_numbers_.begin());
+            *acknowledged_request_numbers_.begin());
     }
 
-    return output.second;
+    return output;
 }
 
 auto Base::AddAcknowledgedNumber(const RequestNumber req) -> bool
@@ -293,14 +288,7 @@ auto Base::IDVersion(const Lock& lock) const -> proto::Context
     }
 
     output.set_requestnumber(request_number_.load());
-
-    for (const auto& it : available_transaction_numbers_) {
-        output.add_availabletransactionnumber(it);
-    }
-
-    for (const auto& it : issued_transaction_numbers_) {
-        output.add_issuedtransactionnumber(it);
-    }
+    serialize_numbers(lock, output);
 
     return output;
 }
@@ -379,7 +367,7 @@ auto Base::insert_available_number(const TransactionNumber& number) -> bool
     auto lock = Lock{lock_};
     clear_signatures(lock);
 
-    return available_transaction_numbers_.insert(number).second;
+    return available_transaction_numbers_.insert(number);
 }
 
 auto Base::insert_issued_number(const TransactionNumber& number) -> bool
@@ -387,7 +375,7 @@ auto Base::insert_issued_number(const TransactionNumber& number) -> bool
     auto lock = Lock{lock_};
     clear_signatures(lock);
 
-    return issued_transaction_numbers_.insert(number).second;
+    return issued_transaction_numbers_.insert(number);
 }
 
 auto Base::issue_number(const Lock& lock, const TransactionNumber& number)
@@ -417,7 +405,20 @@ auto Base::IssuedNumbers() const -> UnallocatedSet<TransactionNumber>
 {
     auto lock = Lock{lock_};
 
-    return issued_transaction_numbers_;
+    return issued_transaction_numbers_.Set();
+}
+
+auto Base::IssuedNumbers(const NumberVisitor& visitor) const -> void
+{
+    // NOTE copies of a NumberSet share storage so the visitor runs without
+    // holding the lock and without expanding the ranges into a set
+    const auto numbers = [&] {
+        auto lock = Lock{lock_};
+
+        return issued_transaction_numbers_;
+    }();
+
+    for (const auto number : numbers) { visitor(number); }
 }
 
 auto Base::LegacyDataFolder() const -> UnallocatedCString
@@ -480,7 +481,7 @@ auto Base::recover_available_number(
 
     clear_signatures(lock);
 
-    return available_transaction_numbers_.insert(number).second;
+    return available_transaction_numbers_.insert(number);
 }
 
 auto Base::RecoverAvailableNumber(const TransactionNumber& number) -> bool
@@ -493,8 +494,17 @@ auto Base::RecoverAvailableNumber(const TransactionNumber& number) -> bool
 auto Base::Refresh(proto::Context& out, const PasswordPrompt& reason) -> bool
 {
     auto lock = Lock{lock_};
-    update_signature(lock, reason);
-    out = contract(lock);
+
+    // NOTE the copy sent to the peer is signed separately in the version it
+    // is able to parse, then the local copy is signed again in its own version
+    if (target_version_ > peer_version()) {
+        sign(lock, peer_version(), reason);
+        out = contract(lock);
+        update_signature(lock, reason);
+    } else {
+        update_signature(lock, reason);
+        out = contract(lock);
+    }
 
     return true;
 }
@@ -579,15 +589,37 @@ auto Base::serialize(const Lock& lock, const otx::ConsensusType type) const
         output.add_acknowledgedrequestnumber(it);
     }
 
-    for (const auto& it : available_transaction_numbers_) {
-        output.add_availabletransactionnumber(it);
+    serialize_numbers(lock, output);
+
+    return output;
+}
+
+auto Base::serialize_numbers(const Lock& lock, proto::Context& output) const
+    -> void
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    if (number_range_version_ > version_) {
+        for (const auto& it : available_transaction_numbers_) {
+            output.add_availabletransactionnumber(it);
+        }
+
+        for (const auto& it : issued_transaction_numbers_) {
+            output.add_issuedtransactionnumber(it);
+        }
+
+        return;
     }
 
-    for (const auto& it : issued_transaction_numbers_) {
-        output.add_issuedtransactionnumber(it);
+    for (const auto& [first, last] : available_transaction_numbers_.Ranges()) {
+        output.add_availabletransactionrange(first);
+        output.add_availabletransactionrange(last);
     }
 
-    return output;
+    for (const auto& [first, last] : issued_transaction_numbers_.Ranges()) {
+        output.add_issuedtransactionrange(first);
+        output.add_issuedtransactionrange(last);
+    }
 }
 
 auto Base::Serialize() const noexcept -> OTData
@@ -651,23 +683,15 @@ auto Base::SetRequest(const RequestNumber req) -> void
     request_number_.store(req);
 }
 
-auto Base::SigVersion(const Lock& lock) const -> proto::Context
-{
-    OT_ASSERT(verify_write_lock(lock));
-
-    auto output = serialize(lock, Type());
-    output.clear_signature();
-
-    return output;
-}
-
-auto Base::update_signature(const Lock& lock, const PasswordPrompt& reason)
-    -> bool
+auto Base::sign(
+    const Lock& lock,
+    const VersionNumber version,
+    const PasswordPrompt& reason) -> bool
 {
     OT_ASSERT(verify_write_lock(lock));
 
     clear_signatures(lock);
-    update_version(lock, target_version_);
+    update_version(lock, version);
 
     if (!Signable::update_signature(lock, reason)) { return false; }
 
@@ -688,6 +712,22 @@ auto Base::update_signature(const Lock& lock, const PasswordPrompt& reason)
     return success;
 }
 
+auto Base::SigVersion(const Lock& lock) const -> proto::Context
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    auto output = serialize(lock, Type());
+    output.clear_signature();
+
+    return output;
+}
+
+auto Base::update_signature(const Lock& lock, const PasswordPrompt& reason)
+    -> bool
+{
+    return sign(lock, target_version_, reason);
+}
+
 auto Base::validate(const Lock& lock) const -> bool
 {
     OT_ASSERT(verify_write_lock(lock));
@@ -25,6 +25,7 @@
 #include "opentxs/otx/Types.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Numbers.hpp"
+#include "otx/consensus/NumberSet.hpp"
 #include "serialization/protobuf/Context.pb.h"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -65,6 +66,7 @@ public:
     auto HaveLocalNymboxHash() const -> bool final;
     auto HaveRemoteNymboxHash() const -> bool final;
     auto IssuedNumbers() const -> UnallocatedSet<TransactionNumber> final;
+    auto IssuedNumbers(const NumberVisitor& visitor) const -> void final;
     auto Name() const noexcept -> UnallocatedCString final;
     auto NymboxHashMatch() const -> bool final;
     auto LegacyDataFolder() const -> UnallocatedCString final;
@@ -116,10 +118,10 @@ public:
 protected:
     const OTNotaryID server_id_;
     Nym_p remote_nym_;
-    UnallocatedSet<TransactionNumber> available_transaction_numbers_;
-    UnallocatedSet<TransactionNumber> issued_transaction_numbers_;
+    NumberSet available_transaction_numbers_;
+    NumberSet issued_transaction_numbers_;
     std::atomic<RequestNumber> request_number_;
-    UnallocatedSet<RequestNumber> acknowledged_request_numbers_;
+    NumberSet acknowledged_request_numbers_;
     OTIdentifier local_nymbox_hash_;
     OTIdentifier remote_nymbox_hash_;
 
@@ -179,6 +181,9 @@ protected:
 private:
     friend opentxs::Factory;
 
+    // First version which serializes numbers as ranges
+    static constexpr auto number_range_version_ = VersionNumber{4};
+
     const VersionNumber target_version_;
 
     static auto calculate_id(
@@ -190,9 +195,18 @@ private:
         -> const identifier::Nym& = 0;
     auto clone() const noexcept -> Base* final { return nullptr; }
     auto IDVersion(const Lock& lock) const -> proto::Context;
+    // Version used for contexts sent to the peer. Peers have no way to
+    // advertise that they accept range encoded numbers.
+    virtual auto peer_version() const noexcept -> VersionNumber = 0;
     virtual auto server_nym_id(const Lock& lock) const
         -> const identifier::Nym& = 0;
+    auto serialize_numbers(const Lock& lock, proto::Context& output) const
+        -> void;
     auto SigVersion(const Lock& lock) const -> proto::Context;
+    auto sign(
+        const Lock& lock,
+        const VersionNumber version,
+        const PasswordPrompt& reason) -> bool;
     auto verify_signature(const Lock& lock, const proto::Signature& signature)
         const -> bool final;
 
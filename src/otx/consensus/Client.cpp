@@ -215,10 +215,10 @@ auto ClientContext::Verify(
 {
     Lock lock(lock_);
 
-    UnallocatedSet<TransactionNumber> effective = issued_transaction_numbers_;
+    auto effective = issued_transaction_numbers_;
 
     for (const auto& number : included) {
-        const bool inserted = effective.insert(number).second;
+        const bool inserted = effective.insert(number);
 
         if (!inserted) {
             LogConsole()(OT_PRETTY_CLASS())("New transaction # ")(
@@ -263,6 +263,10 @@ auto ClientContext::Verify(
         }
     }
 
+    // Every number on the statement is known to be in effective, so the two
+    // sets are identical unless effective is larger
+    if (effective.size() == statement.Issued().size()) { return true; }
+
     for (const auto& number : effective) {
         const bool found = (1 == statement.Issued().count(number));
 
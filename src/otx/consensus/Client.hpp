@@ -101,11 +101,17 @@ public:
     ~ClientContext() final = default;
 
 private:
-    static constexpr auto current_version_ = VersionNumber{1};
+    static constexpr auto current_version_ = VersionNumber{4};
+    // Last version which serializes numbers individually
+    static constexpr auto peer_version_ = VersionNumber{1};
 
     UnallocatedSet<TransactionNumber> open_cron_items_;
 
     auto client_nym_id(const Lock& lock) const -> const identifier::Nym& final;
+    auto peer_version() const noexcept -> VersionNumber final
+    {
+        return peer_version_;
+    }
     using Base::serialize;
     auto serialize(const Lock& lock) const -> proto::Context final;
     auto server_nym_id(const Lock& lock) const -> const identifier::Nym& final;
@@ -0,0 +1,235 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                 // IWYU pragma: associated
+#include "1_Internal.hpp"               // IWYU pragma: associated
+#include "otx/consensus/NumberSet.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace opentxs::otx::context
+{
+NumberSet::const_iterator::const_iterator(
+    Map::const_iterator range,
+    Map::const_iterator end) noexcept
+    : range_(range)
+    , end_(end)
+    , value_((end_ == range_) ? value_type{} : range_->first)
+{
+}
+
+auto NumberSet::const_iterator::operator++() noexcept -> const_iterator&
+{
+    if (range_->second == value_) {
+        ++range_;
+
+        if (end_ != range_) { value_ = range_->first; }
+    } else {
+        ++value_;
+    }
+
+    return *this;
+}
+
+auto NumberSet::const_iterator::operator++(int) noexcept -> const_iterator
+{
+    auto output{*this};
+    operator++();
+
+    return output;
+}
+
+auto NumberSet::const_iterator::operator==(
+    const const_iterator& rhs) const noexcept -> bool
+{
+    if (range_ != rhs.range_) { return false; }
+
+    return (end_ == range_) || (value_ == rhs.value_);
+}
+}  // namespace opentxs::otx::context
+
+namespace opentxs::otx::context
+{
+NumberSet::NumberSet() noexcept
+    : ranges_(std::make_shared<Map>())
+    , size_(0)
+{
+}
+
+NumberSet::NumberSet(const UnallocatedSet<value_type>& numbers) noexcept
+    : NumberSet()
+{
+    for (const auto& number : numbers) { insert(number); }
+}
+
+NumberSet::NumberSet(const NumberSet& rhs) noexcept
+    : ranges_(rhs.ranges_)
+    , size_(rhs.size_)
+{
+}
+
+// NOTE a moved-from instance shares storage with the destination instead of
+// being left without any, so it remains usable
+NumberSet::NumberSet(NumberSet&& rhs) noexcept
+    : NumberSet(rhs)
+{
+}
+
+auto NumberSet::operator=(const NumberSet& rhs) noexcept -> NumberSet&
+{
+    if (this != &rhs) {
+        ranges_ = rhs.ranges_;
+        size_ = rhs.size_;
+    }
+
+    return *this;
+}
+
+auto NumberSet::operator=(NumberSet&& rhs) noexcept -> NumberSet&
+{
+    return operator=(rhs);
+}
+
+auto NumberSet::begin() const noexcept -> const_iterator
+{
+    return {ranges_->cbegin(), ranges_->cend()};
+}
+
+auto NumberSet::clear() noexcept -> void
+{
+    ranges_ = std::make_shared<Map>();
+    size_ = 0;
+}
+
+auto NumberSet::count(const value_type number) const noexcept -> std::size_t
+{
+    return (ranges_->cend() == find(number)) ? 0u : 1u;
+}
+
+auto NumberSet::end() const noexcept -> const_iterator
+{
+    return {ranges_->cend(), ranges_->cend()};
+}
+
+auto NumberSet::erase(const value_type number) noexcept -> std::size_t
+{
+    if (0u == count(number)) { return 0u; }
+
+    auto& map = mutable_ranges();
+    auto i = std::prev(map.upper_bound(number));
+    const auto [first, last] = *i;
+
+    if (first == last) {
+        map.erase(i);
+    } else if (first == number) {
+        map.erase(i);
+        map.emplace(number + 1, last);
+    } else if (last == number) {
+        i->second = number - 1;
+    } else {
+        i->second = number - 1;
+        map.emplace(number + 1, last);
+    }
+
+    --size_;
+
+    return 1u;
+}
+
+auto NumberSet::find(const value_type number) const noexcept
+    -> Map::const_iterator
+{
+    const auto& map = *ranges_;
+    auto i = map.upper_bound(number);
+
+    if (map.cbegin() == i) { return map.cend(); }
+
+    --i;
+
+    return (number <= i->second) ? i : map.cend();
+}
+
+auto NumberSet::insert(const value_type number) noexcept -> bool
+{
+    if (0u < count(number)) { return false; }
+
+    return 1u == insert(number, number);
+}
+
+auto NumberSet::insert(const value_type first, const value_type last) noexcept
+    -> std::size_t
+{
+    using Limits = std::numeric_limits<value_type>;
+
+    if (first > last) { return 0u; }
+
+    auto& map = mutable_ranges();
+    auto lo = first;
+    auto hi = last;
+    auto added = static_cast<std::size_t>(
+        static_cast<std::uint64_t>(hi) - static_cast<std::uint64_t>(lo) + 1u);
+    auto i = map.upper_bound(lo);
+
+    if (map.begin() != i) {
+        const auto previous = std::prev(i);
+        const auto touches =
+            (Limits::min() == lo) || (previous->second >= (lo - 1));
+
+        if (touches) { i = previous; }
+    }
+
+    // Absorb every range which overlaps or is adjacent to [lo, hi]
+    while (map.end() != i) {
+        const auto touches = (Limits::max() == hi) || (i->first <= (hi + 1));
+
+        if (false == touches) { break; }
+
+        const auto overlapLo = std::max(lo, i->first);
+        const auto overlapHi = std::min(hi, i->second);
+
+        if (overlapLo <= overlapHi) {
+            added -= static_cast<std::size_t>(
+                static_cast<std::uint64_t>(overlapHi) -
+                static_cast<std::uint64_t>(overlapLo) + 1u);
+        }
+
+        lo = std::min(lo, i->first);
+        hi = std::max(hi, i->second);
+        i = map.erase(i);
+    }
+
+    map.emplace_hint(i, lo, hi);
+    size_ += added;
+
+    return added;
+}
+
+auto NumberSet::mutable_ranges() noexcept -> Map&
+{
+    if (1 < ranges_.use_count()) { ranges_ = std::make_shared<Map>(*ranges_); }
+
+    return *ranges_;
+}
+
+auto NumberSet::Set() const -> UnallocatedSet<value_type>
+{
+    auto output = UnallocatedSet<value_type>{};
+
+    for (const auto& [first, last] : *ranges_) {
+        for (auto i = first; i < last; ++i) {
+            output.emplace_hint(output.end(), i);
+        }
+
+        output.emplace_hint(output.end(), last);
+    }
+
+    return output;
+}
+}  // namespace opentxs::otx::context
@@ -0,0 +1,110 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Numbers.hpp"
+
+namespace opentxs::otx::context
+{
+// Set of transaction or request numbers stored as sorted, disjoint, inclusive
+// ranges so that memory use and iteration over ranges scale with the number
+// of ranges rather than the number of numbers. Copies share storage until one
+// of them is modified.
+class NumberSet
+{
+public:
+    using value_type = TransactionNumber;
+    using Map = UnallocatedMap<value_type, value_type>;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = NumberSet::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        auto operator*() const noexcept -> reference { return value_; }
+        auto operator->() const noexcept -> pointer { return &value_; }
+        auto operator++() noexcept -> const_iterator&;
+        auto operator++(int) noexcept -> const_iterator;
+        auto operator==(const const_iterator& rhs) const noexcept -> bool;
+        auto operator!=(const const_iterator& rhs) const noexcept -> bool
+        {
+            return false == operator==(rhs);
+        }
+
+        const_iterator(Map::const_iterator range, Map::const_iterator end)
+        noexcept;
+
+    private:
+        Map::const_iterator range_;
+        Map::const_iterator end_;
+        value_type value_;
+    };
+
+    // Accepts the legacy encoding (one entry per number) and the range
+    // encoding (first and last of each range, flattened) at the same time
+    template <typename Numbers, typename Ranges>
+    static auto Load(const Numbers& numbers, const Ranges& ranges) noexcept
+        -> NumberSet
+    {
+        auto output = NumberSet{};
+
+        for (const auto& number : numbers) {
+            output.insert(static_cast<value_type>(number));
+        }
+
+        for (auto i = std::begin(ranges), end = std::end(ranges); end != i;) {
+            const auto first = static_cast<value_type>(*i++);
+
+            if (end == i) { break; }
+
+            output.insert(first, static_cast<value_type>(*i++));
+        }
+
+        return output;
+    }
+
+    auto begin() const noexcept -> const_iterator;
+    auto count(const value_type number) const noexcept -> std::size_t;
+    auto empty() const noexcept -> bool { return 0u == size_; }
+    auto end() const noexcept -> const_iterator;
+    auto Ranges() const noexcept -> const Map& { return *ranges_; }
+    auto Set() const -> UnallocatedSet<value_type>;
+    auto size() const noexcept -> std::size_t { return size_; }
+
+    auto clear() noexcept -> void;
+    auto erase(const value_type number) noexcept -> std::size_t;
+    auto insert(const value_type number) noexcept -> bool;
+    auto insert(const value_type first, const value_type last) noexcept
+        -> std::size_t;
+
+    NumberSet() noexcept;
+    NumberSet(const UnallocatedSet<value_type>& numbers) noexcept;
+    NumberSet(const NumberSet&) noexcept;
+    NumberSet(NumberSet&&) noexcept;
+    auto operator=(const NumberSet&) noexcept -> NumberSet&;
+    auto operator=(NumberSet&&) noexcept -> NumberSet&;
+
+    ~NumberSet() = default;
+
+private:
+    std::shared_ptr<Map> ranges_;
+    std::size_t size_;
+
+    auto find(const value_type number) const noexcept -> Map::const_iterator;
+
+    auto mutable_ranges() noexcept -> Map&;
+};
+}  // namespace opentxs::otx::context
@@ -1990,7 +1990,7 @@ auto Server::initialize_server_command(
     output.m_strRequestNum = String::Factory(std::to_string(number).c_str());
 
     if (withAcknowledgments) {
-        output.SetAcknowledgments(acknowledged_request_numbers_);
+        output.SetAcknowledgments(acknowledged_request_numbers_.Set());
     }
 
     if (withNymboxHash) {
@@ -2645,9 +2645,8 @@ auto Server::next_transaction_number(const Lock& lock, const MessageType reason)
         return OTManagedNumber(factory::ManagedNumber(0, *this));
     }
 
-    auto first = available_transaction_numbers_.begin();
-    const auto output = *first;
-    available_transaction_numbers_.erase(first);
+    const auto output = *available_transaction_numbers_.begin();
+    available_transaction_numbers_.erase(output);
 
     return OTManagedNumber(factory::ManagedNumber(output, *this));
 }
@@ -7118,10 +7117,11 @@ auto Server::resync(const Lock& lock, const proto::Context& serialized) -> bool
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    TransactionNumbers serverNumbers{};
+    const auto serverNumbers = NumberSet::Load(
+        serialized.issuedtransactionnumber(),
+        serialized.issuedtransactionrange());
 
-    for (const auto& number : serialized.issuedtransactionnumber()) {
-        serverNumbers.insert(number);
+    for (const auto& number : serverNumbers) {
         auto exists = (1 == issued_transaction_numbers_.count(number));
 
         if (false == exists) {
@@ -7134,7 +7134,10 @@ auto Server::resync(const Lock& lock, const proto::Context& serialized) -> bool
         }
     }
 
-    for (const auto& number : issued_transaction_numbers_) {
+    // NOTE iterate over a snapshot since numbers are erased inside the loop
+    const auto issued = issued_transaction_numbers_;
+
+    for (const auto& number : issued) {
         auto exists = (1 == serverNumbers.count(number));
 
         if (false == exists) {
@@ -7148,7 +7151,7 @@ auto Server::resync(const Lock& lock, const proto::Context& serialized) -> bool
     }
 
     TransactionNumbers notUsed{};
-    update_highest(lock, issued_transaction_numbers_, notUsed, notUsed);
+    update_highest(lock, issued_transaction_numbers_.Set(), notUsed, notUsed);
 
     return true;
 }
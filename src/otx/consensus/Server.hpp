@@ -284,7 +284,9 @@ private:
     enum class ActionType : bool { ProcessNymbox = true, Normal = false };
     enum class TransactionAttempt : bool { Accepted = true, Rejected = false };
 
-    static constexpr auto current_version_ = VersionNumber{3};
+    static constexpr auto current_version_ = VersionNumber{4};
+    // Last version which serializes numbers individually
+    static constexpr auto peer_version_ = VersionNumber{3};
     static constexpr auto pending_command_version_ = VersionNumber{1};
     static constexpr auto default_node_name_{"Remote Notary"};
     static constexpr auto nymbox_box_type_{0};
@@ -424,6 +426,10 @@ private:
         const PasswordPrompt& reason) const -> std::unique_ptr<Ledger>;
     auto load_or_create_payment_inbox(const PasswordPrompt& reason) const
         -> std::unique_ptr<Ledger>;
+    auto peer_version() const noexcept -> VersionNumber final
+    {
+        return peer_version_;
+    }
     void process_accept_pending_reply(
         const Lock& lock,
         const api::session::Client& client,
@@ -9,8 +9,6 @@
 
 #include <algorithm>
 #include <chrono>
-#include <cstdint>
-#include <limits>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -38,7 +36,6 @@
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Notary.hpp"
 #include "opentxs/api/session/Wallet.hpp"
-#include "opentxs/core/Armored.hpp"
 #include "opentxs/core/Secret.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
@@ -57,6 +54,7 @@
 #include "opentxs/util/Pimpl.hpp"
 #include "opentxs/util/Time.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "otx/common/OTStorage.hpp"
 #include "otx/server/Server.hpp"
 #include "otx/server/UserCommandProcessor.hpp"
 #include "serialization/protobuf/OTXPush.pb.h"
@@ -266,6 +264,7 @@ auto MessageProcessor::pipeline(zmq::Message&& message) noexcept -> void
 
 auto MessageProcessor::process_backend(
     const bool tagged,
+    const bool binary,
     zmq::Message&& incoming) noexcept -> network::zeromq::Message
 {
     auto reply = UnallocatedCString{};
@@ -275,20 +274,25 @@ auto MessageProcessor::process_backend(
         const auto request = [&] {
             auto out = UnallocatedCString{};
             const auto body = incoming.Body();
+            // NOTE the first frame of a tagged message is the message type
+            const auto index = tagged ? 1u : 0u;
 
-            if (0u < body.size()) { out = body.at(0).Bytes(); }
+            if (index < body.size()) { out = body.at(index).Bytes(); }
 
             return out;
         }();
 
-        return process_message(request, reply);
+        return process_message(request, binary, reply);
     }();
 
     if (error) { reply = ""; }
 
     auto output = network::zeromq::reply_to_message(std::move(incoming));
 
-    if (tagged) { output.AddFrame(WorkType::OTXLegacyXML); }
+    if (tagged) {
+        output.AddFrame(
+            binary ? WorkType::OTXLegacyBinary : WorkType::OTXLegacyXML);
+    }
 
     output.AddFrame(reply);
 
@@ -347,7 +351,7 @@ auto MessageProcessor::process_frontend(zmq::Message&& message) noexcept -> void
     const auto body = message.Body();
 
     if (2u > body.size()) {
-        process_legacy(id, false, std::move(message));
+        process_legacy(id, false, false, std::move(message));
 
         return;
     }
@@ -374,7 +378,10 @@ auto MessageProcessor::process_frontend(zmq::Message&& message) noexcept -> void
                 process_proto(id, oldProtoFormat, std::move(message));
             } break;
             case WorkType::OTXLegacyXML: {
-                process_legacy(id, true, std::move(message));
+                process_legacy(id, true, false, std::move(message));
+            } break;
+            case WorkType::OTXLegacyBinary: {
+                process_legacy(id, true, true, std::move(message));
             } break;
             default: {
                 throw std::runtime_error{"Unsupported message type"};
@@ -417,37 +424,26 @@ auto MessageProcessor::process_internal(zmq::Message&& message) noexcept -> void
 auto MessageProcessor::process_legacy(
     const Data& id,
     const bool tagged,
+    const bool binary,
     network::zeromq::Message&& incoming) noexcept -> void
 {
     LogTrace()(OT_PRETTY_CLASS())("Processing request via ")(id.asHex())
         .Flush();
-    process_internal(process_backend(tagged, std::move(incoming)));
+    process_internal(process_backend(tagged, binary, std::move(incoming)));
 }
 
 auto MessageProcessor::process_message(
     const UnallocatedCString& messageString,
+    const bool binary,
     UnallocatedCString& reply) noexcept -> bool
 {
     if (messageString.size() < 1) { return true; }
 
-    if (std::numeric_limits<std::uint32_t>::max() < messageString.size()) {
-        return true;
-    }
-
-    auto armored = Armored::Factory();
-    armored->MemSet(
-        messageString.data(), static_cast<std::uint32_t>(messageString.size()));
-    auto serialized = String::Factory();
-    armored->GetString(serialized);
     auto request{api_.Factory().InternalSession().Message()};
 
-    if (false == serialized->Exists()) {
-        LogError()(OT_PRETTY_CLASS())("Empty serialized request.").Flush();
-
-        return true;
-    }
+    OT_ASSERT(false != bool(request));
 
-    if (false == request->LoadContractFromString(serialized)) {
+    if (false == request->Decode(messageString, binary)) {
         LogError()(OT_PRETTY_CLASS())("Failed to deserialized request.")
             .Flush();
 
@@ -458,8 +454,14 @@ auto MessageProcessor::process_message(
 
     OT_ASSERT(false != bool(replymsg));
 
-    const bool processed =
-        server_.CommandProcessor().ProcessUserCommand(*request, *replymsg);
+    const bool processed = [&] {
+        // NOTE everything the command writes is committed before the reply
+        // is sent
+        auto batch = OTDB::StorageBatch{};
+
+        return server_.CommandProcessor().ProcessUserCommand(
+            *request, *replymsg);
+    }();
 
     if (false == processed) {
         LogDetail()(OT_PRETTY_CLASS())("Failed to process user command ")(
@@ -472,24 +474,14 @@ auto MessageProcessor::process_message(
             .Flush();
     }
 
-    auto serializedReply = String::Factory(*replymsg);
-
-    if (false == serializedReply->Exists()) {
-        LogError()(OT_PRETTY_CLASS())("Failed to serialize reply.").Flush();
-
-        return true;
-    }
-
-    auto armoredReply = Armored::Factory(serializedReply);
+    reply = replymsg->Encode(binary);
 
-    if (false == armoredReply->Exists()) {
-        LogError()(OT_PRETTY_CLASS())("Failed to armor reply.").Flush();
+    if (reply.empty()) {
+        LogError()(OT_PRETTY_CLASS())("Failed to encode reply.").Flush();
 
         return true;
     }
 
-    reply.assign(armoredReply->Get(), armoredReply->GetLength());
-
     return false;
 }
 
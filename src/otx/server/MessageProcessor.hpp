@@ -138,6 +138,7 @@ private:
     auto pipeline(zmq::Message&& message) noexcept -> void;
     auto process_backend(
         const bool tagged,
+        const bool binary,
         network::zeromq::Message&& incoming) noexcept
         -> network::zeromq::Message;
     auto process_command(
@@ -148,9 +149,11 @@ private:
     auto process_legacy(
         const Data& id,
         const bool tagged,
+        const bool binary,
         network::zeromq::Message&& incoming) noexcept -> void;
     auto process_message(
         const UnallocatedCString& messageString,
+        const bool binary,
         UnallocatedCString& reply) noexcept -> bool;
     auto process_notification(network::zeromq::Message&& incoming) noexcept
         -> void;
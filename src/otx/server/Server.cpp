@@ -467,7 +467,50 @@ void Server::Init(bool readOnly)
         OT_FAIL;
     }
 
-    OTDB::InitDefaultStorage(OTDB_DEFAULT_STORAGE, OTDB_DEFAULT_PACKER);
+    const auto lmdb = [&] {
+        bool notUsed{false};
+        auto value = UnallocatedCString{};
+        manager_.Config().CheckSet_str(
+            String::Factory("legacy_storage"),
+            String::Factory("backend"),
+            String::Factory("filesystem"),
+            value,
+            notUsed,
+            String::Factory("; backend is either filesystem or lmdb\n"));
+
+        return "lmdb" == value;
+    }();
+    const auto backend = lmdb ? OTDB::STORE_LMDB : OTDB_DEFAULT_STORAGE;
+
+    // NOTE the default storage context is shared by every session in the
+    // process and is created by whichever session initializes it first. The
+    // LMDB context only stores the data folders which are migrated into it
+    // and leaves every other data folder on the filesystem, so other
+    // sessions are not affected by this setting.
+    if (false == OTDB::InitDefaultStorage(backend, OTDB_DEFAULT_PACKER)) {
+        LogError()(OT_PRETTY_CLASS())("Falling back to filesystem storage.")
+            .Flush();
+        OTDB::InitDefaultStorage(OTDB_DEFAULT_STORAGE, OTDB_DEFAULT_PACKER);
+    }
+
+    if (lmdb) {
+        const auto* storage = OTDB::GetDefaultStorage();
+
+        OT_ASSERT(nullptr != storage);
+
+        if (OTDB::STORE_LMDB != storage->GetType()) {
+            // NOTE another session created the storage context first or
+            // opentxs was built without LMDB support
+            LogError()(OT_PRETTY_CLASS())(
+                "LMDB storage is unavailable. Using filesystem storage.")
+                .Flush();
+        } else if (false == OTDB::MigrateFilesystemStorage(
+                                manager_, manager_.DataFolder())) {
+            LogError()(OT_PRETTY_CLASS())("Failed to migrate legacy storage.")
+                .Flush();
+            OT_FAIL;
+        }
+    }
 
     // Load up the transaction number and other Server data members.
     bool mainFileExists = WalletFilename().Exists()
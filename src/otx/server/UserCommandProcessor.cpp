@@ -2184,6 +2184,9 @@ auto UserCommandProcessor::cmd_register_nym(ReplyMessage& reply) const -> bool
 
     OT_ENFORCE_PERMISSION_MSG(ServerSettings::__cmd_create_user_acct);
 
+    // Acknowledge a request to use the binary message encoding
+    reply.SetBool(msgIn.m_bBool);
+
     auto serialized = proto::Factory<proto::Nym>(
         Data::Factory(reply.Original().m_ascPayload));
     auto sender_nym = server_.API().Wallet().Internal().Nym(serialized);
@@ -15,6 +15,7 @@ auto ContextAllowedServer() noexcept -> const VersionMap&
         {1, {1, 1}},
         {2, {2, 2}},
         {3, {3, 3}},
+        {4, {4, 4}},
     };
 
     return output;
@@ -24,6 +25,7 @@ auto ContextAllowedClient() noexcept -> const VersionMap&
     static const auto output = VersionMap{
         {1, {1, 1}},
         {2, {1, 2}},
+        {4, {4, 4}},
     };
 
     return output;
@@ -34,6 +36,7 @@ auto ContextAllowedSignature() noexcept -> const VersionMap&
         {1, {2, 2}},
         {2, {2, 2}},
         {3, {2, 2}},
+        {4, {2, 2}},
     };
 
     return output;
@@ -42,6 +45,7 @@ auto ServerContextAllowedPendingCommand() noexcept -> const VersionMap&
 {
     static const auto output = VersionMap{
         {3, {1, 1}},
+        {4, {1, 1}},
     };
 
     return output;
@@ -51,7 +55,8 @@ auto ServerContextAllowedState() noexcept
 {
     static const auto output =
         UnallocatedMap<std::uint32_t, UnallocatedSet<int>>{
-            {3, {1, 2, 3, 4, 5}}};
+            {3, {1, 2, 3, 4, 5}},
+            {4, {1, 2, 3, 4, 5}}};
 
     return output;
 }
@@ -60,7 +65,8 @@ auto ServerContextAllowedStatus() noexcept
 {
     static const auto output =
         UnallocatedMap<std::uint32_t, UnallocatedSet<int>>{
-            {3, {1, 2, 3, 4, 5}}};
+            {3, {1, 2, 3, 4, 5}},
+            {4, {1, 2, 3, 4, 5}}};
 
     return output;
 }
@@ -24,7 +24,7 @@ auto CheckProto_3(const ClientContext& input, const bool silent) -> bool
 
 auto CheckProto_4(const ClientContext& input, const bool silent) -> bool
 {
-    UNDEFINED_VERSION(4)
+    return CheckProto_1(input, silent);
 }
 
 auto CheckProto_5(const ClientContext& input, const bool silent) -> bool
@@ -5,6 +5,9 @@
 
 #include "internal/serialization/protobuf/verify/Context.hpp"  // IWYU pragma: associated
 
+#include <cstdint>
+#include <optional>
+
 #include "internal/serialization/protobuf/Basic.hpp"
 #include "internal/serialization/protobuf/verify/ClientContext.hpp"  // IWYU pragma: keep
 #include "internal/serialization/protobuf/verify/ServerContext.hpp"  // IWYU pragma: keep
@@ -17,7 +20,9 @@
 
 namespace opentxs::proto
 {
-auto CheckProto_1(const Context& input, const bool silent) -> bool
+namespace
+{
+auto check_common(const Context& input, const bool silent) -> bool
 {
     CHECK_IDENTIFIER(localnym)
     CHECK_IDENTIFIER(remotenym)
@@ -44,6 +49,40 @@ auto CheckProto_1(const Context& input, const bool silent) -> bool
     return true;
 }
 
+auto check_ranges(
+    const Context& input,
+    const bool silent,
+    const google::protobuf::RepeatedField<std::uint64_t>& ranges) -> bool
+{
+    if (0 != ranges.size() % 2) { FAIL_1("incomplete number range") }
+
+    auto previous = std::optional<std::uint64_t>{};
+
+    for (auto i = 0; i < ranges.size(); i += 2) {
+        const auto first = ranges.Get(i);
+        const auto last = ranges.Get(i + 1);
+
+        if (first > last) { FAIL_2("invalid number range", first) }
+
+        if (previous.has_value() && (first <= previous.value())) {
+            FAIL_2("overlapping or unsorted number range", first)
+        }
+
+        previous = last;
+    }
+
+    return true;
+}
+}  // namespace
+
+auto CheckProto_1(const Context& input, const bool silent) -> bool
+{
+    CHECK_NONE(availabletransactionrange)
+    CHECK_NONE(issuedtransactionrange)
+
+    return check_common(input, silent);
+}
+
 auto CheckProto_2(const Context& input, const bool silent) -> bool
 {
     return CheckProto_1(input, silent);
@@ -56,7 +95,19 @@ auto CheckProto_3(const Context& input, const bool silent) -> bool
 
 auto CheckProto_4(const Context& input, const bool silent) -> bool
 {
-    UNDEFINED_VERSION(4)
+    CHECK_NONE(availabletransactionnumber)
+    CHECK_NONE(issuedtransactionnumber)
+
+    if (false ==
+        check_ranges(input, silent, input.availabletransactionrange())) {
+        return false;
+    }
+
+    if (false == check_ranges(input, silent, input.issuedtransactionrange())) {
+        return false;
+    }
+
+    return check_common(input, silent);
 }
 
 auto CheckProto_5(const Context& input, const bool silent) -> bool
@@ -55,7 +55,7 @@ auto CheckProto_3(const ServerContext& input, const bool silent) -> bool
 
 auto CheckProto_4(const ServerContext& input, const bool silent) -> bool
 {
-    UNDEFINED_VERSION(4)
+    return CheckProto_3(input, silent);
 }
 
 auto CheckProto_5(const ServerContext& input, const bool silent) -> bool
@@ -17,12 +17,19 @@ auto CheckProto_1(const SpentTokenList& input, const bool silent) -> bool
     CHECK_IDENTIFIER(unit);
     OPTIONAL_IDENTIFIERS(spent);
 
+    if (input.has_previous()) { FAIL_1("previous not allowed in version 1") }
+
     return true;
 }
 
 auto CheckProto_2(const SpentTokenList& input, const bool silent) -> bool
 {
-    UNDEFINED_VERSION(2)
+    CHECK_IDENTIFIER(notary);
+    CHECK_IDENTIFIER(unit);
+    OPTIONAL_IDENTIFIERS(spent);
+    OPTIONAL_IDENTIFIER(previous);
+
+    return true;
 }
 
 auto CheckProto_3(const SpentTokenList& input, const bool silent) -> bool
@@ -434,6 +434,52 @@ struct LMDB::Imp {
             return false;
         }
     }
+    auto ReadRange(
+        const Table table,
+        const ReadView start,
+        const ReadCallback cb) const noexcept -> bool
+    {
+        try {
+            auto tx = TransactionRO();
+            MDB_cursor* cursor{nullptr};
+            auto post = ScopeGuard{[&] {
+                if (nullptr != cursor) {
+                    ::mdb_cursor_close(cursor);
+                    cursor = nullptr;
+                }
+            }};
+            const auto dbi = db_.at(table);
+
+            if (0 != ::mdb_cursor_open(tx, dbi, &cursor)) {
+                throw std::runtime_error{"Failed to get cursor"};
+            }
+
+            const auto first =
+                MDB_cursor_op{start.empty() ? MDB_FIRST : MDB_SET_RANGE};
+            auto again{true};
+            auto key = MDB_val{start.size(), const_cast<char*>(start.data())};
+            auto value = MDB_val{};
+
+            if (0 != ::mdb_cursor_get(cursor, &key, &value, first)) {
+                // NOTE no keys remain in the requested range
+
+                return true;
+            }
+
+            do {
+                again =
+                    cb({static_cast<char*>(key.mv_data), key.mv_size},
+                       {static_cast<char*>(value.mv_data), value.mv_size});
+            } while (again &&
+                     0 == ::mdb_cursor_get(cursor, &key, &value, MDB_NEXT));
+
+            return true;
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return false;
+        }
+    }
     auto Store(
         const Table table,
         const ReadView index,
@@ -675,6 +721,7 @@ LMDB::Transaction::Transaction(
     : success_(false)
     , lock_(std::move(lock))
     , ptr_(nullptr)
+    , on_commit_()
 {
     const Flags flags = rw ? 0u : MDB_RDONLY;
 
@@ -687,6 +734,7 @@ LMDB::Transaction::Transaction(Transaction&& rhs) noexcept
     : success_(rhs.success_)
     , lock_(std::move(rhs.lock_))
     , ptr_(rhs.ptr_)
+    , on_commit_(std::move(rhs.on_commit_))
 {
     rhs.ptr_ = nullptr;
 }
@@ -710,10 +758,15 @@ auto LMDB::Transaction::Finalize(const std::optional<bool> success) noexcept
         if (success.has_value()) { success_ = success.value(); }
 
         auto cleanup = Cleanup{ptr_};
+        auto callbacks = std::move(on_commit_);
+        on_commit_.clear();
 
         if (success_) {
+            if (0 != ::mdb_txn_commit(ptr_)) { return false; }
+
+            for (auto& cb : callbacks) { cb(); }
 
-            return 0 == ::mdb_txn_commit(ptr_);
+            return true;
         } else {
             ::mdb_txn_abort(ptr_);
 
@@ -724,6 +777,11 @@ auto LMDB::Transaction::Finalize(const std::optional<bool> success) noexcept
     return false;
 }
 
+auto LMDB::Transaction::OnCommit(std::function<void()>&& cb) noexcept -> void
+{
+    if (cb) { on_commit_.emplace_back(std::move(cb)); }
+}
+
 LMDB::Transaction::~Transaction() { Finalize(); }
 
 auto LMDB::Commit() const noexcept -> bool { return imp_->Commit(); }
@@ -877,6 +935,14 @@ auto LMDB::ReadFrom(
         dir);
 }
 
+auto LMDB::ReadRange(
+    const Table table,
+    const ReadView start,
+    const ReadCallback cb) const noexcept -> bool
+{
+    return imp_->ReadRange(table, start, cb);
+}
+
 auto LMDB::Store(
     const Table table,
     const ReadView index,
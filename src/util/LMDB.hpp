@@ -50,6 +50,10 @@ public:
         operator MDB_txn*() noexcept { return ptr_; }
 
         auto Finalize(const std::optional<bool> success = {}) noexcept -> bool;
+        // The callback is executed only if this transaction commits. A
+        // callback registered on a nested transaction runs when the nested
+        // transaction commits, regardless of the outcome of its parent.
+        auto OnCommit(std::function<void()>&& cb) noexcept -> void;
 
         Transaction(
             MDB_env* env,
@@ -63,6 +67,7 @@ public:
     private:
         std::unique_ptr<Lock> lock_;
         MDB_txn* ptr_;
+        UnallocatedVector<std::function<void()>> on_commit_;
 
         Transaction(const Transaction&) = delete;
         auto operator=(const Transaction&) -> Transaction& = delete;
@@ -143,6 +148,12 @@ public:
         const std::size_t key,
         const ReadCallback cb,
         const Dir dir) const noexcept -> bool;
+    // Visits keys in ascending order starting with the first key which is
+    // not less than start. An empty start visits the entire table.
+    auto ReadRange(
+        const Table table,
+        const ReadView start,
+        const ReadCallback cb) const noexcept -> bool;
     auto Store(
         const Table table,
         const ReadView key,
@@ -10,15 +10,23 @@
 #include <boost/filesystem.hpp>
 #include <boost/iostreams/device/mapped_file.hpp>
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
+#include <tuple>
 #include <utility>
 
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
 #include "internal/util/TSV.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Time.hpp"
 #include "util/FileSize.hpp"
 
 namespace fs = boost::filesystem;
@@ -47,16 +55,140 @@ constexpr auto get_start_position(const std::size_t file) noexcept
 }
 
 struct MappedFileStorage::Imp {
+    using Epoch = std::uint64_t;
     using FileCounter = std::size_t;
+    using Seconds = std::int64_t;
+
+    struct FreeExtent {
+        IndexData index_{};
+        Seconds released_{};
+    };
+    // NOTE progress of an incremental compaction pass. The reusable free
+    // extents are loaded once at the start of each pass and are bucketed by
+    // size class and ordered by position.
+    struct Compaction {
+        using Extents = UnallocatedMap<
+            std::size_t,
+            UnallocatedMap<IndexData::MemoryPosition, FreeExtent>>;
+
+        bool running_{};
+        std::size_t table_{};
+        Space cursor_{};
+        Extents extents_{};
+    };
+
+    // NOTE leftover space smaller than this after an extent has been reused
+    // is not tracked
+    static constexpr auto minimum_extent_ = std::size_t{64};
+    // NOTE the number of larger size classes to search for a reusable extent
+    // before appending to the end of the file
+    static constexpr auto class_search_ = std::size_t{8};
 
     LMDB& lmdb_;
     const UnallocatedCString path_prefix_;
     const UnallocatedCString filename_prefix_;
     const int table_;
     const std::size_t key_;
+    const int free_table_;
+    const Seconds start_time_;
     mutable IndexData::MemoryPosition next_position_;
     mutable UnallocatedVector<boost::iostreams::mapped_file> files_;
+    // NOTE guards have_free_ and released_ which are updated when the
+    // transaction that changed the free table commits, and the reader epochs
+    mutable std::mutex state_lock_;
+    mutable bool have_free_;
+    // NOTE space released by this process and the epoch in which the release
+    // committed. Readers registered in that epoch or earlier may still hold an
+    // index which refers to it. Space released before this process started
+    // is not listed and is immediately reusable.
+    mutable UnallocatedMap<IndexData::MemoryPosition, Epoch> released_;
+    mutable Epoch epoch_;
+    mutable UnallocatedMap<Epoch, std::size_t> readers_;
+    mutable Compaction compaction_;
+
+    static auto now() noexcept -> Seconds
+    {
+        return std::chrono::duration_cast<std::chrono::seconds>(
+                   Clock::now().time_since_epoch())
+            .count();
+    }
+    static auto size_class(const std::size_t bytes) noexcept -> std::size_t
+    {
+        auto out = std::size_t{0};
+
+        while ((out < std::numeric_limits<std::size_t>::digits) &&
+               ((std::size_t{1} << out) < bytes)) {
+            ++out;
+        }
+
+        return out;
+    }
+
+    auto add_free(LMDB::Transaction& tx, const FreeExtent& extent) noexcept
+        -> bool
+    {
+        const auto key = size_class(extent.index_.size_);
+        const auto result = lmdb_.Store(free_table_, tsv(key), tsv(extent), tx);
+
+        if (false == result.first) {
+            LogError()(OT_PRETTY_CLASS())("Failed to record free extent")
+                .Flush();
+
+            return false;
+        }
+
+        return true;
+    }
+    auto allocate(
+        LMDB::Transaction& tx,
+        IndexData& index,
+        const std::size_t bytes) noexcept -> bool
+    {
+        {
+            auto lock = Lock{state_lock_};
+
+            if (false == have_free_) { return false; }
+        }
 
+        const auto first = size_class(bytes);
+
+        for (auto key = first; key < (first + class_search_); ++key) {
+            auto found = std::optional<FreeExtent>{};
+            lmdb_.Load(
+                free_table_,
+                tsv(key),
+                [&](const auto in) {
+                    if (found.has_value() ||
+                        (sizeof(FreeExtent) != in.size())) {
+                        return;
+                    }
+
+                    auto extent = FreeExtent{};
+                    std::memcpy(
+                        static_cast<void*>(&extent), in.data(), in.size());
+
+                    if ((bytes <= extent.index_.size_) && reusable(extent)) {
+                        found = extent;
+                    }
+                },
+                tx,
+                LMDB::Mode::Multiple);
+
+            if (found.has_value()) {
+                return take(tx, found.value(), bytes, index);
+            }
+        }
+
+        return false;
+    }
+
+    auto begin_read() noexcept -> Epoch
+    {
+        auto lock = Lock{state_lock_};
+        ++readers_[epoch_];
+
+        return epoch_;
+    }
     auto calculate_file_name(
         const UnallocatedCString& prefix,
         const FileCounter index) noexcept -> UnallocatedCString
@@ -77,6 +209,114 @@ struct MappedFileStorage::Imp {
             create_or_load(path_prefix_, files_.size(), files_);
         }
     }
+    auto compact(
+        std::mutex& mutex,
+        const UnallocatedVector<int>& tables,
+        std::size_t limit) noexcept -> std::pair<std::size_t, bool>
+    {
+        auto& state = compaction_;
+
+        if ((0u == limit) || tables.empty()) { return {0u, true}; }
+
+        if (false == state.running_) { start_compaction(); }
+
+        if (state.extents_.empty() || (state.table_ >= tables.size())) {
+            state = {};
+
+            return {0u, true};
+        }
+
+        const auto table = tables.at(state.table_);
+        using Item = std::tuple<Space, Space, IndexData>;
+        auto items = UnallocatedVector<Item>{};
+        auto visited = std::size_t{0};
+        auto last = state.cursor_;
+        const auto read = lmdb_.ReadRange(
+            table,
+            reader(state.cursor_),
+            [&](const auto key, const auto value) {
+                if (reader(state.cursor_) == key) { return true; }
+
+                ++visited;
+                last = space(key);
+
+                if (sizeof(IndexData) <= value.size()) {
+                    auto index = IndexData{};
+                    std::memcpy(
+                        static_cast<void*>(&index),
+                        value.data(),
+                        sizeof(index));
+
+                    if ((0u < index.size_) && find_extent(index).has_value()) {
+                        items.emplace_back(space(key), space(value), index);
+                    }
+                }
+
+                return visited < limit;
+            });
+
+        if (false == read) {
+            state = {};
+
+            return {0u, true};
+        }
+
+        auto moved = std::size_t{0};
+
+        if (false == items.empty()) {
+            try {
+                // NOTE the transaction must be opened before the mutex is
+                // locked to match the lock ordering used by writers
+                auto tx = lmdb_.TransactionRW();
+                auto lock = Lock{mutex};
+
+                for (auto& [key, value, index] : items) {
+                    if (false == move_item(tx, table, key, value, index)) {
+                        break;
+                    }
+
+                    ++moved;
+                }
+
+                lock.unlock();
+
+                if (false == tx.Finalize(true)) {
+                    LogError()(OT_PRETTY_CLASS())("Database error").Flush();
+                    state = {};
+
+                    return {0u, true};
+                }
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+                state = {};
+
+                return {0u, true};
+            }
+        }
+
+        if (visited < limit) {
+            ++state.table_;
+            state.cursor_ = {};
+        } else {
+            state.cursor_ = std::move(last);
+        }
+
+        const auto finished =
+            state.extents_.empty() || (state.table_ >= tables.size());
+
+        if (finished) { state = {}; }
+
+        return {moved, finished};
+    }
+    auto end_read(const Epoch epoch) noexcept -> void
+    {
+        auto lock = Lock{state_lock_};
+        auto i = readers_.find(epoch);
+
+        OT_ASSERT(readers_.end() != i);
+
+        if (0u == --(i->second)) { readers_.erase(i); }
+    }
     auto create_or_load(
         const UnallocatedCString& prefix,
         const FileCounter file,
@@ -119,6 +359,45 @@ struct MappedFileStorage::Imp {
             OT_FAIL;
         }
     }
+    // NOTE returns the lowest positioned extent from the current compaction
+    // pass which precedes and is large enough to hold the item
+    auto find_extent(const IndexData& item) const noexcept
+        -> std::optional<FreeExtent>
+    {
+        auto out = std::optional<FreeExtent>{};
+        const auto& extents = compaction_.extents_;
+
+        for (auto i = extents.lower_bound(size_class(item.size_));
+             i != extents.end();
+             ++i) {
+            for (const auto& [position, extent] : i->second) {
+                if (position >= item.position_) { break; }
+
+                if (out.has_value() && (position >= out->index_.position_)) {
+                    break;
+                }
+
+                if (item.size_ <= extent.index_.size_) {
+                    out = extent;
+
+                    break;
+                }
+            }
+        }
+
+        return out;
+    }
+    auto forget_extent(const FreeExtent& extent) noexcept -> void
+    {
+        auto& extents = compaction_.extents_;
+        const auto key = size_class(extent.index_.size_);
+
+        if (auto i = extents.find(key); extents.end() != i) {
+            i->second.erase(extent.index_.position_);
+
+            if (i->second.empty()) { extents.erase(i); }
+        }
+    }
     auto get_read_view(const IndexData& index) noexcept -> ReadView
     {
         const auto [file, offset] = get_offset(index.position_);
@@ -126,6 +405,13 @@ struct MappedFileStorage::Imp {
 
         return ReadView{files_.at(file).const_data() + offset, index.size_};
     }
+    auto get_view(const IndexData& index) noexcept -> WritableView
+    {
+        const auto [file, offset] = get_offset(index.position_);
+        check_file(file);
+
+        return WritableView{files_.at(file).data() + offset, index.size_};
+    }
     auto get_write_view(
         LMDB::Transaction& tx,
         IndexData& index,
@@ -134,37 +420,52 @@ struct MappedFileStorage::Imp {
     {
         if (0 == bytes) { return {}; }
 
-        const auto replace = bytes == index.size_;
-        const auto output = [&] {
-            const auto [file, offset] = get_offset(index.position_);
-            check_file(file);
+        // NOTE an index which refers to released space was loaded before the
+        // item was moved or replaced and must not be written through
+        const auto stale = [&] {
+            if (0u == index.size_) { return false; }
 
-            return WritableView{files_.at(file).data() + offset, index.size_};
-        };
+            auto lock = Lock{state_lock_};
+
+            return 0u < released_.count(index.position_);
+        }();
+        const auto replace = (false == stale) && (bytes == index.size_);
 
         if (replace) {
             LogVerbose()(OT_PRETTY_CLASS())("Replacing existing item").Flush();
 
-            return output();
+            return get_view(index);
         }
 
-        increment_index(index, bytes);
-        LogDebug()(OT_PRETTY_CLASS())("Storing new item at position ")(
-            index.position_)
-            .Flush();
-        const auto nextPosition = index.position_ + bytes;
+        const auto previous = stale ? IndexData{} : index;
 
-        if (cb && (false == cb(tx))) { return {}; }
+        if (allocate(tx, index, bytes)) {
+            LogDebug()(OT_PRETTY_CLASS())("Reusing free space at position ")(
+                index.position_)
+                .Flush();
 
-        if (false == update_next_position(nextPosition, tx)) {
-            LogError()(OT_PRETTY_CLASS())(
-                "Failed to update next write position")
+            if (cb && (false == cb(tx))) { return {}; }
+        } else {
+            increment_index(index, bytes);
+            LogDebug()(OT_PRETTY_CLASS())("Storing new item at position ")(
+                index.position_)
                 .Flush();
+            const auto nextPosition = index.position_ + bytes;
 
-            return {};
+            if (cb && (false == cb(tx))) { return {}; }
+
+            if (false == update_next_position(nextPosition, tx)) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Failed to update next write position")
+                    .Flush();
+
+                return {};
+            }
         }
 
-        return output();
+        release(tx, previous);
+
+        return get_view(index);
     }
     auto increment_index(IndexData& index, std::size_t bytes) noexcept -> void
     {
@@ -220,6 +521,187 @@ struct MappedFileStorage::Imp {
 
         return output;
     }
+    auto move_item(
+        LMDB::Transaction& tx,
+        const int table,
+        const Space& key,
+        Space& value,
+        const IndexData& index) noexcept -> bool
+    {
+        // NOTE the item may have been replaced since the table was scanned
+        const auto current = [&] {
+            auto out = IndexData{};
+            lmdb_.Load(
+                table,
+                reader(key),
+                [&](const auto bytes) {
+                    if (sizeof(out) <= bytes.size()) {
+                        std::memcpy(
+                            static_cast<void*>(&out),
+                            bytes.data(),
+                            sizeof(out));
+                    }
+                },
+                tx);
+
+            return out;
+        }();
+
+        if ((current.position_ != index.position_) ||
+            (current.size_ != index.size_)) {
+
+            return true;
+        }
+
+        const auto extent = find_extent(index);
+
+        if (false == extent.has_value()) { return true; }
+
+        auto target = IndexData{};
+        forget_extent(*extent);
+
+        if (false == take(tx, *extent, index.size_, target)) {
+
+            return false;
+        }
+
+        if (const auto remaining = extent->index_.size_ - index.size_;
+            minimum_extent_ <= remaining) {
+            const auto leftover = FreeExtent{
+                IndexData{target.position_ + index.size_, remaining},
+                extent->released_};
+            compaction_.extents_[size_class(remaining)].emplace(
+                leftover.index_.position_, leftover);
+        }
+
+        {
+            const auto from = get_read_view(index);
+            auto to = get_view(target);
+
+            OT_ASSERT(to.valid(from.size()));
+
+            std::memcpy(to.data(), from.data(), from.size());
+        }
+
+        std::memcpy(static_cast<void*>(value.data()), &target, sizeof(target));
+        const auto stored = lmdb_.Store(table, reader(key), reader(value), tx);
+
+        if (false == stored.first) {
+            LogError()(OT_PRETTY_CLASS())("Failed to update index").Flush();
+
+            return false;
+        }
+
+        return release(tx, index);
+    }
+    auto release(LMDB::Transaction& tx, const IndexData& index) noexcept
+        -> bool
+    {
+        if (0u == index.size_) { return true; }
+
+        {
+            auto lock = Lock{state_lock_};
+
+            if (0u < released_.count(index.position_)) { return true; }
+        }
+
+        const auto time = now();
+
+        if (false == add_free(tx, FreeExtent{index, time})) { return false; }
+
+        tx.OnCommit([this, position = index.position_] {
+            auto lock = Lock{state_lock_};
+            released_[position] = epoch_++;
+            have_free_ = true;
+        });
+
+        return true;
+    }
+    // NOTE space released by this process in a transaction which has not
+    // committed is never reusable
+    auto reusable(const FreeExtent& extent) const noexcept -> bool
+    {
+        auto lock = Lock{state_lock_};
+        const auto i = released_.find(extent.index_.position_);
+
+        if (released_.end() == i) { return extent.released_ < start_time_; }
+
+        return readers_.empty() || (readers_.cbegin()->first > i->second);
+    }
+    auto start_compaction() noexcept -> void
+    {
+        auto& state = compaction_;
+        state = {};
+        state.running_ = true;
+        lmdb_.Read(
+            free_table_,
+            [&](const auto, const auto value) {
+                if (sizeof(FreeExtent) != value.size()) { return true; }
+
+                auto extent = FreeExtent{};
+                std::memcpy(
+                    static_cast<void*>(&extent), value.data(), value.size());
+
+                if (reusable(extent)) {
+                    state.extents_[size_class(extent.index_.size_)].emplace(
+                        extent.index_.position_, extent);
+                }
+
+                return true;
+            },
+            LMDB::Dir::Forward);
+    }
+    auto take(
+        LMDB::Transaction& tx,
+        const FreeExtent& extent,
+        const std::size_t bytes,
+        IndexData& index) noexcept -> bool
+    {
+        OT_ASSERT(bytes <= extent.index_.size_);
+
+        const auto key = size_class(extent.index_.size_);
+
+        if (false == lmdb_.Delete(free_table_, tsv(key), tsv(extent), tx)) {
+            LogError()(OT_PRETTY_CLASS())("Failed to remove free extent")
+                .Flush();
+
+            return false;
+        }
+
+        index.position_ = extent.index_.position_;
+        index.size_ = bytes;
+        const auto remaining = extent.index_.size_ - bytes;
+        const auto leftover = minimum_extent_ <= remaining;
+        // NOTE the remainder of an extent released by this process is subject
+        // to the same readers as the extent
+        const auto epoch = [&]() -> std::optional<Epoch> {
+            auto lock = Lock{state_lock_};
+
+            const auto i = released_.find(index.position_);
+
+            if (released_.end() != i) { return i->second; }
+
+            return std::nullopt;
+        }();
+        tx.OnCommit([this, position = index.position_, bytes, leftover, epoch] {
+            auto lock = Lock{state_lock_};
+            released_.erase(position);
+
+            if (leftover && epoch.has_value()) {
+                released_[position + bytes] = epoch.value();
+            }
+        });
+
+        if (leftover) {
+            add_free(
+                tx,
+                FreeExtent{
+                    IndexData{index.position_ + bytes, remaining},
+                    extent.released_});
+        }
+
+        return true;
+    }
     auto update_next_position(
         IndexData::MemoryPosition position,
         LMDB::Transaction& tx) noexcept -> bool
@@ -242,15 +724,39 @@ struct MappedFileStorage::Imp {
         const UnallocatedCString& basePath,
         const UnallocatedCString filenamePrefix,
         int table,
-        std::size_t key) noexcept(false)
+        std::size_t key,
+        int freeTable) noexcept(false)
         : lmdb_(lmdb)
         , path_prefix_(basePath)
         , filename_prefix_(filenamePrefix)
         , table_(table)
         , key_(key)
+        , free_table_(freeTable)
+        , start_time_(now())
         , next_position_(load_position(lmdb_))
         , files_(init_files(path_prefix_, next_position_))
+        , state_lock_()
+        , have_free_([&] {
+            auto empty{true};
+            lmdb_.Read(
+                free_table_,
+                [&](const auto, const auto) {
+                    empty = false;
+
+                    return false;
+                },
+                LMDB::Dir::Forward);
+
+            return false == empty;
+        }())
+        , released_()
+        , epoch_(0)
+        , readers_()
+        , compaction_()
     {
+        static_assert(
+            sizeof(FreeExtent) == (sizeof(IndexData) + sizeof(Seconds)));
+
         static_assert(1 == get_file_count(0));
         static_assert(1 == get_file_count(1));
         static_assert(1 == get_file_count(mapped_file_size() - 1u));
@@ -283,14 +789,39 @@ MappedFileStorage::MappedFileStorage(
     const UnallocatedCString& basePath,
     const UnallocatedCString filenamePrefix,
     int table,
-    std::size_t key) noexcept(false)
+    std::size_t key,
+    int freeTable) noexcept(false)
     : lmdb_(lmdb)
-    , imp_p_(std::make_unique<Imp>(lmdb, basePath, filenamePrefix, table, key))
+    , imp_p_(std::make_unique<Imp>(
+          lmdb,
+          basePath,
+          filenamePrefix,
+          table,
+          key,
+          freeTable))
     , imp_(*imp_p_)
 {
     OT_ASSERT(imp_p_);
 }
 
+auto MappedFileStorage::begin_read() const noexcept -> ReadEpoch
+{
+    return ReadEpoch{*this, imp_.begin_read()};
+}
+
+auto MappedFileStorage::compact(
+    std::mutex& mutex,
+    const UnallocatedVector<int>& tables,
+    std::size_t limit) const noexcept -> std::pair<std::size_t, bool>
+{
+    return imp_.compact(mutex, tables, limit);
+}
+
+auto MappedFileStorage::end_read(std::uint64_t epoch) const noexcept -> void
+{
+    imp_.end_read(epoch);
+}
+
 auto MappedFileStorage::get_read_view(const IndexData& index) const noexcept
     -> ReadView
 {
@@ -314,5 +845,31 @@ auto MappedFileStorage::get_write_view(
     return imp_.get_write_view(tx, index, {}, size);
 }
 
+auto MappedFileStorage::release(LMDB::Transaction& tx, const IndexData& index)
+    const noexcept -> bool
+{
+    return imp_.release(tx, index);
+}
+
 MappedFileStorage::~MappedFileStorage() = default;
+
+ReadEpoch::ReadEpoch(
+    const MappedFileStorage& parent,
+    std::uint64_t epoch) noexcept
+    : parent_(&parent)
+    , epoch_(epoch)
+{
+}
+
+ReadEpoch::ReadEpoch(ReadEpoch&& rhs) noexcept
+    : parent_(rhs.parent_)
+    , epoch_(rhs.epoch_)
+{
+    rhs.parent_ = nullptr;
+}
+
+ReadEpoch::~ReadEpoch()
+{
+    if (nullptr != parent_) { parent_->end_read(epoch_); }
+}
 }  // namespace opentxs::util
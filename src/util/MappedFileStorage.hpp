@@ -6,8 +6,11 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <utility>
 
 #include "opentxs/Version.hpp"
 #include "opentxs/util/Bytes.hpp"
@@ -25,6 +28,31 @@ struct IndexData {
     ItemSize size_{};
 };
 
+class MappedFileStorage;
+
+// Held by a reader from before it loads an IndexData until it no longer
+// references the data. Space released while a reader exists is not handed
+// out again until every reader which existed at the time is destroyed.
+class ReadEpoch
+{
+public:
+    ReadEpoch(ReadEpoch&& rhs) noexcept;
+
+    ~ReadEpoch();
+
+private:
+    friend MappedFileStorage;
+
+    const MappedFileStorage* parent_;
+    std::uint64_t epoch_;
+
+    ReadEpoch(const MappedFileStorage& parent, std::uint64_t epoch) noexcept;
+    ReadEpoch() = delete;
+    ReadEpoch(const ReadEpoch&) = delete;
+    auto operator=(const ReadEpoch&) -> ReadEpoch& = delete;
+    auto operator=(ReadEpoch&&) -> ReadEpoch& = delete;
+};
+
 class MappedFileStorage
 {
 protected:
@@ -33,6 +61,11 @@ protected:
 
     LMDB& lmdb_;
 
+    // Registers a reader. Inheritors must ensure every reader which does not
+    // exclude writers for the whole time between loading an IndexData and
+    // its last use of the data holds a ReadEpoch obtained before the index
+    // was loaded.
+    auto begin_read() const noexcept -> ReadEpoch;
     // NOTE: this class performs no locking. Inheritors must ensure these
     // functions are not called simultaneously from multiple threads.
     auto get_read_view(const IndexData& index) const noexcept -> ReadView;
@@ -40,8 +73,9 @@ protected:
     // supply an existing IndexData if you want to (potentially) replace the
     // existing item. An existing item will be overwritten if the size of the
     // old items matches the size of the new item; to do otherwise would be
-    // madness. If the size doesn't match then space will be allocated at the
-    // end of the file and we just forget about the old data.
+    // madness. If the size doesn't match then space will be taken from a
+    // reusable free extent if one is large enough, or else allocated at the
+    // end of the file, and the old extent is released.
     //
     // Regardless after this function is called the supplied index will be
     // updated to the location at which the return value points so you should
@@ -57,20 +91,46 @@ protected:
         LMDB::Transaction& tx,
         IndexData& index,
         std::size_t size) const noexcept -> WritableView;
+    // Performs one batch of an incremental compaction pass over the
+    // specified index tables. Each call examines at most limit entries,
+    // continuing from where the previous call stopped, and moves the items
+    // they reference into free extents closer to the start of the storage.
+    // Each batch uses its own write transaction and holds the mutex only
+    // while items are moved. The value of every entry in the tables must
+    // begin with an IndexData. Returns the number of items moved and whether
+    // the pass is finished.
+    //
+    // Only one thread may perform compaction.
+    auto compact(
+        std::mutex& mutex,
+        const UnallocatedVector<int>& tables,
+        std::size_t limit) const noexcept -> std::pair<std::size_t, bool>;
+    // Records the space used by an item which is no longer referenced as
+    // free. Released space is recorded in an LMDB table bucketed by size class
+    // and is not handed out again until tx has committed and every ReadEpoch
+    // which existed at that time has been destroyed, since those readers may
+    // still hold views of the old data.
+    auto release(LMDB::Transaction& tx, const IndexData& index) const noexcept
+        -> bool;
 
     MappedFileStorage(
         opentxs::storage::lmdb::LMDB& lmdb,
         const UnallocatedCString& basePath,
         const UnallocatedCString filenamePrefix,
         int table,
-        std::size_t key) noexcept(false);
+        std::size_t key,
+        int freeTable) noexcept(false);
 
     virtual ~MappedFileStorage();
 
 private:
+    friend ReadEpoch;
+
     struct Imp;
 
     mutable std::unique_ptr<Imp> imp_p_;
     Imp& imp_;
+
+    auto end_read(std::uint64_t epoch) const noexcept -> void;
 };
 }  // namespace opentxs::util
@@ -38,9 +38,14 @@ struct Options::Imp::Parser {
     static constexpr auto blockchain_disable_{"disable_blockchain"};
     static constexpr auto blockchain_ipv4_bind_{"blockchain_bind_ipv4"};
     static constexpr auto blockchain_ipv6_bind_{"blockchain_bind_ipv6"};
+    static constexpr auto blockchain_spend_batch_outputs_{
+        "blockchain_spend_batch_outputs"};
+    static constexpr auto blockchain_spend_batch_window_{
+        "blockchain_spend_batch_window"};
     static constexpr auto blockchain_storage_{"blockchain_storage"};
     static constexpr auto blockchain_sync_provide_{"provide_sync_server"};
     static constexpr auto blockchain_sync_connect_{"blockchain_sync_server"};
+    static constexpr auto blockchain_sync_paranoid_{"blockchain_sync_paranoid"};
     static constexpr auto blockchain_wallet_enable_{"blockchain_wallet"};
     static constexpr auto default_mint_key_bytes_{"mint_key_default_bytes"};
     static constexpr auto home_{"ot_home"};
@@ -59,6 +64,7 @@ struct Options::Imp::Parser {
     static constexpr auto notary_public_port_{"notary_command_port"};
     static constexpr auto notary_terms_{"notary_terms"};
     static constexpr auto storage_plugin_{"ot_storage_plugin"};
+    static constexpr auto ui_update_interval_{"ui_update_interval"};
 
     po::variables_map variables_;
 
@@ -82,6 +88,16 @@ struct Options::Imp::Parser {
                 po::value<Multistring>()->multitoken()->composing(),
                 "Local ipv6 addresses to bind for incoming blockchain "
                 "connections");
+            out.add_options()(
+                blockchain_spend_batch_outputs_,
+                po::value<std::size_t>(),
+                "Maximum number of outputs in a transaction which combines "
+                "several outgoing payments");
+            out.add_options()(
+                blockchain_spend_batch_window_,
+                po::value<std::size_t>(),
+                "Interval in milliseconds during which outgoing payments are "
+                "combined into a single transaction. 0 disables batching");
             out.add_options()(
                 blockchain_storage_,
                 po::value<int>(),
@@ -96,6 +112,11 @@ struct Options::Imp::Parser {
                 blockchain_sync_connect_,
                 po::value<Multistring>()->multitoken()->composing(),
                 "Blockchain sync server(s) to connect to as a client");
+            out.add_options()(
+                blockchain_sync_paranoid_,
+                po::value<bool>()->implicit_value(true),
+                "Verify the checksum of every stored sync packet each time it "
+                "is served instead of once per process");
             out.add_options()(
                 blockchain_wallet_enable_,
                 po::value<bool>()->implicit_value(true),
@@ -175,6 +196,12 @@ struct Options::Imp::Parser {
                 storage_plugin_,
                 po::value<UnallocatedCString>(),
                 "primary opentxs storage plugin");
+            out.add_options()(
+                ui_update_interval_,
+                po::value<std::size_t>(),
+                "Interval in milliseconds during which ui model updates are "
+                "merged before being delivered. 0 delivers every update "
+                "immediately");
 
             return out;
         }();
@@ -199,7 +226,10 @@ Options::Imp::Imp() noexcept
     : blockchain_disabled_chains_()
     , blockchain_ipv4_bind_()
     , blockchain_ipv6_bind_()
+    , blockchain_spend_batch_outputs_(std::nullopt)
+    , blockchain_spend_batch_window_(std::nullopt)
     , blockchain_storage_level_(std::nullopt)
+    , blockchain_sync_paranoid_(std::nullopt)
     , blockchain_sync_server_enabled_(std::nullopt)
     , blockchain_sync_servers_()
     , blockchain_wallet_enabled_(std::nullopt)
@@ -222,6 +252,7 @@ Options::Imp::Imp() noexcept
     , qt_root_object_(std::nullopt)
     , storage_primary_plugin_(std::nullopt)
     , test_mode_(std::nullopt)
+    , ui_update_interval_(std::nullopt)
 {
 }
 
@@ -229,7 +260,10 @@ Options::Imp::Imp(const Imp& rhs) noexcept
     : blockchain_disabled_chains_(rhs.blockchain_disabled_chains_)
     , blockchain_ipv4_bind_(rhs.blockchain_ipv4_bind_)
     , blockchain_ipv6_bind_(rhs.blockchain_ipv6_bind_)
+    , blockchain_spend_batch_outputs_(rhs.blockchain_spend_batch_outputs_)
+    , blockchain_spend_batch_window_(rhs.blockchain_spend_batch_window_)
     , blockchain_storage_level_(rhs.blockchain_storage_level_)
+    , blockchain_sync_paranoid_(rhs.blockchain_sync_paranoid_)
     , blockchain_sync_server_enabled_(rhs.blockchain_sync_server_enabled_)
     , blockchain_sync_servers_(rhs.blockchain_sync_servers_)
     , blockchain_wallet_enabled_(rhs.blockchain_wallet_enabled_)
@@ -252,6 +286,7 @@ Options::Imp::Imp(const Imp& rhs) noexcept
     , qt_root_object_(rhs.qt_root_object_)
     , storage_primary_plugin_(rhs.storage_primary_plugin_)
     , test_mode_(rhs.test_mode_)
+    , ui_update_interval_(rhs.ui_update_interval_)
 {
 }
 
@@ -320,6 +355,13 @@ auto Options::Imp::import_value(const char* key, const char* value) noexcept
             blockchain_ipv4_bind_.emplace(value);
         } else if (0 == std::strcmp(key, Parser::blockchain_ipv6_bind_)) {
             blockchain_ipv6_bind_.emplace(value);
+        } else if (
+            0 == std::strcmp(key, Parser::blockchain_spend_batch_outputs_)) {
+            blockchain_spend_batch_outputs_ = std::stoull(value);
+        } else if (
+            0 == std::strcmp(key, Parser::blockchain_spend_batch_window_)) {
+            blockchain_spend_batch_window_ =
+                std::chrono::milliseconds{std::stoull(value)};
         } else if (0 == std::strcmp(key, Parser::blockchain_storage_)) {
             blockchain_storage_level_ = std::stoi(value);
         } else if (0 == std::strcmp(key, Parser::blockchain_sync_provide_)) {
@@ -330,6 +372,8 @@ auto Options::Imp::import_value(const char* key, const char* value) noexcept
             }
         } else if (0 == std::strcmp(key, Parser::blockchain_sync_connect_)) {
             blockchain_sync_servers_.emplace(value);
+        } else if (0 == std::strcmp(key, Parser::blockchain_sync_paranoid_)) {
+            blockchain_sync_paranoid_ = to_bool(value);
         } else if (0 == std::strcmp(key, Parser::blockchain_wallet_enable_)) {
             blockchain_wallet_enabled_ = to_bool(value);
         } else if (0 == std::strcmp(key, Parser::default_mint_key_bytes_)) {
@@ -368,6 +412,8 @@ auto Options::Imp::import_value(const char* key, const char* value) noexcept
             notary_terms_ = value;
         } else if (0 == std::strcmp(key, Parser::storage_plugin_)) {
             storage_primary_plugin_ = value;
+        } else if (0 == std::strcmp(key, Parser::ui_update_interval_)) {
+            ui_update_interval_ = std::chrono::milliseconds{std::stoull(value)};
         }
     } catch (...) {
     }
@@ -433,6 +479,17 @@ auto Options::Imp::parse(int argc, char** argv) noexcept(false) -> void
                     std::inserter(dest, dest.end()));
             } catch (...) {
             }
+        } else if (name == Parser::blockchain_spend_batch_outputs_) {
+            try {
+                blockchain_spend_batch_outputs_ = value.as<std::size_t>();
+            } catch (...) {
+            }
+        } else if (name == Parser::blockchain_spend_batch_window_) {
+            try {
+                blockchain_spend_batch_window_ =
+                    std::chrono::milliseconds{value.as<std::size_t>()};
+            } catch (...) {
+            }
         } else if (name == Parser::blockchain_storage_) {
             try {
                 blockchain_storage_level_ = value.as<int>();
@@ -457,6 +514,11 @@ auto Options::Imp::parse(int argc, char** argv) noexcept(false) -> void
                     std::inserter(dest, dest.end()));
             } catch (...) {
             }
+        } else if (name == Parser::blockchain_sync_paranoid_) {
+            try {
+                blockchain_sync_paranoid_ = value.as<bool>();
+            } catch (...) {
+            }
         } else if (name == Parser::blockchain_wallet_enable_) {
             try {
                 blockchain_wallet_enabled_ = value.as<bool>();
@@ -564,6 +626,12 @@ auto Options::Imp::parse(int argc, char** argv) noexcept(false) -> void
                 storage_primary_plugin_ = value.as<UnallocatedCString>();
             } catch (...) {
             }
+        } else if (name == Parser::ui_update_interval_) {
+            try {
+                ui_update_interval_ =
+                    std::chrono::milliseconds{value.as<std::size_t>()};
+            } catch (...) {
+            }
         }
     }
 }
@@ -618,10 +686,22 @@ auto operator+(const Options& lhs, const Options& rhs) noexcept -> Options
         r.blockchain_ipv6_bind_.end(),
         std::inserter(l.blockchain_ipv6_bind_, l.blockchain_ipv6_bind_.end()));
 
+    if (const auto& v = r.blockchain_spend_batch_outputs_; v.has_value()) {
+        l.blockchain_spend_batch_outputs_ = v.value();
+    }
+
+    if (const auto& v = r.blockchain_spend_batch_window_; v.has_value()) {
+        l.blockchain_spend_batch_window_ = v.value();
+    }
+
     if (const auto& v = r.blockchain_storage_level_; v.has_value()) {
         l.blockchain_storage_level_ = v.value();
     }
 
+    if (const auto& v = r.blockchain_sync_paranoid_; v.has_value()) {
+        l.blockchain_sync_paranoid_ = v.value();
+    }
+
     if (const auto& v = r.blockchain_sync_server_enabled_; v.has_value()) {
         l.blockchain_sync_server_enabled_ = v.value();
     }
@@ -711,6 +791,10 @@ auto operator+(const Options& lhs, const Options& rhs) noexcept -> Options
         l.test_mode_ = v.value();
     }
 
+    if (const auto& v = r.ui_update_interval_; v.has_value()) {
+        l.ui_update_interval_ = v.value();
+    }
+
     return out;
 }
 
@@ -801,11 +885,29 @@ auto Options::BlockchainBindIpv6() const noexcept
     return imp_->blockchain_ipv6_bind_;
 }
 
+auto Options::BlockchainSpendBatchOutputs() const noexcept -> std::size_t
+{
+    static constexpr auto defaultValue = std::size_t{100};
+
+    return Imp::get(imp_->blockchain_spend_batch_outputs_, defaultValue);
+}
+
+auto Options::BlockchainSpendBatchWindow() const noexcept
+    -> std::chrono::milliseconds
+{
+    return Imp::get(imp_->blockchain_spend_batch_window_);
+}
+
 auto Options::BlockchainStorageLevel() const noexcept -> int
 {
     return Imp::get(imp_->blockchain_storage_level_);
 }
 
+auto Options::BlockchainSyncParanoid() const noexcept -> bool
+{
+    return Imp::get(imp_->blockchain_sync_paranoid_);
+}
+
 auto Options::BlockchainWalletEnabled() const noexcept -> bool
 {
     return Imp::get(imp_->blockchain_wallet_enabled_, true);
@@ -950,6 +1052,22 @@ auto Options::RemoteLogEndpoint() const noexcept -> const char*
     return Imp::get(imp_->log_endpoint_);
 }
 
+auto Options::SetBlockchainSpendBatchOutputs(std::size_t count) noexcept
+    -> Options&
+{
+    imp_->blockchain_spend_batch_outputs_ = count;
+
+    return *this;
+}
+
+auto Options::SetBlockchainSpendBatchWindow(
+    std::chrono::milliseconds window) noexcept -> Options&
+{
+    imp_->blockchain_spend_batch_window_ = window;
+
+    return *this;
+}
+
 auto Options::SetBlockchainStorageLevel(int value) noexcept -> Options&
 {
     imp_->blockchain_storage_level_ = value;
@@ -965,6 +1083,13 @@ auto Options::SetBlockchainSyncEnabled(bool enabled) noexcept -> Options&
     return *this;
 }
 
+auto Options::SetBlockchainSyncParanoid(bool paranoid) noexcept -> Options&
+{
+    imp_->blockchain_sync_paranoid_ = paranoid;
+
+    return *this;
+}
+
 auto Options::SetBlockchainWalletEnabled(bool enabled) noexcept -> Options&
 {
     imp_->blockchain_wallet_enabled_ = enabled;
@@ -1077,6 +1202,14 @@ auto Options::SetTestMode(bool test) noexcept -> Options&
     return *this;
 }
 
+auto Options::SetUIUpdateInterval(std::chrono::milliseconds interval) noexcept
+    -> Options&
+{
+    imp_->ui_update_interval_ = interval;
+
+    return *this;
+}
+
 auto Options::StoragePrimaryPlugin() const noexcept -> const char*
 {
     return Imp::get(imp_->storage_primary_plugin_);
@@ -1087,6 +1220,11 @@ auto Options::TestMode() const noexcept -> bool
     return Imp::get(imp_->test_mode_);
 }
 
+auto Options::UIUpdateInterval() const noexcept -> std::chrono::milliseconds
+{
+    return Imp::get(imp_->ui_update_interval_);
+}
+
 Options::~Options()
 {
     if (nullptr != imp_) {
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
@@ -22,7 +23,10 @@ struct Options::Imp final {
     UnallocatedSet<blockchain::Type> blockchain_disabled_chains_;
     UnallocatedSet<UnallocatedCString> blockchain_ipv4_bind_;
     UnallocatedSet<UnallocatedCString> blockchain_ipv6_bind_;
+    std::optional<std::size_t> blockchain_spend_batch_outputs_;
+    std::optional<std::chrono::milliseconds> blockchain_spend_batch_window_;
     std::optional<int> blockchain_storage_level_;
+    std::optional<bool> blockchain_sync_paranoid_;
     std::optional<bool> blockchain_sync_server_enabled_;
     UnallocatedSet<UnallocatedCString> blockchain_sync_servers_;
     std::optional<bool> blockchain_wallet_enabled_;
@@ -45,6 +49,7 @@ struct Options::Imp final {
     std::optional<QObject*> qt_root_object_;
     std::optional<UnallocatedCString> storage_primary_plugin_;
     std::optional<bool> test_mode_;
+    std::optional<std::chrono::milliseconds> ui_update_interval_;
 
     template <typename T>
     static auto get(const std::optional<T>& data, T defaultValue = {}) noexcept
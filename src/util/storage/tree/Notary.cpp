@@ -7,12 +7,12 @@
 #include "1_Internal.hpp"                // IWYU pragma: associated
 #include "util/storage/tree/Notary.hpp"  // IWYU pragma: associated
 
+#include <memory>
 #include <stdexcept>
 #include <utility>
 
 #include "Proto.hpp"
 #include "internal/serialization/protobuf/Check.hpp"
-#include "internal/serialization/protobuf/verify/SpentTokenList.hpp"
 #include "internal/serialization/protobuf/verify/StorageNotary.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
@@ -21,7 +21,6 @@
 #include "opentxs/util/Pimpl.hpp"
 #include "opentxs/util/storage/Driver.hpp"
 #include "serialization/protobuf/BlindedSeriesList.pb.h"
-#include "serialization/protobuf/SpentTokenList.pb.h"
 #include "serialization/protobuf/StorageEnums.pb.h"
 #include "serialization/protobuf/StorageItemHash.pb.h"
 #include "serialization/protobuf/StorageNotary.pb.h"
@@ -33,7 +32,6 @@ namespace
 constexpr auto STORAGE_NOTARY_VERSION = 1;
 constexpr auto STORAGE_MINT_SERIES_VERSION = 1;
 constexpr auto STORAGE_MINT_SERIES_HASH_VERSION = 2;
-constexpr auto STORAGE_MINT_SPENT_LIST_VERSION = 1;
 }  // namespace
 
 namespace opentxs::storage
@@ -45,6 +43,7 @@ Notary::Notary(
     : Node(storage, hash)
     , id_(id)
     , mint_map_()
+    , spent_()
 {
     if (check_hash(hash)) {
         init(hash);
@@ -61,15 +60,13 @@ auto Notary::CheckSpent(
     if (key.empty()) { throw std::runtime_error("Invalid token key"); }
 
     Lock lock(write_lock_);
-    const auto list = get_or_create_list(lock, unit.str(), series);
+    const auto& index = get_or_load_index(lock, unit.str(), series);
 
-    for (const auto& spent : list.spent()) {
-        if (spent == key) {
-            LogTrace()(OT_PRETTY_CLASS())("Token ")(key)(" is already spent.")
-                .Flush();
+    if (index.Check(key)) {
+        LogTrace()(OT_PRETTY_CLASS())("Token ")(key)(" is already spent.")
+            .Flush();
 
-            return true;
-        }
+        return true;
     }
 
     LogTrace()(OT_PRETTY_CLASS())("Token ")(key)(" has never been spent.")
@@ -78,50 +75,20 @@ auto Notary::CheckSpent(
     return false;
 }
 
-auto Notary::create_list(
-    const UnallocatedCString& unitID,
-    const MintSeries series,
-    std::shared_ptr<proto::SpentTokenList>& output) const -> UnallocatedCString
-{
-    UnallocatedCString hash{};
-    output.reset(new proto::SpentTokenList);
-
-    OT_ASSERT(output);
-
-    auto& list = *output;
-    list.set_version(STORAGE_MINT_SPENT_LIST_VERSION);
-    list.set_notary(id_);
-    list.set_unit(unitID);
-    list.set_series(series);
-
-    const auto saved = driver_.StoreProto(list, hash);
-
-    if (false == saved) {
-        throw std::runtime_error("Failed to create spent token list");
-    }
-
-    return hash;
-}
-
-auto Notary::get_or_create_list(
+auto Notary::get_or_load_index(
     const Lock& lock,
     const UnallocatedCString& unitID,
-    const MintSeries series) const -> proto::SpentTokenList
+    const MintSeries series) const -> SpentTokens&
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    std::shared_ptr<proto::SpentTokenList> output{};
-    auto& hash = mint_map_[unitID][series];
+    auto& output = spent_[std::make_pair(unitID, series)];
 
-    if (hash.empty()) {
-        hash = create_list(unitID, series, output);
-    } else {
-        driver_.LoadProto(hash, output);
-    }
+    if (output) { return *output; }
 
-    if (false == bool(output)) {
-        throw std::runtime_error("Failed to load spent token list");
-    }
+    auto& hash = mint_map_[unitID][series];
+    output = std::make_unique<SpentTokens>(driver_, id_, unitID, series, hash);
+    hash = output->Hash();
 
     return *output;
 }
@@ -162,15 +129,27 @@ auto Notary::MarkSpent(
     }
 
     Lock lock(write_lock_);
-    auto list = get_or_create_list(lock, unit.str(), series);
-    list.add_spent(key);
+    const auto unitID = unit.str();
+    auto& index = get_or_load_index(lock, unitID, series);
+
+    if (index.Check(key)) {
+        LogTrace()(OT_PRETTY_CLASS())("Token ")(key)(" is already spent.")
+            .Flush();
 
-    OT_ASSERT(proto::Validate(list, VERBOSE));
+        return true;
+    }
+
+    if (false == index.Mark(key)) {
+        LogError()(OT_PRETTY_CLASS())("Failed to mark token ")(key)(" as spent")
+            .Flush();
+
+        return false;
+    }
 
-    auto& hash = mint_map_[unit.str()][series];
+    mint_map_[unitID][series] = index.Hash();
     LogTrace()(OT_PRETTY_CLASS())("Token ")(key)(" marked as spent.").Flush();
 
-    return driver_.StoreProto(list, hash);
+    return true;
 }
 
 auto Notary::save(const Lock& lock) const -> bool
@@ -7,6 +7,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <utility>
 
 #include "Proto.hpp"
 #include "internal/util/Editor.hpp"
@@ -14,9 +15,9 @@
 #include "opentxs/Version.hpp"
 #include "opentxs/api/session/Storage.hpp"
 #include "opentxs/util/Container.hpp"
-#include "serialization/protobuf/SpentTokenList.pb.h"
 #include "serialization/protobuf/StorageNotary.pb.h"
 #include "util/storage/tree/Node.hpp"
+#include "util/storage/tree/SpentTokens.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -61,19 +62,19 @@ private:
     using SeriesMap = UnallocatedMap<MintSeries, UnallocatedCString>;
     using UnitMap = UnallocatedMap<UnallocatedCString, SeriesMap>;
 
+    using IndexMap = UnallocatedMap<
+        std::pair<UnallocatedCString, MintSeries>,
+        std::unique_ptr<SpentTokens>>;
+
     UnallocatedCString id_;
 
     mutable UnitMap mint_map_;
+    mutable IndexMap spent_;
 
-    auto create_list(
-        const UnallocatedCString& unitID,
-        const MintSeries series,
-        std::shared_ptr<proto::SpentTokenList>& output) const
-        -> UnallocatedCString;
-    auto get_or_create_list(
+    auto get_or_load_index(
         const Lock& lock,
         const UnallocatedCString& unitID,
-        const MintSeries series) const -> proto::SpentTokenList;
+        const MintSeries series) const -> SpentTokens&;
     auto save(const Lock& lock) const -> bool final;
     auto serialize() const -> proto::StorageNotary;
 
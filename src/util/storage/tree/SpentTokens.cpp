@@ -0,0 +1,141 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                       // IWYU pragma: associated
+#include "1_Internal.hpp"                     // IWYU pragma: associated
+#include "util/storage/tree/SpentTokens.hpp"  // IWYU pragma: associated
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "Proto.hpp"
+#include "internal/serialization/protobuf/Check.hpp"
+#include "internal/serialization/protobuf/verify/SpentTokenList.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/util/Log.hpp"
+#include "opentxs/util/storage/Driver.hpp"
+#include "util/storage/Plugin.hpp"
+
+namespace
+{
+constexpr auto STORAGE_MINT_SPENT_LIST_VERSION = 2;
+}  // namespace
+
+namespace opentxs::storage
+{
+const std::size_t SpentTokens::segment_limit_{1024};
+
+SpentTokens::SpentTokens(
+    const Driver& driver,
+    const UnallocatedCString& notary,
+    const UnallocatedCString& unit,
+    const MintSeries series,
+    const UnallocatedCString& hash) noexcept(false)
+    : driver_(driver)
+    , notary_(notary)
+    , unit_(unit)
+    , series_(series)
+    , hash_(hash)
+    , tokens_()
+    , tail_()
+{
+    if (hash_.empty()) {
+        tail_ = blank();
+
+        if (false == driver_.StoreProto(tail_, hash_)) {
+            throw std::runtime_error("Failed to create spent token list");
+        }
+    } else {
+        load();
+    }
+}
+
+auto SpentTokens::blank() const noexcept -> proto::SpentTokenList
+{
+    auto output = proto::SpentTokenList{};
+    output.set_version(STORAGE_MINT_SPENT_LIST_VERSION);
+    output.set_notary(notary_);
+    output.set_unit(unit_);
+    output.set_series(series_);
+
+    return output;
+}
+
+auto SpentTokens::Check(const UnallocatedCString& key) const noexcept -> bool
+{
+    return 0u < tokens_.count(key);
+}
+
+auto SpentTokens::load() noexcept(false) -> void
+{
+    auto segment = std::shared_ptr<proto::SpentTokenList>{};
+    driver_.LoadProto(hash_, segment);
+
+    if (false == bool(segment)) {
+        throw std::runtime_error("Failed to load spent token list");
+    }
+
+    tail_ = *segment;
+
+    while (true) {
+        for (const auto& token : segment->spent()) { tokens_.emplace(token); }
+
+        if (segment->previous().empty()) { break; }
+
+        const auto previous = segment->previous();
+        segment.reset();
+        driver_.LoadProto(previous, segment);
+
+        if (false == bool(segment)) {
+            throw std::runtime_error("Failed to load spent token list segment");
+        }
+    }
+}
+
+auto SpentTokens::Mark(const UnallocatedCString& key) noexcept -> bool
+{
+    if (Check(key)) { return true; }
+
+    const auto seal =
+        segment_limit_ <= static_cast<std::size_t>(tail_.spent_size());
+    auto next = proto::SpentTokenList{};
+
+    if (seal) {
+        next = blank();
+        next.set_previous(hash_);
+    }
+
+    auto& segment = seal ? next : tail_;
+    segment.add_spent(key);
+    const auto revert = [&] {
+        if (false == seal) { tail_.mutable_spent()->RemoveLast(); }
+    };
+
+    if (false == proto::Validate(segment, VERBOSE)) {
+        LogError()(OT_PRETTY_CLASS())("Invalid spent token list").Flush();
+        revert();
+
+        return false;
+    }
+
+    auto updated = UnallocatedCString{};
+
+    if (false == driver_.StoreProto(segment, updated)) {
+        LogError()(OT_PRETTY_CLASS())("Failed to store spent token list")
+            .Flush();
+        revert();
+
+        return false;
+    }
+
+    if (seal) { tail_ = std::move(next); }
+
+    hash_ = std::move(updated);
+    tokens_.emplace(key);
+
+    return true;
+}
+}  // namespace opentxs::storage
@@ -0,0 +1,81 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <robin_hood.h>
+#include <cstddef>
+#include <cstdint>
+
+#include "opentxs/Version.hpp"
+#include "opentxs/util/Container.hpp"
+#include "serialization/protobuf/SpentTokenList.pb.h"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace storage
+{
+class Driver;
+}  // namespace storage
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::storage
+{
+// The spent tokens for a series are persisted as a chain of SpentTokenList
+// segments linked by their previous field. Only the tail segment is rewritten
+// when a token is spent and it is sealed once it holds segment_limit_ tokens,
+// so the cost of Mark does not depend on how many tokens have been spent in
+// the series.
+//
+// Lists written before segments were introduced are read as a single segment.
+class SpentTokens
+{
+public:
+    using MintSeries = std::uint64_t;
+
+    static const std::size_t segment_limit_;
+
+    auto Check(const UnallocatedCString& key) const noexcept -> bool;
+    // Hash of the tail segment
+    auto Hash() const noexcept -> const UnallocatedCString& { return hash_; }
+
+    auto Mark(const UnallocatedCString& key) noexcept -> bool;
+
+    // Loads every segment in the chain ending at hash, or stores a new empty
+    // list if hash is empty. Throws std::runtime_error on failure.
+    SpentTokens(
+        const Driver& driver,
+        const UnallocatedCString& notary,
+        const UnallocatedCString& unit,
+        const MintSeries series,
+        const UnallocatedCString& hash) noexcept(false);
+
+    ~SpentTokens() = default;
+
+private:
+    const Driver& driver_;
+    const UnallocatedCString notary_;
+    const UnallocatedCString unit_;
+    const MintSeries series_;
+    UnallocatedCString hash_;
+    robin_hood::unordered_flat_set<UnallocatedCString> tokens_;
+    proto::SpentTokenList tail_;
+
+    auto blank() const noexcept -> proto::SpentTokenList;
+
+    auto load() noexcept(false) -> void;
+
+    SpentTokens() = delete;
+    SpentTokens(const SpentTokens&) = delete;
+    SpentTokens(SpentTokens&&) = delete;
+    auto operator=(const SpentTokens&) -> SpentTokens& = delete;
+    auto operator=(SpentTokens&&) -> SpentTokens& = delete;
+};
+}  // namespace opentxs::storage
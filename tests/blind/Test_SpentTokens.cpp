@@ -0,0 +1,306 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "internal/serialization/protobuf/verify/SpentTokenList.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Storage.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/core/identifier/Notary.hpp"
+#include "opentxs/core/identifier/UnitDefinition.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "opentxs/util/storage/Driver.hpp"
+#include "serialization/protobuf/SpentTokenList.pb.h"
+#include "util/storage/Plugin.hpp"
+#include "util/storage/tree/SpentTokens.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using SpentTokens = ot::storage::SpentTokens;
+
+// Keeps every stored object in memory
+class MemoryDriver final : public ot::storage::Driver
+{
+public:
+    mutable ot::UnallocatedMap<ot::UnallocatedCString, ot::UnallocatedCString>
+        data_{};
+
+    auto EmptyBucket(const bool) const -> bool final { return false; }
+    auto Load(
+        const ot::UnallocatedCString& key,
+        const bool,
+        ot::UnallocatedCString& value) const -> bool final
+    {
+        if (auto i = data_.find(key); data_.end() != i) {
+            value = i->second;
+
+            return true;
+        }
+
+        return false;
+    }
+    auto LoadFromBucket(
+        const ot::UnallocatedCString&,
+        ot::UnallocatedCString&,
+        const bool) const -> bool final
+    {
+        return false;
+    }
+    auto LoadRoot() const -> ot::UnallocatedCString final { return {}; }
+    auto Migrate(const ot::UnallocatedCString&, const Driver&) const
+        -> bool final
+    {
+        return false;
+    }
+    auto Store(
+        const bool,
+        const ot::UnallocatedCString&,
+        const ot::UnallocatedCString&,
+        const bool) const -> bool final
+    {
+        return false;
+    }
+    void Store(
+        const bool,
+        const ot::UnallocatedCString&,
+        const ot::UnallocatedCString&,
+        const bool,
+        std::promise<bool>& promise) const final
+    {
+        promise.set_value(false);
+    }
+    auto Store(
+        const bool,
+        const ot::UnallocatedCString& value,
+        ot::UnallocatedCString& key) const -> bool final
+    {
+        key = ot::Identifier::Random()->str();
+        data_[key] = value;
+
+        return true;
+    }
+    auto StoreRoot(const bool, const ot::UnallocatedCString&) const
+        -> bool final
+    {
+        return false;
+    }
+};
+
+class Test_SpentTokens : public ::testing::Test
+{
+public:
+    static constexpr auto series_ = SpentTokens::MintSeries{4};
+
+    const ot::api::session::Client& api_;
+    const ot::OTNotaryID notary_;
+    const ot::OTUnitID unit_;
+    const MemoryDriver driver_;
+
+    static auto Token() noexcept -> ot::UnallocatedCString
+    {
+        return ot::Identifier::Random()->str();
+    }
+
+    auto Create() const noexcept(false) -> std::unique_ptr<SpentTokens>
+    {
+        return Load({});
+    }
+    auto Load(const ot::UnallocatedCString& hash) const noexcept(false)
+        -> std::unique_ptr<SpentTokens>
+    {
+        return std::make_unique<SpentTokens>(
+            driver_, notary_->str(), unit_->str(), series_, hash);
+    }
+    auto Segment(const ot::UnallocatedCString& hash) const noexcept
+        -> std::shared_ptr<ot::proto::SpentTokenList>
+    {
+        auto output = std::shared_ptr<ot::proto::SpentTokenList>{};
+        driver_.LoadProto(hash, output);
+
+        return output;
+    }
+    // Number of segments in the chain ending at hash
+    auto Segments(const ot::UnallocatedCString& hash) const noexcept
+        -> std::size_t
+    {
+        auto output = std::size_t{0};
+
+        for (auto segment = Segment(hash); segment;) {
+            ++output;
+
+            if (segment->previous().empty()) { break; }
+
+            segment = Segment(segment->previous());
+        }
+
+        return output;
+    }
+
+    Test_SpentTokens()
+        : api_(ot::Context().StartClientSession(0))
+        , notary_([] {
+            auto out = ot::identifier::Notary::Factory();
+            out->SetString(ot::Identifier::Random()->str());
+
+            return out;
+        }())
+        , unit_([] {
+            auto out = ot::identifier::UnitDefinition::Factory();
+            out->SetString(ot::Identifier::Random()->str());
+
+            return out;
+        }())
+        , driver_()
+    {
+    }
+};
+
+TEST_F(Test_SpentTokens, check_and_mark)
+{
+    const auto tokens = Create();
+    const auto token = Token();
+
+    ASSERT_TRUE(tokens);
+    EXPECT_FALSE(tokens->Hash().empty());
+    EXPECT_FALSE(tokens->Check(token));
+    EXPECT_TRUE(tokens->Mark(token));
+    EXPECT_TRUE(tokens->Check(token));
+
+    // NOTE marking a token twice does not write a new segment
+    const auto hash = tokens->Hash();
+    const auto stored = driver_.data_.size();
+
+    EXPECT_TRUE(tokens->Mark(token));
+    EXPECT_EQ(tokens->Hash(), hash);
+    EXPECT_EQ(driver_.data_.size(), stored);
+}
+
+TEST_F(Test_SpentTokens, invalid_token)
+{
+    const auto tokens = Create();
+    const auto hash = tokens->Hash();
+    const auto stored = driver_.data_.size();
+
+    // NOTE segments which fail validation are never stored
+    EXPECT_FALSE(tokens->Mark("short"));
+    EXPECT_FALSE(tokens->Check("short"));
+    EXPECT_EQ(tokens->Hash(), hash);
+    EXPECT_EQ(driver_.data_.size(), stored);
+    EXPECT_EQ(Segment(hash)->spent_size(), 0);
+}
+
+TEST_F(Test_SpentTokens, reload)
+{
+    const auto count = 2u * SpentTokens::segment_limit_ + 1u;
+    auto spent = ot::UnallocatedVector<ot::UnallocatedCString>{};
+    auto hash = ot::UnallocatedCString{};
+
+    {
+        const auto tokens = Create();
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto& token = spent.emplace_back(Token());
+
+            ASSERT_TRUE(tokens->Mark(token));
+        }
+
+        hash = tokens->Hash();
+    }
+
+    EXPECT_EQ(Segments(hash), 3u);
+
+    // NOTE no segment holds more than the limit
+    for (auto segment = Segment(hash); segment;) {
+        EXPECT_LE(
+            static_cast<std::size_t>(segment->spent_size()),
+            SpentTokens::segment_limit_);
+
+        if (segment->previous().empty()) { break; }
+
+        segment = Segment(segment->previous());
+    }
+
+    const auto tokens = Load(hash);
+
+    EXPECT_EQ(tokens->Hash(), hash);
+
+    for (const auto& token : spent) { EXPECT_TRUE(tokens->Check(token)); }
+
+    EXPECT_FALSE(tokens->Check(Token()));
+}
+
+TEST_F(Test_SpentTokens, migrate_legacy_list)
+{
+    auto legacy = ot::proto::SpentTokenList{};
+    legacy.set_version(1);
+    legacy.set_notary(notary_->str());
+    legacy.set_unit(unit_->str());
+    legacy.set_series(series_);
+
+    for (auto i = std::size_t{0}; i < SpentTokens::segment_limit_; ++i) {
+        legacy.add_spent(Token());
+    }
+
+    auto hash = ot::UnallocatedCString{};
+
+    ASSERT_TRUE(driver_.StoreProto(legacy, hash));
+
+    const auto tokens = Load(hash);
+
+    for (const auto& token : legacy.spent()) {
+        EXPECT_TRUE(tokens->Check(token));
+    }
+
+    // NOTE the full legacy list is sealed and linked from the new tail
+    const auto token = Token();
+
+    EXPECT_TRUE(tokens->Mark(token));
+
+    const auto tail = Segment(tokens->Hash());
+
+    ASSERT_TRUE(tail);
+    EXPECT_EQ(tail->version(), 2u);
+    EXPECT_EQ(tail->previous(), hash);
+    EXPECT_EQ(tail->spent_size(), 1);
+
+    const auto reloaded = Load(tokens->Hash());
+
+    EXPECT_TRUE(reloaded->Check(token));
+    EXPECT_TRUE(reloaded->Check(legacy.spent(0)));
+}
+
+TEST_F(Test_SpentTokens, missing_list)
+{
+    EXPECT_THROW(Load(Token()), std::runtime_error);
+}
+
+TEST_F(Test_SpentTokens, storage)
+{
+    const auto& storage = api_.Storage();
+    const auto token = Token();
+
+    EXPECT_FALSE(storage.CheckTokenSpent(notary_, unit_, series_, token));
+    EXPECT_TRUE(storage.MarkTokenSpent(notary_, unit_, series_, token));
+    EXPECT_TRUE(storage.CheckTokenSpent(notary_, unit_, series_, token));
+    EXPECT_TRUE(storage.MarkTokenSpent(notary_, unit_, series_, token));
+    EXPECT_FALSE(storage.CheckTokenSpent(notary_, unit_, series_ + 1, token));
+    EXPECT_FALSE(storage.MarkTokenSpent(notary_, unit_, series_, ""));
+    EXPECT_THROW(
+        storage.CheckTokenSpent(notary_, unit_, series_, ""),
+        std::runtime_error);
+}
+}  // namespace ottest
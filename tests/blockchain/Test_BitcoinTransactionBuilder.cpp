@@ -0,0 +1,246 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "blockchain/node/wallet/spend/BitcoinTransactionBuilder.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/crypto/Blockchain.hpp"
+#include "opentxs/api/crypto/Seed.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/api/session/Wallet.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Script.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/crypto/Account.hpp"
+#include "opentxs/blockchain/crypto/Element.hpp"
+#include "opentxs/blockchain/crypto/HD.hpp"
+#include "opentxs/blockchain/crypto/HDProtocol.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/crypto/Language.hpp"
+#include "opentxs/crypto/Parameters.hpp"  // IWYU pragma: keep
+#include "opentxs/crypto/SeedStyle.hpp"
+#include "opentxs/crypto/key/EllipticCurve.hpp"  // IWYU pragma: keep
+#include "opentxs/identity/Nym.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/PasswordPrompt.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "paymentcode/VectorsV3.hpp"
+#include "serialization/protobuf/BlockchainTransactionProposal.pb.h"
+#include "serialization/protobuf/BlockchainTransactionProposedOutput.pb.h"
+
+namespace ottest
+{
+using Builder = ot::blockchain::node::wallet::BitcoinTransactionBuilder;
+
+ot::Nym_p nym_{};
+ot::UnallocatedVector<Builder::UTXO> legacy_{};
+ot::UnallocatedVector<Builder::UTXO> mixed_{};
+
+class Test_BitcoinTransactionBuilder : public ::testing::Test
+{
+public:
+    static constexpr auto chain_{ot::blockchain::Type::UnitTest};
+    static constexpr auto inputs_{std::size_t{24}};
+    static constexpr auto value_{std::int64_t{100000000}};
+
+    const ot::api::session::Client& api_;
+    const ot::OTPasswordPrompt reason_;
+    const ot::blockchain::crypto::HD& account_;
+    const Builder::Proposal proposal_;
+
+    // Signs a transaction spending the specified outputs and returns its
+    // serialized form
+    auto Sign(
+        const ot::UnallocatedVector<Builder::UTXO>& utxos,
+        const bool parallel) const noexcept -> ot::Space
+    {
+        const auto id = api_.Factory().Identifier(proposal_.id());
+        auto builder =
+            Builder{api_, id, proposal_, chain_, ot::Amount{value_ / 1000}};
+        auto output = ot::Space{};
+
+        if (false == builder.CreateOutputs(proposal_)) { return {}; }
+
+        for (const auto& utxo : utxos) {
+            if (false == builder.AddInput(utxo)) { return {}; }
+        }
+
+        if (false == builder.SignInputs(parallel)) { return {}; }
+
+        const auto pTX = builder.FinalizeTransaction();
+
+        if (false == bool(pTX)) { return {}; }
+
+        if (false == pTX->Serialize(ot::writer(output)).has_value()) {
+            return {};
+        }
+
+        return output;
+    }
+
+    Test_BitcoinTransactionBuilder()
+        : api_(ot::Context().StartClientSession(0))
+        , reason_(api_.Factory().PasswordPrompt(__func__))
+        , account_([&]() -> const ot::blockchain::crypto::HD& {
+            if (!nym_) {
+                const auto words =
+                    api_.Factory().SecretFromText(GetVectors3().alice_.words_);
+                const auto phrase = api_.Factory().Secret(0);
+                const auto seed = api_.Crypto().Seed().ImportSeed(
+                    words,
+                    phrase,
+                    ot::crypto::SeedStyle::BIP39,
+                    ot::crypto::Language::en,
+                    reason_);
+                nym_ = api_.Wallet().Nym({seed, 0}, reason_, "Alice");
+
+                OT_ASSERT(nym_);
+
+                api_.Crypto().Blockchain().NewHDSubaccount(
+                    nym_->ID(),
+                    ot::blockchain::crypto::HDProtocol::BIP_44,
+                    chain_,
+                    reason_);
+            }
+
+            return api_.Crypto()
+                .Blockchain()
+                .Account(nym_->ID(), chain_)
+                .GetHD()
+                .at(0);
+        }())
+        , proposal_([&] {
+            auto out = Builder::Proposal{};
+            const auto id = [&] {
+                auto out = api_.Factory().Identifier();
+                out->Randomize();
+
+                return out;
+            }();
+            const auto& sender = nym_->ID();
+            out.set_version(1);
+            out.set_id(id->str());
+            out.set_initiator(sender.data(), sender.size());
+            auto& output = *out.add_output();
+            output.set_version(1);
+            ot::Amount{value_}.Serialize(ot::writer(output.mutable_amount()));
+            const auto& element = account_.BalanceElement(
+                ot::blockchain::crypto::Subchain::Internal, 0);
+            output.set_pubkeyhash(element.PubkeyHash()->str());
+
+            return out;
+        }())
+    {
+        if (legacy_.empty()) {
+            legacy_ = Generate(false);
+            mixed_ = Generate(true);
+        }
+    }
+
+private:
+    // Creates outputs paying to the test account. If segwit is true every
+    // second output is P2WPKH.
+    auto Generate(const bool segwit) const noexcept
+        -> ot::UnallocatedVector<Builder::UTXO>
+    {
+        using OutputBuilder = ot::api::session::Factory::OutputBuilder;
+        using Subchain = ot::blockchain::crypto::Subchain;
+        auto outputs = ot::UnallocatedVector<OutputBuilder>{};
+
+        for (auto i = std::size_t{0}; i < inputs_; ++i) {
+            const auto index = account_.Reserve(Subchain::External, reason_);
+
+            OT_ASSERT(index.has_value());
+
+            const auto& element =
+                account_.BalanceElement(Subchain::External, index.value());
+            const auto key = element.Key();
+
+            OT_ASSERT(key);
+
+            auto script = (segwit && (1u == (i % 2u)))
+                              ? api_.Factory().BitcoinScriptP2WPKH(chain_, *key)
+                              : api_.Factory().BitcoinScriptP2PKH(chain_, *key);
+            outputs.emplace_back(
+                ot::blockchain::Amount{value_},
+                std::move(script),
+                ot::UnallocatedSet<ot::blockchain::crypto::Key>{
+                    element.KeyID()});
+        }
+
+        const auto pTX = api_.Factory().BitcoinGenerationTransaction(
+            chain_, segwit ? 2 : 1, std::move(outputs));
+
+        OT_ASSERT(pTX);
+
+        const auto& tx = *pTX;
+        auto out = ot::UnallocatedVector<Builder::UTXO>{};
+
+        for (auto i = std::uint32_t{0}; i < tx.Outputs().size(); ++i) {
+            out.emplace_back(
+                ot::blockchain::block::Outpoint{tx.ID().Bytes(), i},
+                tx.Outputs().at(i).Internal().clone());
+        }
+
+        return out;
+    }
+};
+
+TEST_F(Test_BitcoinTransactionBuilder, init)
+{
+    EXPECT_EQ(legacy_.size(), inputs_);
+    EXPECT_EQ(mixed_.size(), inputs_);
+}
+
+TEST_F(Test_BitcoinTransactionBuilder, legacy_inputs)
+{
+    const auto serial = Sign(legacy_, false);
+    const auto parallel = Sign(legacy_, true);
+
+    ASSERT_FALSE(serial.empty());
+    EXPECT_EQ(serial, parallel);
+}
+
+TEST_F(Test_BitcoinTransactionBuilder, segwit_inputs)
+{
+    const auto serial = Sign(mixed_, false);
+    const auto parallel = Sign(mixed_, true);
+
+    ASSERT_FALSE(serial.empty());
+    EXPECT_EQ(serial, parallel);
+}
+
+TEST_F(Test_BitcoinTransactionBuilder, repeatable)
+{
+    EXPECT_EQ(Sign(mixed_, true), Sign(mixed_, true));
+}
+
+TEST_F(Test_BitcoinTransactionBuilder, cleanup)
+{
+    mixed_.clear();
+    legacy_.clear();
+    nym_.reset();
+}
+}  // namespace ottest
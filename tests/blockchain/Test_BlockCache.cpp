@@ -0,0 +1,250 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <thread>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Helpers.hpp"
+#include "blockchain/node/blockoracle/BlockCache.hpp"
+#include "internal/api/network/Blockchain.hpp"
+#include "internal/blockchain/block/Block.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/network/Blockchain.hpp"
+#include "opentxs/api/network/Network.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Options.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+using namespace std::literals::chrono_literals;
+using BlockCache = ot::blockchain::node::blockoracle::BlockCache;
+
+class Test_BlockCache : public ::testing::Test
+{
+public:
+    static constexpr auto chain_{ot::blockchain::Type::UnitTest};
+
+    const ot::api::session::Client& api_;
+    const BlockCache::BitcoinBlock_p block_;
+    const std::size_t size_;
+
+    // NOTE the cache is keyed by hash so the same block may be stored under
+    // several arbitrary hashes
+    static auto Hash(const char value) noexcept -> ot::blockchain::block::Hash
+    {
+        auto bytes = std::array<char, 32>{};
+        bytes.fill(value);
+
+        return ot::blockchain::block::Hash{
+            ot::ReadView{bytes.data(), bytes.size()}};
+    }
+
+    auto Future() const noexcept -> BlockCache::BitcoinBlockFuture
+    {
+        auto promise = BlockCache::Promise{};
+        promise.set_value(block_);
+
+        return promise.get_future();
+    }
+
+    Test_BlockCache()
+        : api_(ot::Context().StartClientSession(
+              ot::Options{}.SetBlockchainWalletEnabled(false),
+              0))
+        , block_([&] {
+            const auto& hex = genesis_block_data_.at(chain_).genesis_block_hex_;
+            const auto bytes = api_.Factory().DataFromHex(hex);
+
+            return api_.Factory().BitcoinBlock(chain_, bytes->Bytes());
+        }())
+        , size_(block_ ? block_->Internal().CalculateSize() : 0u)
+    {
+    }
+};
+
+TEST_F(Test_BlockCache, init)
+{
+    ASSERT_TRUE(block_);
+    EXPECT_GT(size_, 0u);
+}
+
+TEST_F(Test_BlockCache, owned_by_session)
+{
+    const auto& other = ot::Context().StartClientSession(
+        ot::Options{}.SetBlockchainWalletEnabled(false), 1);
+    const auto& cache = api_.Network().Blockchain().Internal().BlockCache();
+
+    EXPECT_EQ(&cache, &api_.Network().Blockchain().Internal().BlockCache());
+    EXPECT_NE(&cache, &other.Network().Blockchain().Internal().BlockCache());
+}
+
+TEST_F(Test_BlockCache, hits_and_misses)
+{
+    const auto cache = BlockCache{};
+
+    EXPECT_FALSE(cache.Find(chain_, Hash(1)).valid());
+
+    cache.Push(chain_, Hash(1), Future());
+    const auto future = cache.Find(chain_, Hash(1));
+
+    ASSERT_TRUE(future.valid());
+    EXPECT_EQ(future.get(), block_);
+    EXPECT_FALSE(cache.Find(ot::blockchain::Type::Bitcoin, Hash(1)).valid());
+
+    const auto stats = cache.Stats();
+
+    EXPECT_EQ(stats.items_, 1u);
+    EXPECT_EQ(stats.serialized_bytes_, size_);
+    EXPECT_EQ(stats.hits_, 1u);
+    EXPECT_EQ(stats.misses_, 2u);
+}
+
+TEST_F(Test_BlockCache, eviction)
+{
+    const auto cache = BlockCache{3u * size_};
+    cache.Push(chain_, Hash(1), Future());
+    cache.Push(chain_, Hash(2), Future());
+    cache.Push(chain_, Hash(3), Future());
+
+    EXPECT_EQ(cache.Stats().items_, 3u);
+
+    cache.Push(chain_, Hash(4), Future());
+
+    EXPECT_EQ(cache.Stats().items_, 3u);
+    EXPECT_EQ(cache.Stats().serialized_bytes_, 3u * size_);
+    EXPECT_FALSE(cache.Find(chain_, Hash(1)).valid());
+    EXPECT_TRUE(cache.Find(chain_, Hash(2)).valid());
+    EXPECT_TRUE(cache.Find(chain_, Hash(3)).valid());
+
+    // NOTE blocks which have been hit twice survive a scan
+    cache.Push(chain_, Hash(5), Future());
+    cache.Push(chain_, Hash(6), Future());
+
+    EXPECT_EQ(cache.Stats().items_, 3u);
+    EXPECT_TRUE(cache.Find(chain_, Hash(2)).valid());
+    EXPECT_TRUE(cache.Find(chain_, Hash(3)).valid());
+    EXPECT_FALSE(cache.Find(chain_, Hash(4)).valid());
+    EXPECT_FALSE(cache.Find(chain_, Hash(5)).valid());
+    EXPECT_TRUE(cache.Find(chain_, Hash(6)).valid());
+}
+
+TEST_F(Test_BlockCache, coalesce_loads)
+{
+    const auto cache = BlockCache{};
+    const auto [first, load1] = cache.StartLoad(chain_, Hash(1));
+    const auto [second, load2] = cache.StartLoad(chain_, Hash(1));
+
+    EXPECT_TRUE(load1);
+    EXPECT_FALSE(load2);
+    EXPECT_EQ(second.wait_for(0s), std::future_status::timeout);
+    EXPECT_FALSE(cache.Find(chain_, Hash(1)).valid());
+    EXPECT_FALSE(cache.FinishLoad(chain_, Hash(1), block_).has_value());
+    EXPECT_EQ(first.get(), block_);
+    EXPECT_EQ(second.get(), block_);
+    EXPECT_TRUE(cache.Find(chain_, Hash(1)).valid());
+
+    const auto [third, load3] = cache.StartLoad(chain_, Hash(1));
+
+    EXPECT_FALSE(load3);
+    EXPECT_EQ(third.get(), block_);
+}
+
+TEST_F(Test_BlockCache, coalesce_concurrent_loads)
+{
+    constexpr auto threads = std::size_t{8};
+    const auto cache = BlockCache{};
+    const auto hash = Hash(1);
+    auto started = std::atomic<std::size_t>{0};
+    auto loads = std::atomic<std::size_t>{0};
+    auto go = std::promise<void>{};
+    const auto ready = go.get_future().share();
+    auto results =
+        ot::UnallocatedVector<std::future<BlockCache::BitcoinBlock_p>>{};
+
+    for (auto i = std::size_t{0}; i < threads; ++i) {
+        results.emplace_back(std::async(std::launch::async, [&] {
+            ready.wait();
+            auto [future, loader] = cache.StartLoad(chain_, hash);
+            ++started;
+
+            if (loader) {
+                ++loads;
+
+                // NOTE every thread must request the block before it arrives
+                while (started < threads) { std::this_thread::yield(); }
+
+                cache.FinishLoad(chain_, hash, block_);
+            }
+
+            return future.get();
+        }));
+    }
+
+    go.set_value();
+
+    for (auto& result : results) { EXPECT_EQ(result.get(), block_); }
+
+    EXPECT_EQ(loads, 1u);
+    EXPECT_EQ(cache.Stats().items_, 1u);
+}
+
+TEST_F(Test_BlockCache, missing_block)
+{
+    const auto cache = BlockCache{};
+    const auto [first, load1] = cache.StartLoad(chain_, Hash(1));
+    const auto [second, load2] = cache.StartLoad(chain_, Hash(1));
+
+    ASSERT_TRUE(load1);
+    ASSERT_FALSE(load2);
+
+    auto missing = cache.FinishLoad(chain_, Hash(1), nullptr);
+
+    ASSERT_TRUE(missing.has_value());
+    EXPECT_EQ(second.wait_for(0s), std::future_status::timeout);
+    EXPECT_FALSE(cache.Find(chain_, Hash(1)).valid());
+
+    // NOTE the caller downloads the block and resolves the same promise
+    missing->first.set_value(block_);
+
+    EXPECT_EQ(first.get(), block_);
+    EXPECT_EQ(second.get(), block_);
+    EXPECT_TRUE(cache.StartLoad(chain_, Hash(1)).second);
+}
+
+TEST_F(Test_BlockCache, clear)
+{
+    constexpr auto other = ot::blockchain::Type::Bitcoin;
+    const auto cache = BlockCache{};
+    cache.Push(chain_, Hash(1), Future());
+    cache.Push(other, Hash(1), Future());
+    const auto [future, load] = cache.StartLoad(chain_, Hash(2));
+
+    ASSERT_TRUE(load);
+
+    cache.Clear(chain_);
+
+    EXPECT_FALSE(future.get());
+    EXPECT_FALSE(cache.FinishLoad(chain_, Hash(2), block_).has_value());
+    EXPECT_FALSE(cache.Find(chain_, Hash(1)).valid());
+    EXPECT_FALSE(cache.Find(chain_, Hash(2)).valid());
+    EXPECT_TRUE(cache.Find(other, Hash(1)).valid());
+    EXPECT_EQ(cache.Stats().items_, 1u);
+}
+}  // namespace ottest
@@ -0,0 +1,205 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <cstring>
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "blockchain/database/common/BlockFilter.hpp"
+#include "blockchain/database/common/Bulk.hpp"
+#include "internal/blockchain/Blockchain.hpp"
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "internal/blockchain/database/common/Common.hpp"
+#include "internal/util/Mutex.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/FilterType.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/Hash.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/node/HeaderOracle.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace ottest
+{
+namespace common = ot::blockchain::database::common;
+
+using LMDB = ot::storage::lmdb::LMDB;
+
+class Test_BlockFilter : public ::testing::Test
+{
+public:
+    static constexpr auto type_{ot::blockchain::cfilter::Type::Basic_BIP158};
+    static constexpr auto table_{common::Table::FilterIndexBasic};
+
+    const ot::api::session::Client& api_;
+    const fs::path folder_;
+    LMDB lmdb_;
+    const ot::blockchain::block::Hash& block_;
+    const ot::blockchain::GCS filter_;
+
+    auto LoadIndex(const ot::ReadView key) const noexcept
+        -> ot::util::IndexData
+    {
+        auto output = ot::util::IndexData{};
+        lmdb_.Load(table_, key, [&](const auto bytes) {
+            if (sizeof(output) <= bytes.size()) {
+                std::memcpy(&output, bytes.data(), sizeof(output));
+            }
+        });
+
+        return output;
+    }
+    // Stores a filter in the proto::GCS layout used before raw records
+    auto WriteLegacy(
+        const common::Bulk& bulk,
+        const ot::ReadView key,
+        const ot::blockchain::GCS& filter) const noexcept -> bool
+    {
+        auto bytes = ot::Space{};
+
+        if (false == filter.Serialize(ot::writer(bytes))) { return false; }
+
+        auto index = ot::util::IndexData{};
+        auto tx = lmdb_.TransactionRW();
+        auto view = bulk.WriteView(tx, index, {}, bytes.size());
+
+        if (false == view.valid(bytes.size())) { return false; }
+
+        std::memcpy(view.data(), bytes.data(), bytes.size());
+        const auto stored = lmdb_.Store(
+            table_,
+            key,
+            ot::ReadView{reinterpret_cast<const char*>(&index), sizeof(index)},
+            tx);
+
+        if (false == stored.first) { return false; }
+
+        return tx.Finalize(true);
+    }
+
+    Test_BlockFilter()
+        : api_(ot::Context().StartClientSession(0))
+        , folder_([] {
+            auto path = fs::temp_directory_path() /
+                        fs::unique_path("opentxs-cfilter-%%%%-%%%%-%%%%-%%%%");
+            fs::create_directories(path);
+
+            return path;
+        }())
+        , lmdb_(
+              {
+                  {common::Table::Config, "config"},
+                  {common::Table::BlockIndex, "blocks"},
+                  {common::Table::HeaderIndex, "block_headers_2"},
+                  {common::Table::FilterHeadersBasic,
+                   "block_filter_headers_basic"},
+                  {common::Table::FilterHeadersBCH, "block_filter_headers_bch"},
+                  {common::Table::FilterHeadersOpentxs,
+                   "block_filter_headers_opentxs"},
+                  {common::Table::FilterIndexBasic, "block_filters_basic_2"},
+                  {common::Table::FilterIndexBCH, "block_filters_bch_2"},
+                  {common::Table::FilterIndexES, "block_filters_opentxs_2"},
+                  {common::Table::TransactionIndex, "transactions"},
+                  {common::Table::BulkFreeSpace, "bulk_free_space"},
+              },
+              folder_.string(),
+              {
+                  {common::Table::Config, MDB_INTEGERKEY},
+                  {common::Table::BlockIndex, 0},
+                  {common::Table::HeaderIndex, 0},
+                  {common::Table::FilterHeadersBasic, 0},
+                  {common::Table::FilterHeadersBCH, 0},
+                  {common::Table::FilterHeadersOpentxs, 0},
+                  {common::Table::FilterIndexBasic, 0},
+                  {common::Table::FilterIndexBCH, 0},
+                  {common::Table::FilterIndexES, 0},
+                  {common::Table::TransactionIndex, 0},
+                  {common::Table::BulkFreeSpace, MDB_DUPSORT | MDB_INTEGERKEY},
+              })
+        , block_(ot::blockchain::node::HeaderOracle::GenesisBlockHash(
+              ot::blockchain::Type::Bitcoin_testnet3))
+        , filter_([&] {
+            const auto params =
+                ot::blockchain::internal::GetFilterParams(type_);
+            const auto encoded = api_.Factory().DataFromHex("0x9dfca8");
+
+            return ot::factory::GCS(
+                api_,
+                params.first,
+                params.second,
+                ot::blockchain::internal::BlockHashToFilterKey(block_.Bytes()),
+                1,
+                encoded->Bytes(),
+                {});
+        }())
+    {
+    }
+
+    ~Test_BlockFilter() override
+    {
+        auto ec = boost::system::error_code{};
+        fs::remove_all(folder_, ec);
+    }
+};
+
+TEST_F(Test_BlockFilter, migrate_legacy_record)
+{
+    ASSERT_TRUE(filter_.IsValid());
+
+    auto bulk = common::Bulk{lmdb_, folder_.string()};
+
+    ASSERT_TRUE(WriteLegacy(bulk, block_.Bytes(), filter_));
+
+    const auto legacy = LoadIndex(block_.Bytes());
+
+    // NOTE the format version has not been recorded yet so the constructor
+    // converts every existing record
+    const auto filters = common::BlockFilter{api_, lmdb_, bulk};
+    const auto index = LoadIndex(block_.Bytes());
+
+    EXPECT_EQ(index.position_, legacy.position_);
+    EXPECT_LT(index.size_, legacy.size_);
+
+    const auto epoch = bulk.BeginRead();
+    auto lock = ot::Lock{bulk.Mutex()};
+    const auto record = bulk.ReadView(epoch, lock, index);
+
+    ASSERT_LE(2u, record.size());
+    EXPECT_EQ(record[0], '\x00');
+    EXPECT_EQ(record[1], '\x01');
+
+    EXPECT_TRUE(filters.HaveFilter(type_, block_.Bytes()));
+
+    const auto loaded = filters.LoadFilter(type_, block_.Bytes(), {});
+
+    ASSERT_TRUE(loaded.IsValid());
+    EXPECT_EQ(loaded.ElementCount(), filter_.ElementCount());
+    EXPECT_EQ(loaded.Hash(), filter_.Hash());
+
+    const auto batch = filters.LoadFilters(
+        type_, ot::Vector<ot::blockchain::block::Hash>{block_});
+
+    ASSERT_EQ(batch.size(), 1u);
+    EXPECT_EQ(batch.front().Hash(), filter_.Hash());
+}
+}  // namespace ottest
@@ -0,0 +1,340 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "blockchain/database/common/Bulk.hpp"
+#include "internal/blockchain/database/common/Common.hpp"
+#include "internal/util/Mutex.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace ottest
+{
+namespace common = ot::blockchain::database::common;
+
+using LMDB = ot::storage::lmdb::LMDB;
+
+class Test_BulkStorage : public ::testing::Test
+{
+public:
+    static constexpr auto table_{common::Table::BlockIndex};
+
+    const fs::path folder_;
+    LMDB lmdb_;
+
+    // Waits long enough for space released by a previous Bulk instance to be
+    // considered released before the next instance started
+    static auto Restart() noexcept -> void
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1100});
+    }
+
+    auto Contains(
+        const common::Bulk& bulk,
+        const ot::util::IndexData& index,
+        const char fill) const noexcept -> bool
+    {
+        const auto epoch = bulk.BeginRead();
+        auto lock = ot::Lock{bulk.Mutex()};
+        const auto view = bulk.ReadView(epoch, lock, index);
+
+        if (view.size() != index.size_) { return false; }
+
+        for (const auto c : view) {
+            if (c != fill) { return false; }
+        }
+
+        return true;
+    }
+    auto LoadIndex(const ot::ReadView key) const noexcept
+        -> ot::util::IndexData
+    {
+        auto output = ot::util::IndexData{};
+        lmdb_.Load(table_, key, [&](const auto bytes) {
+            if (sizeof(output) <= bytes.size()) {
+                std::memcpy(&output, bytes.data(), sizeof(output));
+            }
+        });
+
+        return output;
+    }
+    auto Write(
+        const common::Bulk& bulk,
+        ot::util::IndexData& index,
+        const char fill,
+        const std::size_t size,
+        const bool commit = true) const noexcept -> bool
+    {
+        auto tx = lmdb_.TransactionRW();
+        auto view = bulk.WriteView(tx, index, {}, size);
+
+        if (false == view.valid(size)) { return false; }
+
+        std::memset(view.data(), fill, size);
+
+        return tx.Finalize(commit);
+    }
+    auto Write(
+        const common::Bulk& bulk,
+        const ot::ReadView key,
+        const char fill,
+        const std::size_t size) const noexcept -> bool
+    {
+        auto index = LoadIndex(key);
+
+        if (false == Write(bulk, index, fill, size)) { return false; }
+
+        return lmdb_
+            .Store(
+                table_,
+                key,
+                ot::ReadView{
+                    reinterpret_cast<const char*>(&index), sizeof(index)})
+            .first;
+    }
+
+    Test_BulkStorage()
+        : folder_([] {
+            auto path = fs::temp_directory_path() /
+                        fs::unique_path("opentxs-bulk-%%%%-%%%%-%%%%-%%%%");
+            fs::create_directories(path);
+
+            return path;
+        }())
+        , lmdb_(
+              {
+                  {common::Table::Config, "config"},
+                  {common::Table::BlockIndex, "blocks"},
+                  {common::Table::HeaderIndex, "block_headers_2"},
+                  {common::Table::FilterIndexBasic, "block_filters_basic_2"},
+                  {common::Table::FilterIndexBCH, "block_filters_bch_2"},
+                  {common::Table::FilterIndexES, "block_filters_opentxs_2"},
+                  {common::Table::TransactionIndex, "transactions"},
+                  {common::Table::BulkFreeSpace, "bulk_free_space"},
+              },
+              folder_.string(),
+              {
+                  {common::Table::Config, MDB_INTEGERKEY},
+                  {common::Table::BlockIndex, 0},
+                  {common::Table::HeaderIndex, 0},
+                  {common::Table::FilterIndexBasic, 0},
+                  {common::Table::FilterIndexBCH, 0},
+                  {common::Table::FilterIndexES, 0},
+                  {common::Table::TransactionIndex, 0},
+                  {common::Table::BulkFreeSpace, MDB_DUPSORT | MDB_INTEGERKEY},
+              })
+    {
+    }
+
+    ~Test_BulkStorage() override
+    {
+        auto ec = boost::system::error_code{};
+        fs::remove_all(folder_, ec);
+    }
+};
+
+TEST_F(Test_BulkStorage, aborted_replacement_does_not_release_space)
+{
+    const auto bulk = common::Bulk{lmdb_, folder_.string()};
+    auto original = ot::util::IndexData{};
+
+    ASSERT_TRUE(Write(bulk, original, 'a', 100));
+
+    {
+        auto index = original;
+
+        ASSERT_TRUE(Write(bulk, index, 'b', 200, false));
+        EXPECT_NE(index.position_, original.position_);
+    }
+
+    auto index = original;
+
+    ASSERT_TRUE(Write(bulk, index, 'c', 100));
+    EXPECT_EQ(index.position_, original.position_);
+    EXPECT_TRUE(Contains(bulk, index, 'c'));
+}
+
+TEST_F(Test_BulkStorage, free_extent_not_reused_while_read)
+{
+    const auto bulk = common::Bulk{lmdb_, folder_.string()};
+    auto first = ot::util::IndexData{};
+
+    ASSERT_TRUE(Write(bulk, first, 'a', 1000));
+
+    const auto released = first;
+    auto second = ot::util::IndexData{};
+
+    {
+        // NOTE a reader registered before the release may still hold the
+        // original index
+        const auto epoch = bulk.BeginRead();
+
+        ASSERT_TRUE(Write(bulk, first, 'b', 2000));
+        EXPECT_NE(first.position_, released.position_);
+
+        {
+            // NOTE a reader registered after the release does not delay reuse
+            const auto later = bulk.BeginRead();
+
+            ASSERT_TRUE(Write(bulk, second, 'c', 500));
+            EXPECT_NE(second.position_, released.position_);
+        }
+
+        auto lock = ot::Lock{bulk.Mutex()};
+        const auto view = bulk.ReadView(epoch, lock, released);
+
+        ASSERT_EQ(view.size(), released.size_);
+        EXPECT_EQ(view.front(), 'a');
+        EXPECT_EQ(view.back(), 'a');
+    }
+
+    auto third = ot::util::IndexData{};
+
+    ASSERT_TRUE(Write(bulk, third, 'd', 500));
+    EXPECT_EQ(third.position_, released.position_);
+    EXPECT_TRUE(Contains(bulk, first, 'b'));
+    EXPECT_TRUE(Contains(bulk, second, 'c'));
+    EXPECT_TRUE(Contains(bulk, third, 'd'));
+}
+
+TEST_F(Test_BulkStorage, free_extent_reused_after_commit)
+{
+    const auto bulk = common::Bulk{lmdb_, folder_.string()};
+    auto first = ot::util::IndexData{};
+
+    ASSERT_TRUE(Write(bulk, first, 'a', 1000));
+
+    const auto released = first;
+
+    ASSERT_TRUE(Write(bulk, first, 'b', 2000));
+
+    auto second = ot::util::IndexData{};
+
+    ASSERT_TRUE(Write(bulk, second, 'c', 500));
+    EXPECT_EQ(second.position_, released.position_);
+
+    // NOTE the remainder of the extent is subject to the same readers
+    auto third = ot::util::IndexData{};
+
+    ASSERT_TRUE(Write(bulk, third, 'd', 500));
+    EXPECT_EQ(third.position_, released.position_ + 500u);
+    EXPECT_TRUE(Contains(bulk, first, 'b'));
+    EXPECT_TRUE(Contains(bulk, second, 'c'));
+    EXPECT_TRUE(Contains(bulk, third, 'd'));
+}
+
+TEST_F(Test_BulkStorage, free_extent_reused_after_restart)
+{
+    auto released = ot::util::IndexData{};
+
+    {
+        const auto bulk = common::Bulk{lmdb_, folder_.string()};
+        auto index = ot::util::IndexData{};
+
+        ASSERT_TRUE(Write(bulk, index, 'a', 1000));
+
+        released = index;
+
+        ASSERT_TRUE(Write(bulk, index, 'b', 2000));
+    }
+
+    Restart();
+
+    const auto bulk = common::Bulk{lmdb_, folder_.string()};
+    auto first = ot::util::IndexData{};
+    auto second = ot::util::IndexData{};
+
+    ASSERT_TRUE(Write(bulk, first, 'c', 500));
+    EXPECT_EQ(first.position_, released.position_);
+    EXPECT_TRUE(Contains(bulk, first, 'c'));
+
+    // NOTE the remainder of the extent is still available
+    ASSERT_TRUE(Write(bulk, second, 'd', 500));
+    EXPECT_EQ(second.position_, released.position_ + 500u);
+    EXPECT_TRUE(Contains(bulk, second, 'd'));
+}
+
+TEST_F(Test_BulkStorage, compaction)
+{
+    auto released = ot::util::IndexData{};
+
+    {
+        const auto bulk = common::Bulk{lmdb_, folder_.string()};
+
+        ASSERT_TRUE(Write(bulk, "a", 'a', 1000));
+        ASSERT_TRUE(Write(bulk, "b", 'b', 1000));
+        ASSERT_TRUE(Write(bulk, "c", 'c', 1000));
+
+        released = LoadIndex("a");
+
+        ASSERT_TRUE(Write(bulk, "a", 'A', 2000));
+    }
+
+    Restart();
+
+    const auto bulk = common::Bulk{lmdb_, folder_.string()};
+    auto epoch = std::make_unique<ot::util::ReadEpoch>(bulk.BeginRead());
+    const auto before = LoadIndex("b");
+    auto moved = std::size_t{0};
+    auto batches = std::size_t{0};
+
+    for (auto finished{false}; false == finished; ++batches) {
+        ASSERT_LT(batches, 100u);
+
+        const auto [count, done] = bulk.Compact(1u);
+        moved += count;
+        finished = done;
+    }
+
+    EXPECT_EQ(moved, 1u);
+    // NOTE one batch per item and per empty index table
+    EXPECT_GT(batches, 3u);
+
+    const auto after = LoadIndex("b");
+
+    EXPECT_EQ(after.position_, released.position_);
+    EXPECT_LT(after.position_, before.position_);
+    EXPECT_TRUE(Contains(bulk, after, 'b'));
+    EXPECT_TRUE(Contains(bulk, LoadIndex("a"), 'A'));
+    EXPECT_TRUE(Contains(bulk, LoadIndex("c"), 'c'));
+
+    {
+        // NOTE space vacated by compaction is not reused while a reader which
+        // may hold the original index exists
+        const auto [count, done] = bulk.Compact(1000u);
+
+        EXPECT_EQ(count, 0u);
+        EXPECT_TRUE(done);
+    }
+
+    epoch.reset();
+
+    {
+        const auto [count, done] = bulk.Compact(1000u);
+
+        EXPECT_EQ(count, 1u);
+        EXPECT_TRUE(done);
+    }
+
+    EXPECT_EQ(LoadIndex("c").position_, before.position_);
+    EXPECT_TRUE(Contains(bulk, LoadIndex("c"), 'c'));
+}
+}  // namespace ottest
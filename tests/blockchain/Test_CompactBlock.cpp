@@ -0,0 +1,198 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+
+#include "bip158/Bip158.hpp"
+#include "blockchain/p2p/bitcoin/CompactBlock.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Options.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+using CompactBlock = ot::blockchain::p2p::bitcoin::CompactBlock;
+
+class Test_CompactBlock : public ::testing::Test
+{
+public:
+    static constexpr auto chain_{ot::blockchain::Type::Bitcoin_testnet3};
+    static constexpr auto nonce_{std::uint64_t{0x0123456789abcdef}};
+
+    const ot::api::session::Client& api_;
+    const std::uint64_t version_;
+
+    // The test vector block with the most transactions
+    auto Vector() const noexcept -> const Bip158Vector&
+    {
+        const auto count = [&](const auto& vector) {
+            const auto raw = vector.Block(api_);
+            const auto block =
+                api_.Factory().BitcoinBlock(chain_, raw->Bytes());
+
+            return block ? block->size() : std::size_t{0};
+        };
+
+        return *std::max_element(
+            bip_158_vectors_.begin(),
+            bip_158_vectors_.end(),
+            [&](const auto& lhs, const auto& rhs) {
+                return count(lhs) < count(rhs);
+            });
+    }
+
+    Test_CompactBlock()
+        : api_(ot::Context().StartClientSession(
+              ot::Options{}.SetBlockchainWalletEnabled(false),
+              0))
+        , version_(CompactBlock::SupportedVersion(chain_))
+    {
+    }
+};
+
+TEST_F(Test_CompactBlock, supported_version)
+{
+    EXPECT_EQ(version_, 2u);
+    EXPECT_EQ(CompactBlock::SupportedVersion(ot::blockchain::Type::PKT), 0u);
+}
+
+TEST_F(Test_CompactBlock, mempool_reconstruction)
+{
+    const auto raw = Vector().Block(api_);
+    const auto pBlock = api_.Factory().BitcoinBlock(chain_, raw->Bytes());
+
+    ASSERT_TRUE(pBlock);
+
+    const auto& block = *pBlock;
+
+    ASSERT_GT(block.size(), 2u);
+
+    auto encoded = ot::Space{};
+
+    ASSERT_TRUE(CompactBlock::Encode(
+        api_, chain_, version_, nonce_, block, ot::writer(encoded)));
+    EXPECT_LT(encoded.size(), raw->size());
+
+    auto compact = CompactBlock{api_, chain_, version_, ot::reader(encoded)};
+
+    EXPECT_EQ(compact.Hash(), block.ID());
+    EXPECT_EQ(compact.size(), block.size());
+    EXPECT_EQ(compact.Prefilled(), 1u);
+    EXPECT_FALSE(compact.IsComplete());
+    EXPECT_EQ(compact.Missing().size(), block.size() - 1u);
+
+    auto candidates = CompactBlock::Candidates{};
+
+    for (auto i = std::size_t{1}; i < block.size(); ++i) {
+        candidates.emplace_back(block.at(i));
+    }
+
+    EXPECT_EQ(compact.AddCandidates(candidates), block.size() - 1u);
+    EXPECT_TRUE(compact.IsComplete());
+    EXPECT_EQ(compact.FromCandidates(), block.size() - 1u);
+
+    auto serialized = api_.Factory().Data();
+
+    ASSERT_TRUE(compact.Serialize(serialized->WriteInto()));
+    EXPECT_EQ(serialized.get(), raw.get());
+}
+
+TEST_F(Test_CompactBlock, getblocktxn_round_trip)
+{
+    const auto raw = Vector().Block(api_);
+    const auto pBlock = api_.Factory().BitcoinBlock(chain_, raw->Bytes());
+
+    ASSERT_TRUE(pBlock);
+
+    const auto& block = *pBlock;
+    auto encoded = ot::Space{};
+
+    ASSERT_TRUE(CompactBlock::Encode(
+        api_, chain_, version_, nonce_, block, ot::writer(encoded)));
+
+    auto compact = CompactBlock{api_, chain_, version_, ot::reader(encoded)};
+    auto candidates = CompactBlock::Candidates{};
+
+    for (auto i = std::size_t{1}; i < block.size(); i += 2u) {
+        candidates.emplace_back(block.at(i));
+    }
+
+    EXPECT_EQ(compact.AddCandidates(candidates), candidates.size());
+
+    const auto missing = compact.Missing();
+
+    ASSERT_FALSE(missing.empty());
+
+    for (const auto position : missing) { EXPECT_EQ(position % 2u, 0u); }
+
+    auto blocktxn = ot::Space{};
+
+    ASSERT_TRUE(CompactBlock::EncodeTransactions(
+        block, missing, ot::writer(blocktxn)));
+
+    {
+        auto wrong = ot::Space{};
+        const auto subset = CompactBlock::Indices{missing.front()};
+
+        ASSERT_TRUE(
+            CompactBlock::EncodeTransactions(block, subset, ot::writer(wrong)));
+        EXPECT_FALSE(compact.AddTransactions(ot::reader(wrong)));
+        EXPECT_FALSE(compact.IsComplete());
+    }
+
+    EXPECT_TRUE(compact.AddTransactions(ot::reader(blocktxn)));
+    EXPECT_TRUE(compact.IsComplete());
+
+    auto serialized = api_.Factory().Data();
+
+    ASSERT_TRUE(compact.Serialize(serialized->WriteInto()));
+    EXPECT_EQ(serialized.get(), raw.get());
+}
+
+TEST_F(Test_CompactBlock, short_id_collision)
+{
+    const auto raw = Vector().Block(api_);
+    const auto pBlock = api_.Factory().BitcoinBlock(chain_, raw->Bytes());
+
+    ASSERT_TRUE(pBlock);
+
+    const auto& block = *pBlock;
+
+    ASSERT_GT(block.size(), 2u);
+    ASSERT_LT(block.size(), 254u);
+
+    auto encoded = ot::Space{};
+
+    ASSERT_TRUE(CompactBlock::Encode(
+        api_, chain_, version_, nonce_, block, ot::writer(encoded)));
+
+    // header, nonce, one byte short ID count, then the short IDs
+    constexpr auto first = std::size_t{80 + 8 + 1};
+    constexpr auto bytes = std::size_t{6};
+    std::copy(
+        std::next(encoded.begin(), first),
+        std::next(encoded.begin(), first + bytes),
+        std::next(encoded.begin(), first + bytes));
+
+    EXPECT_THROW(
+        CompactBlock(api_, chain_, version_, ot::reader(encoded)),
+        std::runtime_error);
+}
+}  // namespace ottest
@@ -0,0 +1,492 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <boost/endian/buffers.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <random>
+#include <thread>
+#include <utility>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "blockchain/node/Mempool.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/network/Network.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
+#include "opentxs/blockchain/block/bitcoin/Opcodes.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Script.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
+#include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/socket/Publish.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Options.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "opentxs/util/Time.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+namespace bb = ot::blockchain::block::bitcoin;
+namespace bi = bb::internal;
+
+class Test_Mempool : public ::testing::Test
+{
+public:
+    using Mempool = ot::blockchain::node::Mempool;
+    using Tx = std::unique_ptr<const bb::Transaction>;
+
+    static constexpr auto chain_{ot::blockchain::Type::UnitTest};
+    static constexpr auto unlimited_{std::numeric_limits<std::size_t>::max()};
+    static constexpr auto value_{std::int64_t{100000000}};
+
+    const ot::api::session::Client& api_;
+    const ot::OTZMQPublishSocket socket_;
+
+    // Memory charged for a set of transactions
+    auto Bytes(const ot::UnallocatedVector<const bb::Transaction*>& txns)
+        const noexcept -> std::size_t
+    {
+        auto mempool = Mempool{socket_, chain_, unlimited_};
+
+        for (const auto* tx : txns) { mempool.Submit(tx->clone()); }
+
+        return mempool.Bytes();
+    }
+    // Spends the first output of another transaction without associating the
+    // spent output with the input
+    auto Child(const bb::Transaction& parent, const std::int64_t fee)
+        const noexcept -> Tx
+    {
+        using CompactSize = ot::network::blockchain::bitcoin::CompactSize;
+        const auto outpoint = ot::blockchain::block::Outpoint{
+            parent.ID().Bytes(), 0};
+        const auto sequence = ot::Space(4u, std::byte{0xff});
+        auto inputs = ot::UnallocatedVector<std::unique_ptr<bi::Input>>{};
+        inputs.emplace_back(ot::factory::BitcoinTransactionInput(
+            api_,
+            chain_,
+            outpoint.Bytes(),
+            CompactSize{0},
+            {},
+            ot::reader(sequence),
+            false,
+            {}));
+        const auto& spent = parent.Outputs().at(0).Value();
+
+        return Make(std::move(inputs), {spent - ot::Amount{fee}});
+    }
+    // Spends an output from outside the mempool which is associated with the
+    // input so its value is known
+    auto Funded(const std::int64_t fee, const std::size_t count = 1)
+        const noexcept -> Tx
+    {
+        auto txid = api_.Factory().Data();
+        txid->Randomize(32u);
+        auto utxo = ot::factory::UTXO{
+            ot::blockchain::block::Outpoint{txid->Bytes(), 0},
+            Output(0, value_)};
+        auto inputs = ot::UnallocatedVector<std::unique_ptr<bi::Input>>{};
+        inputs.emplace_back(
+            ot::factory::BitcoinTransactionInput(api_, chain_, utxo));
+        const auto each = (value_ - fee) / static_cast<std::int64_t>(count);
+
+        return Make(
+            std::move(inputs), ot::UnallocatedVector<ot::Amount>(count, each));
+    }
+
+    Test_Mempool()
+        : api_(ot::Context().StartClientSession(
+              ot::Options{}.SetBlockchainWalletEnabled(false),
+              0))
+        , socket_(api_.Network().ZeroMQ().PublishSocket())
+    {
+    }
+
+private:
+    auto Make(
+        ot::UnallocatedVector<std::unique_ptr<bi::Input>>&& inputs,
+        const ot::UnallocatedVector<ot::Amount>& values) const noexcept -> Tx
+    {
+        auto outputs = ot::UnallocatedVector<std::unique_ptr<bi::Output>>{};
+
+        for (const auto& value : values) {
+            outputs.emplace_back(
+                Output(static_cast<std::uint32_t>(outputs.size()), value));
+        }
+
+        return ot::factory::BitcoinTransaction(
+            api_,
+            chain_,
+            ot::Clock::now(),
+            boost::endian::little_int32_buf_t{1},
+            boost::endian::little_uint32_buf_t{0},
+            false,
+            ot::factory::BitcoinTransactionInputs(std::move(inputs)),
+            ot::factory::BitcoinTransactionOutputs(std::move(outputs)));
+    }
+    auto Output(const std::uint32_t index, const ot::Amount& value)
+        const noexcept -> std::unique_ptr<bi::Output>
+    {
+        const auto hash = ot::Space(20u, std::byte{0x01});
+        auto elements = bb::ScriptElements{};
+        elements.emplace_back(bi::Opcode(bb::OP::DUP));
+        elements.emplace_back(bi::Opcode(bb::OP::HASH160));
+        elements.emplace_back(bi::PushData(ot::reader(hash)));
+        elements.emplace_back(bi::Opcode(bb::OP::EQUALVERIFY));
+        elements.emplace_back(bi::Opcode(bb::OP::CHECKSIG));
+
+        return ot::factory::BitcoinTransactionOutput(
+            api_,
+            chain_,
+            index,
+            value,
+            ot::factory::BitcoinScript(
+                chain_, std::move(elements), bb::Script::Position::Output),
+            {ot::blockchain::crypto::Key{
+                "mempool", ot::blockchain::crypto::Subchain::External, 0}});
+    }
+};
+
+TEST_F(Test_Mempool, fee_rate_order)
+{
+    auto mempool = Mempool{socket_, chain_, unlimited_};
+    const auto fees =
+        ot::UnallocatedVector<std::int64_t>{1000, 5000, 3000, 2000, 4000};
+    auto txids = ot::UnallocatedMap<std::int64_t, ot::UnallocatedCString>{};
+
+    for (const auto fee : fees) {
+        auto tx = Funded(fee);
+
+        ASSERT_TRUE(tx);
+
+        txids.emplace(fee, tx->ID().Bytes());
+        mempool.Submit(std::move(tx));
+    }
+
+    const auto top = mempool.Top(fees.size());
+
+    ASSERT_EQ(top.size(), fees.size());
+
+    auto expected = txids.crbegin();
+
+    for (const auto& [txid, rate] : top) {
+        EXPECT_EQ(txid, expected->second);
+        EXPECT_GT(rate, 0);
+
+        ++expected;
+    }
+
+    EXPECT_EQ(mempool.Top(2u).size(), 2u);
+}
+
+TEST_F(Test_Mempool, unknown_fee)
+{
+    auto mempool = Mempool{socket_, chain_, unlimited_};
+    const auto parent = Funded(1000);
+    auto child = Child(*parent, 1000);
+
+    ASSERT_TRUE(child);
+
+    const auto txid = ot::UnallocatedCString{child->ID().Bytes()};
+    mempool.Submit(std::move(child));
+
+    EXPECT_TRUE(mempool.Query(txid));
+    EXPECT_TRUE(mempool.Top(10u).empty());
+    EXPECT_EQ(mempool.Dump(0, 10u).first.size(), 1u);
+}
+
+TEST_F(Test_Mempool, ancestor_package)
+{
+    auto mempool = Mempool{socket_, chain_, unlimited_};
+    constexpr auto parentFee = std::int64_t{1000};
+    constexpr auto childFee = std::int64_t{100000};
+    auto parent = Funded(parentFee);
+    auto child = Child(*parent, childFee);
+    const auto parentID = ot::UnallocatedCString{parent->ID().Bytes()};
+    const auto childID = ot::UnallocatedCString{child->ID().Bytes()};
+    const auto vbytes = parent->vBytes(chain_) + child->vBytes(chain_);
+    mempool.Submit(std::move(parent));
+    mempool.Submit(std::move(child));
+    const auto top = mempool.Top(10u);
+
+    ASSERT_EQ(top.size(), 2u);
+    EXPECT_EQ(top.at(0).first, childID);
+    EXPECT_EQ(
+        top.at(0).second, ot::Amount{parentFee + childFee} * 1000 / vbytes);
+    EXPECT_EQ(top.at(1).first, parentID);
+}
+
+TEST_F(Test_Mempool, late_parent)
+{
+    auto mempool = Mempool{socket_, chain_, unlimited_};
+    constexpr auto parentFee = std::int64_t{1000};
+    constexpr auto childFee = std::int64_t{100000};
+    auto parent = Funded(parentFee);
+    auto child = Child(*parent, childFee);
+    auto grandchild = Child(*child, childFee);
+    const auto parentID = ot::UnallocatedCString{parent->ID().Bytes()};
+    const auto childID = ot::UnallocatedCString{child->ID().Bytes()};
+    const auto grandchildID = ot::UnallocatedCString{grandchild->ID().Bytes()};
+    const auto vbytes = parent->vBytes(chain_) + child->vBytes(chain_);
+    const auto total = vbytes + grandchild->vBytes(chain_);
+    const auto rate = [&](const ot::UnallocatedCString& txid) {
+        for (const auto& [id, value] : mempool.Top(10u)) {
+            if (id == txid) { return std::optional<ot::Amount>{value}; }
+        }
+
+        return std::optional<ot::Amount>{};
+    };
+    mempool.Submit(std::move(child));
+    mempool.Submit(std::move(grandchild));
+
+    // NOTE the fee of the child is unknown until the parent arrives
+    EXPECT_EQ(mempool.Top(10u).size(), 1u);
+    EXPECT_FALSE(rate(childID).has_value());
+    EXPECT_TRUE(rate(grandchildID).has_value());
+
+    mempool.Submit(std::move(parent));
+
+    EXPECT_EQ(mempool.Top(10u).size(), 3u);
+    EXPECT_EQ(mempool.Top(10u).back().first, parentID);
+    EXPECT_EQ(rate(childID), ot::Amount{parentFee + childFee} * 1000 / vbytes);
+    EXPECT_EQ(
+        rate(grandchildID),
+        ot::Amount{parentFee + 2 * childFee} * 1000 / total);
+}
+
+TEST_F(Test_Mempool, eviction_order)
+{
+    const auto fees =
+        ot::UnallocatedVector<std::int64_t>{3000, 1000, 5000, 2000, 4000};
+    auto txns = ot::UnallocatedVector<Tx>{};
+
+    for (const auto fee : fees) { txns.emplace_back(Funded(fee)); }
+
+    const auto limit =
+        Bytes({txns.at(0).get(), txns.at(2).get(), txns.at(4).get()});
+    auto mempool = Mempool{socket_, chain_, limit};
+
+    for (const auto& tx : txns) { mempool.Submit(tx->clone()); }
+
+    EXPECT_LE(mempool.Bytes(), limit);
+    EXPECT_EQ(mempool.Top(fees.size()).size(), 3u);
+
+    for (auto i = std::size_t{0}; i < fees.size(); ++i) {
+        const auto txid = txns.at(i)->ID().Bytes();
+        const auto kept = (2000 < fees.at(i));
+
+        EXPECT_EQ(bool(mempool.Query(txid)), kept);
+        // NOTE evicted transactions are remembered and not downloaded again
+        EXPECT_FALSE(mempool.Submit(txid));
+    }
+}
+
+TEST_F(Test_Mempool, eviction_keeps_paid_parent)
+{
+    auto parent = Funded(100);
+    auto child = Child(*parent, 100000);
+    auto low = Funded(2000);
+    auto medium = Funded(3000);
+    auto high = Funded(4000);
+    const auto limit = Bytes({parent.get(), child.get(), high.get()});
+    auto mempool = Mempool{socket_, chain_, limit};
+
+    for (const auto* tx :
+         {parent.get(), child.get(), low.get(), medium.get(), high.get()}) {
+        mempool.Submit(tx->clone());
+    }
+
+    EXPECT_LE(mempool.Bytes(), limit);
+    EXPECT_TRUE(mempool.Query(parent->ID().Bytes()));
+    EXPECT_TRUE(mempool.Query(child->ID().Bytes()));
+    EXPECT_FALSE(mempool.Query(low->ID().Bytes()));
+    EXPECT_FALSE(mempool.Query(medium->ID().Bytes()));
+    EXPECT_TRUE(mempool.Query(high->ID().Bytes()));
+}
+
+TEST_F(Test_Mempool, budget_under_stress)
+{
+    constexpr auto total = std::size_t{1000};
+    constexpr auto kept = std::size_t{50};
+    auto fees = ot::UnallocatedVector<std::int64_t>{};
+
+    for (auto i = std::size_t{0}; i < total; ++i) {
+        fees.emplace_back(1000 + static_cast<std::int64_t>(i) * 7);
+    }
+
+    std::shuffle(fees.begin(), fees.end(), std::mt19937{0});
+    auto txns = ot::UnallocatedMap<std::int64_t, Tx>{};
+
+    for (const auto fee : fees) { txns.emplace(fee, Funded(fee)); }
+
+    const auto limit = [&] {
+        auto out = ot::UnallocatedVector<const bb::Transaction*>{};
+
+        for (auto i = txns.cbegin(); out.size() < kept; ++i) {
+            out.emplace_back(i->second.get());
+        }
+
+        return Bytes(out);
+    }();
+    auto mempool = Mempool{socket_, chain_, limit};
+
+    for (const auto fee : fees) {
+        mempool.Submit(txns.at(fee)->clone());
+
+        ASSERT_LE(mempool.Bytes(), limit);
+    }
+
+    EXPECT_EQ(mempool.Top(total).size(), kept);
+
+    auto rank = std::size_t{0};
+
+    for (auto i = txns.crbegin(); i != txns.crend(); ++i, ++rank) {
+        const auto& [fee, tx] = *i;
+
+        EXPECT_EQ(bool(mempool.Query(tx->ID().Bytes())), rank < kept);
+    }
+}
+
+TEST_F(Test_Mempool, dump_cursor)
+{
+    auto mempool = Mempool{socket_, chain_, unlimited_};
+    auto expected = ot::UnallocatedVector<ot::UnallocatedCString>{};
+
+    for (auto i = std::int64_t{0}; i < 10; ++i) {
+        auto tx = Funded(1000 + i);
+        expected.emplace_back(tx->ID().Bytes());
+        mempool.Submit(std::move(tx));
+    }
+
+    auto dumped = ot::UnallocatedVector<ot::UnallocatedCString>{};
+    auto position = Mempool::Cursor{0};
+
+    while (true) {
+        const auto [txids, next] = mempool.Dump(position, 3u);
+
+        if (txids.empty()) {
+            EXPECT_EQ(next, position);
+
+            break;
+        }
+
+        EXPECT_LE(txids.size(), 3u);
+
+        dumped.insert(dumped.end(), txids.begin(), txids.end());
+        position = next;
+    }
+
+    EXPECT_EQ(dumped, expected);
+
+    auto tx = Funded(5000);
+    const auto txid = ot::UnallocatedCString{tx->ID().Bytes()};
+    mempool.Submit(std::move(tx));
+    const auto [txids, next] = mempool.Dump(position, 3u);
+
+    ASSERT_EQ(txids.size(), 1u);
+    EXPECT_EQ(txids.front(), txid);
+    EXPECT_GT(next, position);
+}
+
+TEST_F(Test_Mempool, concurrent_submit_and_query)
+{
+    constexpr auto writers = std::size_t{4};
+    constexpr auto readers = std::size_t{4};
+    constexpr auto each = std::size_t{200};
+    auto txns = ot::UnallocatedVector<ot::UnallocatedVector<Tx>>(writers);
+
+    for (auto w = std::size_t{0}; w < writers; ++w) {
+        for (auto i = std::size_t{0}; i < each; ++i) {
+            const auto fee = 1000 + static_cast<std::int64_t>(i * writers + w);
+            txns.at(w).emplace_back(Funded(fee));
+        }
+    }
+
+    const auto limit = [&] {
+        auto out = ot::UnallocatedVector<const bb::Transaction*>{};
+
+        for (const auto& tx : txns.at(0)) { out.emplace_back(tx.get()); }
+
+        return Bytes(out);
+    }();
+    auto mempool = Mempool{socket_, chain_, limit};
+    auto running = std::atomic<bool>{true};
+    auto failures = std::atomic<std::size_t>{0};
+    auto threads = ot::UnallocatedVector<std::thread>{};
+
+    for (auto r = std::size_t{0}; r < readers; ++r) {
+        threads.emplace_back([&] {
+            while (running) {
+                for (const auto& [txid, rate] : mempool.Top(10u)) {
+                    if (0 > rate) { ++failures; }
+                }
+
+                auto position = Mempool::Cursor{0};
+
+                while (true) {
+                    const auto [txids, next] =
+                        mempool.Dump(position, Mempool::dump_batch_);
+
+                    if (txids.empty()) { break; }
+
+                    if (next <= position) { ++failures; }
+
+                    for (const auto& txid : txids) { mempool.Query(txid); }
+
+                    position = next;
+                }
+            }
+        });
+    }
+
+    {
+        auto submit = ot::UnallocatedVector<std::thread>{};
+
+        for (auto w = std::size_t{0}; w < writers; ++w) {
+            submit.emplace_back([&, w] {
+                for (const auto& tx : txns.at(w)) {
+                    mempool.Submit(tx->clone());
+                }
+            });
+        }
+
+        for (auto& thread : submit) { thread.join(); }
+    }
+
+    running = false;
+
+    for (auto& thread : threads) { thread.join(); }
+
+    EXPECT_EQ(failures, 0u);
+    EXPECT_LE(mempool.Bytes(), limit);
+
+    const auto top = mempool.Top(writers * each);
+
+    EXPECT_EQ(top.size(), each);
+
+    for (const auto& [txid, rate] : top) {
+        EXPECT_TRUE(mempool.Query(txid));
+    }
+}
+}  // namespace ottest
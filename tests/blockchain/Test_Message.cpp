@@ -4,12 +4,16 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <gtest/gtest.h>
+#include <cstddef>
 #include <memory>
 #include <utility>
 
 #include "1_Internal.hpp"  // IWYU pragma: keep
+#include "bip158/Bip158.hpp"
 #include "blockchain/p2p/bitcoin/Header.hpp"
 #include "blockchain/p2p/bitcoin/message/Getblocks.hpp"
+#include "blockchain/p2p/bitcoin/message/Getblocktxn.hpp"
+#include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/p2p/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/p2p/bitcoin/Factory.hpp"
 #include "internal/blockchain/p2p/bitcoin/message/Message.hpp"
@@ -17,8 +21,12 @@
 #include "opentxs/api/Context.hpp"
 #include "opentxs/api/session/Client.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/FilterType.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/blockchain/p2p/Types.hpp"
 #include "opentxs/core/Data.hpp"
+#include "opentxs/network/zeromq/message/Frame.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Pimpl.hpp"
@@ -145,4 +153,82 @@ TEST_F(Test_Message, getblocks)
         ASSERT_TRUE(pMessage->payload() == pLoadedMsg->payload());
     }
 }
+
+TEST_F(Test_Message, cfilter_frames)
+{
+    namespace bitcoin = ot::blockchain::p2p::bitcoin;
+
+    constexpr auto chain = ot::blockchain::Type::Bitcoin_testnet3;
+    constexpr auto type = ot::blockchain::cfilter::Type::Basic_BIP158;
+    auto batch = zmq::Message{};
+    auto expected = ot::UnallocatedVector<zmq::Frame>{};
+
+    for (const auto& vector : bip_158_vectors_) {
+        const auto hash = ot::blockchain::block::Hash{
+            vector.BlockHash(api_)->Bytes()};
+        const auto encoded = vector.Filter(api_);
+        const auto gcs = ot::factory::GCS(
+            api_,
+            type,
+            ot::blockchain::internal::BlockHashToFilterKey(hash.Bytes()),
+            encoded->Bytes(),
+            {});
+
+        ASSERT_TRUE(gcs.IsValid());
+
+        std::unique_ptr<bitcoin::message::internal::Cfilter> pMessage{
+            ot::factory::BitcoinP2PCfilter(api_, chain, type, hash, gcs)};
+
+        ASSERT_TRUE(pMessage);
+
+        auto [header, payload] = pMessage->Transmit();
+        expected.emplace_back(std::move(header));
+        expected.emplace_back(std::move(payload));
+
+        EXPECT_TRUE(ot::factory::BitcoinP2PCfilterFrames(
+            api_, chain, type, hash, encoded->Bytes(), batch));
+    }
+
+    ASSERT_EQ(batch.size(), expected.size());
+
+    for (auto i = std::size_t{0}; i < expected.size(); ++i) {
+        EXPECT_EQ(batch.at(i).Bytes(), expected.at(i).Bytes());
+    }
+}
+TEST_F(Test_Message, getblocktxn_index_range)
+{
+    namespace bitcoin = ot::blockchain::p2p::bitcoin;
+    using Indices = ot::UnallocatedVector<std::size_t>;
+
+    const auto parse = [&](const Indices& indices) {
+        auto hash = ot::Data::Factory();
+        hash->Randomize(32);
+        std::unique_ptr<bitcoin::Message> pMessage{
+            ot::factory::BitcoinP2PGetblocktxn(
+                api_, ot::blockchain::Type::Bitcoin, hash, indices)};
+
+        EXPECT_TRUE(pMessage);
+
+        const auto [header, payload] = pMessage->Transmit();
+        std::unique_ptr<bitcoin::Header> pHeader{
+            ot::factory::BitcoinP2PHeader(api_, header)};
+
+        return std::unique_ptr<bitcoin::message::Getblocktxn>{
+            ot::factory::BitcoinP2PGetblocktxn(
+                api_,
+                std::move(pHeader),
+                70015,
+                payload.data(),
+                payload.size())};
+    };
+    const auto valid = Indices{0u, 1u, 65535u};
+    const auto loaded = parse(valid);
+
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(loaded->getIndices(), valid);
+
+    // NOTE no block holds enough transactions to need a larger index
+    EXPECT_FALSE(parse({65536u}));
+    EXPECT_FALSE(parse({1u, 65536u}));
+}
 }  // namespace ottest
@@ -0,0 +1,291 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Helpers.hpp"
+#include "blockchain/bip158/bch_filter_1307544.hpp"
+#include "blockchain/node/base/SyncReader.hpp"
+#include "internal/blockchain/Blockchain.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/Header.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Header.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Options.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ottest
+{
+using SyncReader = ot::blockchain::node::base::SyncReader;
+
+class Test_SyncReader : public ::testing::Test
+{
+public:
+    static constexpr auto chain_{ot::blockchain::Type::UnitTest};
+
+    const ot::api::session::Client& api_;
+    const ot::ReadView filter_;
+    const std::unique_ptr<const ot::blockchain::block::bitcoin::Header> header_;
+    std::atomic<std::size_t> header_loads_;
+
+    static auto Hash(const std::size_t value) noexcept
+        -> ot::blockchain::block::Hash
+    {
+        auto bytes = std::array<char, 32>{};
+        std::memcpy(bytes.data(), &value, sizeof(value));
+
+        return ot::blockchain::block::Hash{
+            ot::ReadView{bytes.data(), bytes.size()}};
+    }
+    static auto Hashes(const std::size_t count) noexcept -> SyncReader::Hashes
+    {
+        auto output = SyncReader::Hashes{};
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            output.emplace_back(Hash(i));
+        }
+
+        return output;
+    }
+
+    auto Filters() const noexcept -> SyncReader::FilterLoader
+    {
+        return [this](const auto& blocks, const auto& visitor) {
+            for (const auto& block : blocks) { visitor(block, filter_); }
+
+            return blocks.size();
+        };
+    }
+    auto Headers() noexcept -> SyncReader::HeaderLoader
+    {
+        return [this](const auto&) {
+            ++header_loads_;
+
+            return header_->as_Bitcoin();
+        };
+    }
+    auto Verify(const ot::blockchain::node::base::SyncPacketData& data)
+        const noexcept -> void
+    {
+        const auto [count, compressed] =
+            ot::blockchain::internal::DecodeSerializedCfilter(filter_);
+
+        EXPECT_TRUE(data.IsValid());
+        EXPECT_EQ(data.parent_, header_->ParentHash());
+        EXPECT_EQ(ot::reader(data.header_), header_->Encode()->Bytes());
+        EXPECT_EQ(data.count_, count);
+        EXPECT_EQ(ot::reader(data.filter_), compressed);
+    }
+
+    Test_SyncReader()
+        : api_(ot::Context().StartClientSession(
+              ot::Options{}.SetBlockchainWalletEnabled(false),
+              0))
+        , filter_(
+              reinterpret_cast<const char*>(bch_filter_1307544_.data()),
+              bch_filter_1307544_.size())
+        , header_([&] {
+            const auto& hex = genesis_block_data_.at(chain_).genesis_block_hex_;
+            const auto bytes = api_.Factory().DataFromHex(hex);
+            const auto block =
+                api_.Factory().BitcoinBlock(chain_, bytes->Bytes());
+
+            OT_ASSERT(block);
+
+            return block->Header().as_Bitcoin();
+        }())
+        , header_loads_(0)
+    {
+    }
+};
+
+TEST_F(Test_SyncReader, chunks)
+{
+    using Ranges = ot::UnallocatedVector<SyncReader::Range>;
+
+    EXPECT_EQ(SyncReader::Chunks(0), Ranges{});
+    EXPECT_EQ(SyncReader::Chunks(1), (Ranges{{0, 1}}));
+    EXPECT_EQ(SyncReader::Chunks(SyncReader::chunk_), (Ranges{{0, 100}}));
+    EXPECT_EQ(
+        SyncReader::Chunks(250), (Ranges{{0, 100}, {100, 200}, {200, 250}}));
+}
+
+TEST_F(Test_SyncReader, prepare)
+{
+    const auto reader = SyncReader{Filters(), Headers(), {}};
+    const auto prepared = reader.Prepare(Hashes(3));
+
+    ASSERT_EQ(prepared.size(), 3u);
+
+    for (const auto& data : prepared) { Verify(data); }
+
+    EXPECT_EQ(header_loads_, 3u);
+}
+
+TEST_F(Test_SyncReader, prepare_missing_data)
+{
+    const auto blocks = Hashes(4);
+    const auto reader = SyncReader{
+        [&](const auto& hashes, const auto& visitor) -> std::size_t {
+            EXPECT_EQ(hashes, blocks);
+
+            visitor(hashes.at(0), filter_);
+            visitor(hashes.at(1), {});
+            visitor(hashes.at(2), filter_);
+
+            // NOTE the database stops at the first missing filter
+            return 3u;
+        },
+        [&](const auto& block)
+            -> std::unique_ptr<ot::blockchain::block::bitcoin::Header> {
+            ++header_loads_;
+
+            if (blocks.at(2) == block) { return nullptr; }
+
+            return header_->as_Bitcoin();
+        },
+        {}};
+    const auto prepared = reader.Prepare(blocks);
+
+    ASSERT_EQ(prepared.size(), 4u);
+
+    Verify(prepared.at(0));
+
+    EXPECT_FALSE(prepared.at(1).IsValid());
+    EXPECT_FALSE(prepared.at(2).IsValid());
+    EXPECT_FALSE(prepared.at(3).IsValid());
+    // NOTE headers are only loaded for blocks which have a filter
+    EXPECT_EQ(header_loads_, 2u);
+}
+
+TEST_F(Test_SyncReader, read_ahead)
+{
+    auto queued = ot::UnallocatedVector<SyncReader::Job>{};
+    auto reader = SyncReader{Filters(), Headers(), [&](auto job) {
+                                 queued.emplace_back(std::move(job));
+
+                                 return true;
+                             }};
+    auto finished = std::size_t{0};
+
+    for (auto i = std::size_t{0}; i < SyncReader::read_ahead_; ++i) {
+        EXPECT_FALSE(reader.Full());
+
+        reader.Start([&] { ++finished; });
+    }
+
+    ASSERT_EQ(queued.size(), SyncReader::read_ahead_);
+    EXPECT_TRUE(reader.Full());
+
+    // NOTE jobs which finished out of order do not free a slot
+    queued.back()();
+
+    EXPECT_TRUE(reader.Full());
+
+    queued.front()();
+
+    EXPECT_FALSE(reader.Full());
+
+    for (auto i = std::next(queued.begin()); i != std::prev(queued.end());
+         ++i) {
+        (*i)();
+    }
+
+    reader.Wait();
+
+    EXPECT_EQ(finished, SyncReader::read_ahead_);
+    EXPECT_FALSE(reader.Full());
+}
+
+TEST_F(Test_SyncReader, release_before_finish)
+{
+    auto queued = ot::UnallocatedVector<SyncReader::Job>{};
+    auto reader = SyncReader{Filters(), Headers(), [&](auto job) {
+                                 queued.emplace_back(std::move(job));
+
+                                 return true;
+                             }};
+    auto batch = std::make_shared<int>(0);
+    reader.Start([batch] { ++(*batch); });
+
+    ASSERT_EQ(queued.size(), 1u);
+    EXPECT_EQ(batch.use_count(), 2);
+
+    queued.front()();
+    reader.Wait();
+
+    // NOTE the job's state is released before Wait() returns
+    EXPECT_EQ(*batch, 1);
+    EXPECT_EQ(batch.use_count(), 1);
+}
+
+TEST_F(Test_SyncReader, post_failure)
+{
+    auto reader = SyncReader{Filters(), Headers(), [](auto) { return false; }};
+    auto finished = std::size_t{0};
+    reader.Start([&] { ++finished; });
+
+    // NOTE the job runs on the calling thread
+    EXPECT_EQ(finished, 1u);
+    EXPECT_FALSE(reader.Full());
+}
+
+TEST_F(Test_SyncReader, parallel_batch)
+{
+    constexpr auto count = std::size_t{250};
+    const auto blocks = Hashes(count);
+    auto threads = ot::UnallocatedVector<std::thread>{};
+    auto reader = SyncReader{Filters(), Headers(), [&](auto job) {
+                                 threads.emplace_back(std::move(job));
+
+                                 return true;
+                             }};
+    auto prepared = SyncReader::Prepared(count);
+
+    for (const auto& [first, last] : SyncReader::Chunks(count)) {
+        reader.Start([&, first = first, last = last] {
+            auto hashes = SyncReader::Hashes{};
+
+            for (auto i = first; i < last; ++i) {
+                hashes.emplace_back(blocks.at(i));
+            }
+
+            auto data = reader.Prepare(hashes);
+
+            for (auto i = first; i < last; ++i) {
+                prepared.at(i) = std::move(data.at(i - first));
+            }
+        });
+    }
+
+    EXPECT_EQ(threads.size(), 3u);
+
+    reader.Wait();
+
+    for (auto& thread : threads) { thread.join(); }
+
+    for (const auto& data : prepared) { Verify(data); }
+
+    EXPECT_EQ(header_loads_, count);
+}
+}  // namespace ottest
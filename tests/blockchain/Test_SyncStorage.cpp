@@ -0,0 +1,161 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <ios>
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "blockchain/database/common/Sync.hpp"
+#include "internal/blockchain/database/common/Common.hpp"
+#include "internal/network/p2p/Factory.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/network/p2p/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace ottest
+{
+namespace common = ot::blockchain::database::common;
+
+using LMDB = ot::storage::lmdb::LMDB;
+
+class Test_SyncStorage : public ::testing::Test
+{
+public:
+    static constexpr auto chain_{ot::blockchain::Type::UnitTest};
+
+    const ot::api::session::Client& api_;
+    const fs::path folder_;
+    LMDB lmdb_;
+
+    // Flips one bit of the genesis sync packet in the backing file
+    auto CorruptGenesis() const noexcept -> bool
+    {
+        auto index = ot::util::IndexData{};
+        const auto loaded = lmdb_.Load(
+            common::ChainToSyncTable(chain_),
+            std::size_t{0},
+            [&](const auto bytes) {
+                if (sizeof(index) <= bytes.size()) {
+                    std::memcpy(&index, bytes.data(), sizeof(index));
+                }
+            });
+
+        if ((false == loaded) || (0u == index.size_)) { return false; }
+
+        const auto file = folder_ / "sync00000.dat";
+
+        if (index.position_ >= fs::file_size(file)) { return false; }
+
+        auto stream = std::fstream{
+            file.string(), std::ios::in | std::ios::out | std::ios::binary};
+        const auto position = static_cast<std::streamoff>(index.position_);
+        auto byte = char{};
+        stream.seekg(position);
+        stream.get(byte);
+        stream.seekp(position);
+        stream.put(static_cast<char>(byte ^ 0x01));
+
+        return stream.good();
+    }
+    auto Load(const common::Sync& sync) const noexcept -> bool
+    {
+        auto output = ot::factory::BlockchainSyncData();
+
+        return sync.Load(chain_, -1, output);
+    }
+
+    Test_SyncStorage()
+        : api_(ot::Context().StartClientSession(0))
+        , folder_([] {
+            auto path = fs::temp_directory_path() /
+                        fs::unique_path("opentxs-sync-%%%%-%%%%-%%%%-%%%%");
+            fs::create_directories(path);
+
+            return path;
+        }())
+        , lmdb_(
+              [] {
+                  auto output = ot::storage::lmdb::TableNames{
+                      {common::Table::Config, "config"},
+                      {common::Table::SyncTips, "sync_tips"},
+                      {common::Table::SyncFreeSpace, "sync_free_space"},
+                  };
+
+                  for (const auto& [table, name] : common::SyncTables()) {
+                      output.emplace(table, name);
+                  }
+
+                  return output;
+              }(),
+              folder_.string(),
+              [] {
+                  auto output = ot::storage::lmdb::TablesToInit{
+                      {common::Table::Config, MDB_INTEGERKEY},
+                      {common::Table::SyncTips, MDB_INTEGERKEY},
+                      {common::Table::SyncFreeSpace,
+                       MDB_DUPSORT | MDB_INTEGERKEY},
+                  };
+
+                  for (const auto& [table, name] : common::SyncTables()) {
+                      output.emplace_back(table, MDB_INTEGERKEY);
+                  }
+
+                  return output;
+              }())
+    {
+    }
+
+    ~Test_SyncStorage() override
+    {
+        auto ec = boost::system::error_code{};
+        fs::remove_all(folder_, ec);
+    }
+};
+
+TEST_F(Test_SyncStorage, corruption_detected_after_restart)
+{
+    {
+        const auto sync = common::Sync{api_, lmdb_, folder_.string(), false};
+
+        ASSERT_EQ(sync.Tip(chain_), 0);
+        EXPECT_TRUE(Load(sync));
+        EXPECT_TRUE(Load(sync));
+    }
+
+    ASSERT_TRUE(CorruptGenesis());
+
+    {
+        const auto sync = common::Sync{api_, lmdb_, folder_.string(), false};
+
+        EXPECT_FALSE(Load(sync));
+    }
+}
+
+TEST_F(Test_SyncStorage, paranoid_detects_corruption_without_restart)
+{
+    const auto sync = common::Sync{api_, lmdb_, folder_.string(), true};
+
+    ASSERT_EQ(sync.Tip(chain_), 0);
+    EXPECT_TRUE(Load(sync));
+    ASSERT_TRUE(CorruptGenesis());
+    EXPECT_FALSE(Load(sync));
+}
+}  // namespace ottest
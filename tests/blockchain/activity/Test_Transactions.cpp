@@ -0,0 +1,230 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "Helpers.hpp"
+#include "internal/api/crypto/Blockchain.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/api/crypto/Blockchain.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/crypto/Element.hpp"
+#include "opentxs/blockchain/crypto/HD.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"
+#include "opentxs/blockchain/crypto/Types.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/PasswordPrompt.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+using Subchain = ot::blockchain::crypto::Subchain;
+using Transactions = ot::api::crypto::internal::Blockchain::Transactions;
+
+ot::UnallocatedVector<ot::Bip32Index> indices_{};
+ot::UnallocatedCString txid_1_{};
+ot::UnallocatedCString txid_2_{};
+
+namespace ottest
+{
+constexpr auto bitcoin_{ot::blockchain::Type::Bitcoin};
+constexpr auto testnet_{ot::blockchain::Type::Bitcoin_testnet3};
+
+class Test_BlockchainTransactions : public Test_BlockchainActivity
+{
+public:
+    auto has_key(
+        const ot::blockchain::block::bitcoin::Transaction& tx,
+        const Element& key) const noexcept -> bool
+    {
+        const auto keys = tx.Keys();
+
+        return keys.end() != std::find(keys.begin(), keys.end(), key.KeyID());
+    }
+    auto key(const std::size_t i) const noexcept -> const Element&
+    {
+        return api_.Crypto()
+            .Blockchain()
+            .HDSubaccount(nym_1_id(), account_1_id())
+            .BalanceElement(Subchain::External, indices_.at(i));
+    }
+    // Parses the transaction paying to first and second on the specified
+    // chain and associates only the key for the specified output with it
+    auto make_transaction(
+        const ot::blockchain::Type chain,
+        const Element& first,
+        const Element& second,
+        const std::size_t output) const noexcept
+        -> std::unique_ptr<ot::blockchain::block::bitcoin::Transaction>
+    {
+        const auto raw =
+            api_.Factory().DataFromHex(monkey_patch(first, second));
+        const auto parsed =
+            api_.Factory().BitcoinTransaction(chain, raw->Bytes(), false);
+
+        OT_ASSERT(parsed);
+
+        auto tx = parsed->clone();
+
+        OT_ASSERT(tx);
+
+        const auto& element = (0u == output) ? first : second;
+        const auto added =
+            tx->Internal().ForTestingOnlyAddKey(output, element.KeyID());
+
+        OT_ASSERT(added);
+
+        return tx;
+    }
+};
+
+TEST_F(Test_BlockchainTransactions, init)
+{
+    const auto& account =
+        api_.Crypto().Blockchain().HDSubaccount(nym_1_id(), account_1_id());
+
+    for (auto i = 0; i < 4; ++i) {
+        const auto index = account.Reserve(Subchain::External, reason_);
+
+        ASSERT_TRUE(index.has_value());
+
+        indices_.emplace_back(index.value());
+    }
+
+    txid_1_ = make_transaction(bitcoin_, key(0), key(1), 0)->ID().asHex();
+    txid_2_ = make_transaction(bitcoin_, key(2), key(3), 0)->ID().asHex();
+
+    EXPECT_NE(txid_1_, txid_2_);
+}
+
+TEST_F(Test_BlockchainTransactions, duplicates_in_batch)
+{
+    auto batch = Transactions{};
+    batch.emplace_back(make_transaction(bitcoin_, key(0), key(1), 0));
+    batch.emplace_back(make_transaction(bitcoin_, key(0), key(1), 1));
+
+    ASSERT_TRUE(api_.Crypto().Blockchain().Internal().ProcessTransactions(
+        bitcoin_, std::move(batch), reason_));
+
+    const auto tx = api_.Crypto().Blockchain().LoadTransactionBitcoin(txid_1_);
+
+    ASSERT_TRUE(tx);
+    // NOTE the keys from both copies are merged into a single transaction
+    EXPECT_TRUE(has_key(*tx, key(0)));
+    EXPECT_TRUE(has_key(*tx, key(1)));
+    EXPECT_EQ(
+        tx->Chains(), ot::UnallocatedVector<ot::blockchain::Type>{bitcoin_});
+}
+
+TEST_F(Test_BlockchainTransactions, second_chain)
+{
+    auto batch = Transactions{};
+    batch.emplace_back(make_transaction(testnet_, key(0), key(1), 0));
+
+    ASSERT_TRUE(api_.Crypto().Blockchain().Internal().ProcessTransactions(
+        testnet_, std::move(batch), reason_));
+
+    const auto tx = api_.Crypto().Blockchain().LoadTransactionBitcoin(txid_1_);
+
+    ASSERT_TRUE(tx);
+
+    const auto chains = tx->Chains();
+
+    EXPECT_EQ(chains.size(), 2u);
+    EXPECT_EQ(std::count(chains.begin(), chains.end(), bitcoin_), 1);
+    EXPECT_EQ(std::count(chains.begin(), chains.end(), testnet_), 1);
+    // NOTE keys stored by the first chain are retained
+    EXPECT_TRUE(has_key(*tx, key(0)));
+    EXPECT_TRUE(has_key(*tx, key(1)));
+}
+
+TEST_F(Test_BlockchainTransactions, concurrent_memo)
+{
+    using namespace std::literals::chrono_literals;
+    constexpr auto rounds = std::size_t{20};
+    constexpr auto limit = 2min;
+    const auto& blockchain = api_.Crypto().Blockchain();
+    const auto memo = [](const std::size_t i) {
+        return ot::UnallocatedCString{"memo "} + std::to_string(i);
+    };
+
+    {
+        auto batch = Transactions{};
+        batch.emplace_back(make_transaction(bitcoin_, key(2), key(3), 0));
+
+        ASSERT_TRUE(blockchain.Internal().ProcessTransactions(
+            bitcoin_, std::move(batch), reason_));
+    }
+
+    auto start = std::promise<void>{};
+    const auto ready = start.get_future().share();
+    // NOTE each batch locks both transactions, in alternating order, while
+    // the other threads take the lock for a single transaction
+    const auto process = [&](const std::size_t offset) {
+        ready.wait();
+        auto output{true};
+
+        for (auto i = std::size_t{0}; i < rounds; ++i) {
+            auto batch = Transactions{};
+            const auto first = 2u * ((i + offset) % 2u);
+            const auto second = 2u - first;
+            batch.emplace_back(
+                make_transaction(bitcoin_, key(first), key(first + 1), 1));
+            batch.emplace_back(
+                make_transaction(bitcoin_, key(second), key(second + 1), 0));
+            output &= blockchain.Internal().ProcessTransactions(
+                bitcoin_, std::move(batch), reason_);
+        }
+
+        return output;
+    };
+    const auto assign = [&](const ot::UnallocatedCString& txid) {
+        ready.wait();
+        auto output{true};
+
+        for (auto i = std::size_t{0}; i < rounds; ++i) {
+            output &= blockchain.AssignTransactionMemo(txid, memo(i));
+        }
+
+        return output;
+    };
+    auto futures = ot::UnallocatedVector<std::future<bool>>{};
+    futures.emplace_back(std::async(std::launch::async, process, 0u));
+    futures.emplace_back(std::async(std::launch::async, process, 1u));
+    futures.emplace_back(std::async(std::launch::async, assign, txid_1_));
+    futures.emplace_back(std::async(std::launch::async, assign, txid_2_));
+    start.set_value();
+
+    for (auto& future : futures) {
+        // NOTE a deadlock would otherwise hang the test in the future's
+        // destructor
+        OT_ASSERT(std::future_status::ready == future.wait_for(limit));
+
+        EXPECT_TRUE(future.get());
+    }
+
+    // NOTE concurrent batches must not overwrite a memo with stale data
+    for (const auto& txid : {txid_1_, txid_2_}) {
+        const auto tx = blockchain.LoadTransactionBitcoin(txid);
+
+        ASSERT_TRUE(tx);
+        EXPECT_EQ(tx->Memo(), memo(rounds - 1));
+        EXPECT_EQ(tx->Chains().size(), (txid == txid_1_) ? 2u : 1u);
+    }
+}
+}  // namespace ottest
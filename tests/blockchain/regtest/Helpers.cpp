@@ -1150,7 +1150,12 @@ auto Regtest_fixture_base::TestWallet(
 }
 
 Regtest_fixture_hd::Regtest_fixture_hd()
-    : Regtest_fixture_normal(1)
+    : Regtest_fixture_hd(ot::Options{}.SetBlockchainStorageLevel(1))
+{
+}
+
+Regtest_fixture_hd::Regtest_fixture_hd(const ot::Options& clientArgs)
+    : Regtest_fixture_normal(1, clientArgs)
     , expected_notary_(client_1_.UI().BlockchainNotaryID(test_chain_))
     , expected_unit_(client_1_.UI().BlockchainUnitID(test_chain_))
     , expected_display_unit_(u8"UNITTEST")
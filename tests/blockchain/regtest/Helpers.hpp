@@ -571,6 +571,7 @@ protected:
     auto Shutdown() noexcept -> void final;
 
     Regtest_fixture_hd();
+    Regtest_fixture_hd(const ot::Options& clientArgs);
 };
 
 class Regtest_payment_code : public Regtest_fixture_normal
@@ -0,0 +1,329 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Helpers.hpp"  // IWYU pragma: associated
+
+#include <gtest/gtest.h>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include "opentxs/api/crypto/Blockchain.hpp"
+#include "opentxs/api/network/Blockchain.hpp"
+#include "opentxs/api/network/Network.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
+#include "opentxs/blockchain/block/bitcoin/Input.hpp"
+#include "opentxs/blockchain/block/bitcoin/Inputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/crypto/HD.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/node/Manager.hpp"
+#include "opentxs/blockchain/node/TxoState.hpp"
+#include "opentxs/blockchain/node/TxoTag.hpp"
+#include "opentxs/blockchain/node/Wallet.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Options.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "opentxs/util/Time.hpp"
+
+namespace ottest
+{
+using namespace std::literals::chrono_literals;
+
+constexpr auto addresses_ = std::array<const char*, 3>{
+    "mipcBbFg9gMiCh81Kj8tqqdgoZub1ZJRfn",
+    "2MzQwSSnBHWHqSAqtTVQ6v47XtaisrJa1Vc",
+    "2N2PJEucf6QY2kNFuJ4chQEBoyZWszRQE16",
+};
+
+class Regtest_send_batch : public Regtest_fixture_hd
+{
+protected:
+    using Tx = ot::blockchain::block::bitcoin::Transaction;
+    using Txid = ot::blockchain::block::pTxid;
+    using Future = ot::blockchain::node::Manager::PendingOutgoing;
+
+    static ot::UnallocatedMap<Outpoint, Amount> values_;
+    static std::optional<Amount> single_fee_;
+
+    // Returns the fee paid by a transaction which only spends outputs
+    // created by the generator or by previous spends in this test
+    auto Fee(const Tx& tx) const noexcept -> std::optional<Amount>
+    {
+        auto fee = Amount{0};
+
+        for (const auto& input : tx.Inputs()) {
+            const auto& outpoint = input.PreviousOutput();
+
+            if (auto i = expected_.find(outpoint); expected_.end() != i) {
+                fee += std::get<1>(i->second);
+            } else if (auto j = values_.find(outpoint); values_.end() != j) {
+                fee += j->second;
+            } else {
+
+                return std::nullopt;
+            }
+        }
+
+        for (const auto& output : tx.Outputs()) { fee -= output.Value(); }
+
+        return fee;
+    }
+    auto Load(const Txid& txid) const noexcept -> std::unique_ptr<const Tx>
+    {
+        return client_1_.Crypto().Blockchain().LoadTransactionBitcoin(txid);
+    }
+    auto Send(
+        const ot::UnallocatedCString& address,
+        const Amount amount) const noexcept -> Future
+    {
+        const auto& network =
+            client_1_.Network().Blockchain().GetChain(test_chain_);
+
+        return network.SendToAddress(
+            alice_.nym_id_, address, amount, memo_outgoing_);
+    }
+    auto Wallet() const noexcept -> const ot::blockchain::node::Wallet&
+    {
+        return client_1_.Network().Blockchain().GetChain(test_chain_).Wallet();
+    }
+
+    auto Record(const Tx& tx) noexcept -> void
+    {
+        auto index = std::uint32_t{0};
+
+        for (const auto& output : tx.Outputs()) {
+            values_.emplace(Outpoint{tx.ID().Bytes(), index++}, output.Value());
+        }
+    }
+
+    Regtest_send_batch()
+        : Regtest_fixture_hd(ot::Options{}
+                                 .SetBlockchainStorageLevel(1)
+                                 .SetBlockchainSpendBatchWindow(5s)
+                                 .SetBlockchainSpendBatchOutputs(3))
+    {
+    }
+};
+
+ot::UnallocatedMap<Regtest_send_batch::Outpoint, Regtest_send_batch::Amount>
+    Regtest_send_batch::values_{};
+std::optional<Regtest_send_batch::Amount> Regtest_send_batch::single_fee_{};
+
+TEST_F(Regtest_send_batch, init_opentxs) {}
+
+TEST_F(Regtest_send_batch, start_chains) { EXPECT_TRUE(Start()); }
+
+TEST_F(Regtest_send_batch, connect_peers) { EXPECT_TRUE(Connect()); }
+
+TEST_F(Regtest_send_batch, generate)
+{
+    constexpr auto count{1};
+    const auto start = height_;
+    const auto end{start + count};
+    auto future1 = listener_.get_future(SendHD(), Subchain::External, end);
+    auto future2 = listener_.get_future(SendHD(), Subchain::Internal, end);
+
+    EXPECT_TRUE(Mine(start, count, hd_generator_));
+    EXPECT_TRUE(listener_.wait(future1));
+    EXPECT_TRUE(listener_.wait(future2));
+    EXPECT_TRUE(txos_.Mature(end));
+}
+
+TEST_F(Regtest_send_batch, mature)
+{
+    const auto count = static_cast<int>(MaturationInterval());
+    const auto start = height_;
+    const auto end{start + count};
+    auto future1 = listener_.get_future(SendHD(), Subchain::External, end);
+    auto future2 = listener_.get_future(SendHD(), Subchain::Internal, end);
+
+    EXPECT_TRUE(Mine(start, count));
+    EXPECT_TRUE(listener_.wait(future1));
+    EXPECT_TRUE(listener_.wait(future2));
+    EXPECT_TRUE(txos_.Mature(end));
+}
+
+TEST_F(Regtest_send_batch, single)
+{
+    // NOTE a proposal which is alone in the queue is sent by itself once the
+    // batch window has elapsed
+    const auto& txid = transactions_.emplace_back(
+        Send(addresses_.at(0), 10000000).get().second);
+
+    ASSERT_FALSE(txid->empty());
+
+    const auto pTX = Load(txid);
+
+    ASSERT_TRUE(pTX);
+
+    const auto& tx = *pTX;
+
+    EXPECT_EQ(tx.Outputs().size(), 2u);
+
+    single_fee_ = Fee(tx);
+
+    ASSERT_TRUE(single_fee_.has_value());
+    EXPECT_GT(single_fee_.value(), 0);
+
+    Record(tx);
+}
+
+TEST_F(Regtest_send_batch, batch)
+{
+    constexpr auto amounts =
+        std::array<std::int64_t, 3>{10000000, 20000000, 30000000};
+    auto futures = ot::UnallocatedVector<Future>{};
+
+    for (auto i = std::size_t{0}; i < amounts.size(); ++i) {
+        futures.emplace_back(Send(addresses_.at(i), amounts.at(i)));
+    }
+
+    auto txids = ot::UnallocatedVector<Txid>{};
+
+    for (auto& future : futures) { txids.emplace_back(future.get().second); }
+
+    ASSERT_EQ(txids.size(), amounts.size());
+
+    for (const auto& txid : txids) {
+        ASSERT_FALSE(txid->empty());
+        EXPECT_EQ(txid, txids.front());
+    }
+
+    const auto& txid = transactions_.emplace_back(txids.front());
+    const auto pTX = Load(txid);
+
+    ASSERT_TRUE(pTX);
+
+    const auto& tx = *pTX;
+
+    ASSERT_EQ(tx.Outputs().size(), amounts.size() + 1u);
+
+    auto found = ot::UnallocatedMap<std::int64_t, std::size_t>{};
+    auto change = std::size_t{0};
+    auto index = std::uint32_t{0};
+
+    for (const auto& output : tx.Outputs()) {
+        using Tag = ot::blockchain::node::TxoTag;
+        const auto tags = Wallet().GetTags({txid->Bytes(), index++});
+
+        if (0u < tags.count(Tag::Change)) {
+            ++change;
+
+            continue;
+        }
+
+        for (const auto amount : amounts) {
+            if (output.Value() == amount) { ++found[amount]; }
+        }
+    }
+
+    EXPECT_EQ(change, 1u);
+
+    for (const auto amount : amounts) { EXPECT_EQ(found[amount], 1u); }
+
+    const auto fee = Fee(tx);
+
+    ASSERT_TRUE(fee.has_value());
+    ASSERT_TRUE(single_fee_.has_value());
+    EXPECT_LT(fee.value(), single_fee_.value() * amounts.size());
+
+    Record(tx);
+}
+
+TEST_F(Regtest_send_batch, aborted_batch)
+{
+    // NOTE the batch as a whole can not be funded so it is split back into
+    // individual proposals, only two of which can be funded
+    constexpr auto amount = std::int64_t{4000000000};
+    auto futures = ot::UnallocatedVector<Future>{};
+
+    for (const auto* address : addresses_) {
+        futures.emplace_back(Send(address, amount));
+    }
+
+    auto sent = std::size_t{0};
+    auto failed = std::size_t{0};
+
+    for (auto& future : futures) {
+        const auto [rc, txid] = future.get();
+
+        if (txid->empty()) {
+            ++failed;
+        } else {
+            ++sent;
+            const auto pTX = Load(txid);
+
+            ASSERT_TRUE(pTX);
+            EXPECT_EQ(pTX->Outputs().size(), 2u);
+
+            transactions_.emplace_back(txid);
+        }
+    }
+
+    EXPECT_EQ(sent, 2u);
+    EXPECT_EQ(failed, 1u);
+
+    // TODO ensure CancelProposal is finished processing with appropriate signal
+    ot::Sleep(5s);
+}
+
+TEST_F(Regtest_send_batch, reservations_released)
+{
+    auto spent = ot::UnallocatedSet<Outpoint>{};
+
+    for (auto i = std::size_t{1}; i < transactions_.size(); ++i) {
+        const auto pTX = Load(transactions_.at(i));
+
+        ASSERT_TRUE(pTX);
+
+        for (const auto& input : pTX->Inputs()) {
+            spent.emplace(input.PreviousOutput());
+        }
+    }
+
+    {
+        const auto outputs = Wallet().GetOutputs(
+            ot::blockchain::node::TxoState::UnconfirmedSpend);
+
+        EXPECT_EQ(outputs.size(), spent.size());
+
+        for (const auto& [outpoint, output] : outputs) {
+            EXPECT_EQ(spent.count(outpoint), 1u);
+        }
+    }
+
+    // NOTE spending the entire remaining confirmed balance is only possible if
+    // every output reserved for the aborted batch was released
+    auto available = Amount{0};
+
+    for (const auto& [outpoint, output] :
+         Wallet().GetOutputs(ot::blockchain::node::TxoState::ConfirmedNew)) {
+        available += output->Value();
+    }
+
+    const auto margin = Amount{10000000};
+
+    ASSERT_GT(available, margin);
+
+    const auto txid = Send(addresses_.at(0), available - margin).get().second;
+
+    EXPECT_FALSE(txid->empty());
+}
+
+TEST_F(Regtest_send_batch, shutdown) { Shutdown(); }
+}  // namespace ottest
@@ -0,0 +1,188 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Helpers.hpp"  // IWYU pragma: associated
+
+#include <gtest/gtest.h>
+#include <chrono>
+
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/api/crypto/Blockchain.hpp"
+#include "opentxs/api/network/Blockchain.hpp"
+#include "opentxs/api/network/Network.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/UI.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/block/bitcoin/Inputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/crypto/Account.hpp"
+#include "opentxs/blockchain/crypto/HD.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/node/Manager.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/interface/ui/AccountActivity.hpp"
+#include "opentxs/interface/ui/BalanceItem.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "opentxs/util/SharedPimpl.hpp"
+#include "opentxs/util/Time.hpp"
+
+namespace ottest
+{
+using namespace std::literals::chrono_literals;
+
+// Waits until the row for the specified transaction shows the expected values
+auto wait_for_row(
+    const ot::ui::AccountActivity& widget,
+    const ot::blockchain::block::Txid& txid,
+    const ot::Amount& amount,
+    const int confirmations) noexcept -> bool
+{
+    const auto uuid = ot::blockchain::HashToNumber(txid);
+    const auto limit = ot::Clock::now() + 2min;
+
+    while (ot::Clock::now() < limit) {
+        for (auto row = widget.First(); row->Valid(); row = widget.Next()) {
+            if (row->UUID() == uuid) {
+                if ((row->Amount() == amount) &&
+                    (row->Confirmations() == confirmations)) {
+
+                    return true;
+                }
+
+                break;
+            }
+
+            if (row->Last()) { break; }
+        }
+
+        ot::Sleep(100ms);
+    }
+
+    return false;
+}
+
+TEST_F(Regtest_fixture_hd, init_opentxs) {}
+
+TEST_F(Regtest_fixture_hd, start_chains) { EXPECT_TRUE(Start()); }
+
+TEST_F(Regtest_fixture_hd, connect_peers) { EXPECT_TRUE(Connect()); }
+
+TEST_F(Regtest_fixture_hd, init_ui_models)
+{
+    const auto& widget = client_1_.UI().AccountActivity(
+        alice_.nym_id_, SendHD().Parent().AccountID());
+
+    EXPECT_FALSE(widget.CanLoadMore());
+}
+
+TEST_F(Regtest_fixture_hd, generate)
+{
+    constexpr auto count{1};
+    const auto start = height_;
+    const auto end{start + count};
+    auto future1 = listener_.get_future(SendHD(), Subchain::External, end);
+    auto future2 = listener_.get_future(SendHD(), Subchain::Internal, end);
+
+    EXPECT_EQ(start, 0);
+    EXPECT_TRUE(Mine(start, count, hd_generator_));
+    EXPECT_TRUE(listener_.wait(future1));
+    EXPECT_TRUE(listener_.wait(future2));
+}
+
+TEST_F(Regtest_fixture_hd, mature)
+{
+    const auto count = static_cast<int>(MaturationInterval());
+    const auto start = height_;
+    const auto end{start + count};
+    auto future1 = listener_.get_future(SendHD(), Subchain::External, end);
+    auto future2 = listener_.get_future(SendHD(), Subchain::Internal, end);
+
+    EXPECT_TRUE(Mine(start, count));
+    EXPECT_TRUE(listener_.wait(future1));
+    EXPECT_TRUE(listener_.wait(future2));
+}
+
+TEST_F(Regtest_fixture_hd, spend_without_change)
+{
+    const auto& network =
+        client_1_.Network().Blockchain().GetChain(test_chain_);
+    constexpr auto address{"mipcBbFg9gMiCh81Kj8tqqdgoZub1ZJRfn"};
+    // NOTE the smallest generated output is worth 100000000 and the
+    // difference from the amount sent is less than the fee plus the dust
+    // limit so no change output is created
+    auto future = network.SendToAddress(
+        alice_.nym_id_, address, 99999700, memo_outgoing_);
+    const auto& txid = transactions_.emplace_back(future.get().second);
+
+    ASSERT_FALSE(txid->empty());
+
+    const auto pTX =
+        client_1_.Crypto().Blockchain().LoadTransactionBitcoin(txid);
+
+    ASSERT_TRUE(pTX);
+
+    const auto& tx = *pTX;
+
+    EXPECT_EQ(tx.Inputs().size(), 1u);
+    EXPECT_EQ(tx.Outputs().size(), 1u);
+}
+
+TEST_F(Regtest_fixture_hd, account_activity_unconfirmed_spend)
+{
+    const auto& widget = client_1_.UI().AccountActivity(
+        alice_.nym_id_, SendHD().Parent().AccountID());
+
+    EXPECT_TRUE(
+        wait_for_row(widget, transactions_.at(1).get(), -100000000, 0));
+}
+
+TEST_F(Regtest_fixture_hd, confirm)
+{
+    constexpr auto count{1};
+    const auto start = height_;
+    const auto end{start + count};
+    auto future1 = listener_.get_future(SendHD(), Subchain::External, end);
+    auto future2 = listener_.get_future(SendHD(), Subchain::Internal, end);
+    const auto& txid = transactions_.at(1).get();
+    const auto extra = [&] {
+        auto output = ot::UnallocatedVector<Transaction>{};
+        const auto& pTX = output.emplace_back(
+            client_1_.Crypto().Blockchain().LoadTransactionBitcoin(txid));
+
+        OT_ASSERT(pTX);
+
+        return output;
+    }();
+
+    EXPECT_TRUE(Mine(start, count, default_, extra));
+    EXPECT_TRUE(listener_.wait(future1));
+    EXPECT_TRUE(listener_.wait(future2));
+}
+
+TEST_F(Regtest_fixture_hd, account_activity_confirmed_spend)
+{
+    // NOTE the balance change caused by the confirmation reindexes the
+    // account, which must not remove the row for a transaction that created
+    // no outputs belonging to the account
+    const auto& widget = client_1_.UI().AccountActivity(
+        alice_.nym_id_, SendHD().Parent().AccountID());
+
+    EXPECT_TRUE(
+        wait_for_row(widget, transactions_.at(1).get(), -100000000, 1));
+    EXPECT_TRUE(wait_for_row(
+        widget,
+        transactions_.at(0).get(),
+        10000004950,
+        static_cast<int>(MaturationInterval()) + 2));
+    EXPECT_FALSE(widget.CanLoadMore());
+}
+
+TEST_F(Regtest_fixture_hd, shutdown) { Shutdown(); }
+}  // namespace ottest
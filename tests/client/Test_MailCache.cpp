@@ -0,0 +1,187 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "api/session/activity/MailCache.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/socket/Publish.hpp"
+#include "opentxs/otx/client/Types.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/PasswordPrompt.hpp"
+#include "opentxs/util/Pimpl.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_MailCache : public ::testing::Test
+{
+public:
+    using Cache = ot::api::session::activity::MailCache;
+
+    static constexpr auto box_{ot::otx::client::StorageBox::MAILINBOX};
+    static constexpr auto text_size_{std::size_t{1024}};
+
+    const ot::api::session::Client& api_;
+    const ot::OTPasswordPrompt reason_;
+    const ot::OTNymID nym_;
+    const ot::OTZMQPublishSocket socket_;
+    std::atomic<std::size_t> loaded_;
+
+    // Returns the memory used by count items
+    auto Bytes(const std::size_t count) noexcept -> std::size_t
+    {
+        auto cache = Make(std::numeric_limits<std::size_t>::max());
+        const auto id = ID(0);
+        cache->CacheText(nym_, id, box_, Text(id));
+
+        return count * cache->Bytes();
+    }
+    auto Get(Cache& cache, const std::size_t index) noexcept
+        -> std::shared_future<ot::UnallocatedCString>
+    {
+        return cache.GetText(nym_, ID(index), box_, reason_);
+    }
+    auto ID(const std::size_t index) const noexcept -> ot::OTIdentifier
+    {
+        auto out = api_.Factory().Identifier();
+        out->CalculateDigest(std::to_string(index));
+
+        return out;
+    }
+    // Creates a cache which counts the items it reloads
+    auto Make(const std::size_t limit) noexcept -> std::unique_ptr<Cache>
+    {
+        return std::make_unique<Cache>(
+            api_,
+            socket_,
+            limit,
+            [this](const auto&, const auto& id, const auto, const auto&) {
+                ++loaded_;
+
+                return Text(id);
+            });
+    }
+    auto Text(const ot::Identifier& id) const noexcept
+        -> ot::UnallocatedCString
+    {
+        const auto prefix = id.str();
+        auto out = ot::UnallocatedCString{};
+
+        while (out.size() < text_size_) { out.append(prefix); }
+
+        out.resize(text_size_);
+
+        return out;
+    }
+
+    Test_MailCache()
+        : api_(ot::Context().StartClientSession(0))
+        , reason_(api_.Factory().PasswordPrompt(__func__))
+        , nym_([&] {
+            auto out = api_.Factory().NymID();
+            out->Randomize();
+
+            return out;
+        }())
+        , socket_(ot::Context().ZMQ().PublishSocket())
+        , loaded_(0)
+    {
+    }
+};
+
+TEST_F(Test_MailCache, bounded_memory)
+{
+    constexpr auto items = std::size_t{100000};
+    const auto limit = Bytes(1000);
+    auto cache = Make(limit);
+
+    for (auto i = std::size_t{0}; i < items; ++i) {
+        const auto id = ID(i);
+        cache->CacheText(nym_, id, box_, Text(id));
+
+        ASSERT_LE(cache->Bytes(), limit);
+    }
+
+    EXPECT_EQ(cache->Bytes(), limit);
+}
+
+TEST_F(Test_MailCache, evicted_entries_reload)
+{
+    auto cache = Make(Bytes(10));
+
+    for (auto i = std::size_t{0}; i < 20u; ++i) {
+        const auto id = ID(i);
+        cache->CacheText(nym_, id, box_, Text(id));
+    }
+
+    EXPECT_EQ(Get(*cache, 19).get(), Text(ID(19)));
+    EXPECT_EQ(loaded_.load(), 0u);
+    EXPECT_EQ(Get(*cache, 0).get(), Text(ID(0)));
+    EXPECT_EQ(loaded_.load(), 1u);
+    EXPECT_EQ(Get(*cache, 0).get(), Text(ID(0)));
+    EXPECT_EQ(loaded_.load(), 1u);
+}
+
+TEST_F(Test_MailCache, lru_order)
+{
+    auto cache = Make(Bytes(3));
+
+    for (auto i = std::size_t{0}; i < 3u; ++i) {
+        const auto id = ID(i);
+        cache->CacheText(nym_, id, box_, Text(id));
+    }
+
+    EXPECT_EQ(Get(*cache, 0).get(), Text(ID(0)));
+
+    {
+        const auto id = ID(3);
+        cache->CacheText(nym_, id, box_, Text(id));
+    }
+
+    EXPECT_EQ(Get(*cache, 0).get(), Text(ID(0)));
+    EXPECT_EQ(loaded_.load(), 0u);
+    EXPECT_EQ(Get(*cache, 1).get(), Text(ID(1)));
+    EXPECT_EQ(loaded_.load(), 1u);
+}
+
+TEST_F(Test_MailCache, concurrent_prefetch)
+{
+    constexpr auto items = std::size_t{200};
+    auto cache = Make(Bytes(items));
+    auto futures =
+        ot::UnallocatedVector<std::shared_future<ot::UnallocatedCString>>{};
+
+    for (auto i = std::size_t{0}; i < items; ++i) {
+        futures.emplace_back(Get(*cache, i));
+    }
+
+    for (auto i = std::size_t{0}; i < items; ++i) {
+        EXPECT_EQ(futures.at(i).get(), Text(ID(i)));
+    }
+
+    EXPECT_EQ(loaded_.load(), items);
+
+    for (auto i = std::size_t{0}; i < items; ++i) {
+        EXPECT_EQ(Get(*cache, i).get(), Text(ID(i)));
+    }
+
+    EXPECT_EQ(loaded_.load(), items);
+}
+}  // namespace ottest
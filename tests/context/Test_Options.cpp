@@ -4,6 +4,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <gtest/gtest.h>
+#include <chrono>
 
 #include "Helpers.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
@@ -61,6 +62,8 @@ constexpr auto sync_server_1_{"tcp://some.ip:1234"};
 constexpr auto sync_server_2_{"tcp://another.ip:1234"};
 constexpr auto test_mode_on_{true};
 constexpr auto test_mode_off_{false};
+constexpr auto ui_update_interval_1_{std::chrono::milliseconds{50}};
+constexpr auto ui_update_interval_2_{std::chrono::milliseconds{250}};
 
 namespace ottest
 {
@@ -354,4 +357,54 @@ TEST(Options, merge)
     EXPECT_TRUE(check_options(test1 + test2, expected2));
     EXPECT_TRUE(check_options(test2 + test3, expected3));
 }
+
+TEST(Options, ui_update_interval)
+{
+    const auto blank = opentxs::Options{};
+    const auto test1 =
+        opentxs::Options{}.SetUIUpdateInterval(ui_update_interval_1_);
+    const auto test2 =
+        opentxs::Options{}.SetUIUpdateInterval(ui_update_interval_2_);
+
+    EXPECT_EQ(blank.UIUpdateInterval().count(), 0);
+    EXPECT_EQ(test1.UIUpdateInterval(), ui_update_interval_1_);
+    EXPECT_EQ(
+        opentxs::Options{test2}.UIUpdateInterval(), ui_update_interval_2_);
+    EXPECT_EQ((test1 + blank).UIUpdateInterval(), ui_update_interval_1_);
+    EXPECT_EQ((blank + test1).UIUpdateInterval(), ui_update_interval_1_);
+    EXPECT_EQ((test1 + test2).UIUpdateInterval(), ui_update_interval_2_);
+}
+
+TEST(Options, blockchain_sync_paranoid)
+{
+    const auto blank = opentxs::Options{};
+    const auto on = opentxs::Options{}.SetBlockchainSyncParanoid(true);
+    const auto off = opentxs::Options{}.SetBlockchainSyncParanoid(false);
+
+    EXPECT_FALSE(blank.BlockchainSyncParanoid());
+    EXPECT_TRUE(on.BlockchainSyncParanoid());
+    EXPECT_TRUE(opentxs::Options{on}.BlockchainSyncParanoid());
+    EXPECT_TRUE((on + blank).BlockchainSyncParanoid());
+    EXPECT_TRUE((blank + on).BlockchainSyncParanoid());
+    EXPECT_FALSE((on + off).BlockchainSyncParanoid());
+}
+
+TEST(Options, blockchain_spend_batch)
+{
+    using namespace std::literals::chrono_literals;
+    const auto blank = opentxs::Options{};
+    const auto batch = opentxs::Options{}
+                           .SetBlockchainSpendBatchOutputs(10u)
+                           .SetBlockchainSpendBatchWindow(5s);
+    const auto other = opentxs::Options{}.SetBlockchainSpendBatchWindow(0s);
+
+    EXPECT_EQ(blank.BlockchainSpendBatchOutputs(), 100u);
+    EXPECT_EQ(blank.BlockchainSpendBatchWindow(), 0ms);
+    EXPECT_EQ(batch.BlockchainSpendBatchOutputs(), 10u);
+    EXPECT_EQ(batch.BlockchainSpendBatchWindow(), 5000ms);
+    EXPECT_EQ(opentxs::Options{batch}.BlockchainSpendBatchWindow(), 5000ms);
+    EXPECT_EQ((blank + batch).BlockchainSpendBatchOutputs(), 10u);
+    EXPECT_EQ((batch + other).BlockchainSpendBatchOutputs(), 10u);
+    EXPECT_EQ((batch + other).BlockchainSpendBatchWindow(), 0ms);
+}
 }  // namespace ottest
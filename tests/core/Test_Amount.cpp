@@ -16,6 +16,7 @@
 #include "opentxs/Version.hpp"
 #include "opentxs/core/Amount.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
+#include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 
 namespace ot = opentxs;
@@ -781,4 +782,29 @@ TEST(Amount, modulo)
 
     ASSERT_TRUE(ulonglong_amount % ot::Amount{2} == 1);
 }
+
+TEST(Amount, native_promotion)
+{
+    const auto max = ot::Amount{longlong_max};
+    const auto min = ot::Amount{longlong_min};
+    const auto sum = max + max;
+    const auto expected = bmp::cpp_int{longlong_max} * 2;
+
+    EXPECT_TRUE(sum > max);
+    EXPECT_EQ(sum / ot::Amount{2}, max);
+    EXPECT_EQ(sum - max, max);
+    EXPECT_EQ(ot::Amount{ulonglong_max} - ot::Amount{ulonglong_max}, 0);
+    EXPECT_EQ(min - ot::Amount{1} + ot::Amount{1}, min);
+    EXPECT_EQ(-(-min), min);
+    EXPECT_EQ(max * 4 / 4, max);
+
+    auto serialized = ot::UnallocatedCString{};
+    auto reference = ot::UnallocatedCString{};
+
+    EXPECT_TRUE(sum.Serialize(ot::writer(serialized)));
+    EXPECT_TRUE(ot::factory::Amount(expected.str(), true)
+                    .Serialize(ot::writer(reference)));
+    EXPECT_EQ(serialized, reference);
+    EXPECT_EQ(ot::factory::Amount(serialized), sum);
+}
 }  // namespace ottest
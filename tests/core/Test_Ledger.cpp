@@ -4,11 +4,13 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <gtest/gtest.h>
+#include <cstdint>
 #include <memory>
 
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/otx/Types.hpp"
 #include "internal/otx/common/Ledger.hpp"
+#include "internal/otx/common/OTTransaction.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/api/Context.hpp"
@@ -23,6 +25,7 @@
 #include "opentxs/identity/Nym.hpp"
 #include "opentxs/identity/Types.hpp"
 #include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
 #include "opentxs/util/PasswordPrompt.hpp"
 #include "opentxs/util/SharedPimpl.hpp"
 
@@ -34,6 +37,9 @@ ot::OTNymID nym_id_{ot::identifier::Nym::Factory()};
 ot::OTNotaryID server_id_{ot::identifier::Notary::Factory()};
 
 struct Ledger : public ::testing::Test {
+    static constexpr auto first_receipt_ = std::int64_t{1000};
+    static constexpr auto receipts_ = std::int64_t{64};
+
     const ot::api::session::Client& client_;
     const ot::api::session::Notary& server_;
     ot::OTPasswordPrompt reason_c_;
@@ -89,4 +95,84 @@ TEST_F(Ledger, load_nymbox)
     ASSERT_TRUE(nymbox);
     EXPECT_TRUE(nymbox->LoadNymbox());
 }
+TEST_F(Ledger, load_box_receipts)
+{
+    const auto nym = client_.Wallet().Nym(nym_id_);
+
+    ASSERT_TRUE(nym);
+
+    {
+        auto nymbox = client_.Factory().InternalSession().Ledger(
+            nym_id_, nym_id_, server_id_, ot::ledgerType::nymbox, false);
+
+        ASSERT_TRUE(nymbox);
+        ASSERT_TRUE(nymbox->LoadNymbox());
+
+        for (auto i = std::int64_t{0}; i < receipts_; ++i) {
+            auto transaction = client_.Factory().InternalSession().Transaction(
+                *nymbox,
+                ot::transactionType::blank,
+                ot::originType::not_applicable,
+                first_receipt_ + i);
+
+            ASSERT_TRUE(transaction);
+            ASSERT_TRUE(transaction->SignContract(*nym, reason_c_));
+            ASSERT_TRUE(transaction->SaveContract());
+            ASSERT_TRUE(transaction->SaveBoxReceipt(*nymbox));
+            ASSERT_TRUE(nymbox->AddTransaction(
+                std::shared_ptr<ot::OTTransaction>{transaction.release()}));
+        }
+
+        nymbox->ReleaseSignatures();
+
+        EXPECT_TRUE(nymbox->SignContract(*nym, reason_c_));
+        EXPECT_TRUE(nymbox->SaveContract());
+        EXPECT_TRUE(nymbox->SaveNymbox());
+    }
+
+    const auto load = [&] {
+        auto nymbox = client_.Factory().InternalSession().Ledger(
+            nym_id_, nym_id_, server_id_, ot::ledgerType::nymbox, false);
+
+        EXPECT_TRUE(nymbox);
+        EXPECT_TRUE(nymbox->LoadNymbox());
+        EXPECT_EQ(nymbox->GetTransactionCount(), receipts_);
+
+        // NOTE the nymbox itself only stores the abbreviated receipts
+        for (const auto& [number, transaction] : nymbox->GetTransactionMap()) {
+            EXPECT_TRUE(transaction->IsAbbreviated());
+        }
+
+        return nymbox;
+    };
+    auto nymbox = load();
+    auto unloaded = ot::UnallocatedSet<std::int64_t>{};
+
+    EXPECT_TRUE(nymbox->LoadBoxReceipts(&unloaded));
+    EXPECT_TRUE(unloaded.empty());
+    EXPECT_EQ(nymbox->GetTransactionCount(), receipts_);
+
+    for (const auto& [number, transaction] : nymbox->GetTransactionMap()) {
+        EXPECT_FALSE(transaction->IsAbbreviated());
+        EXPECT_EQ(transaction->GetTransactionNum(), number);
+    }
+
+    // NOTE every receipt which fails to load is reported, not only the first
+    const auto missing = ot::UnallocatedSet<std::int64_t>{
+        first_receipt_, first_receipt_ + receipts_ / 2};
+    nymbox = load();
+
+    for (const auto number : missing) {
+        EXPECT_TRUE(nymbox->DeleteBoxReceipt(number));
+    }
+
+    nymbox = load();
+
+    EXPECT_FALSE(nymbox->LoadBoxReceipts(&unloaded));
+    EXPECT_EQ(unloaded, missing);
+
+    for (const auto& [number, transaction] : nymbox->GetTransactionMap()) {
+        EXPECT_EQ(transaction->IsAbbreviated(), 0u < missing.count(number));
+    }
+}
 }  // namespace ottest
@@ -0,0 +1,164 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <string_view>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "crypto/library/VerificationCache.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/crypto/HashType.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using VerificationCache = ot::crypto::VerificationCache;
+using namespace std::literals::string_view_literals;
+
+class Test_VerificationCache : public ::testing::Test
+{
+public:
+    static constexpr auto limit_ = std::size_t{3};
+    static constexpr auto plaintext_{"signed contract"sv};
+    static constexpr auto pubkey_{"public key"sv};
+    static constexpr auto signature_{"signature"sv};
+    static constexpr auto type_{ot::crypto::HashType::Sha256};
+
+    const ot::api::session::Client& api_;
+    VerificationCache cache_;
+    std::size_t verified_;
+
+    // Returns true if the cache called the verification function
+    auto Check(
+        const ot::ReadView plaintext = plaintext_,
+        const ot::ReadView pubkey = pubkey_,
+        const ot::ReadView signature = signature_,
+        const ot::crypto::HashType type = type_,
+        const bool valid = true) noexcept -> bool
+    {
+        const auto before = verified_;
+        const auto result =
+            cache_.Check(api_, plaintext, pubkey, signature, type, [&] {
+                ++verified_;
+
+                return valid;
+            });
+
+        EXPECT_EQ(result, valid);
+
+        return before != verified_;
+    }
+
+    Test_VerificationCache()
+        : api_(ot::Context().StartClientSession(0))
+        , cache_(limit_)
+        , verified_(0)
+    {
+    }
+};
+
+TEST_F(Test_VerificationCache, hit)
+{
+    EXPECT_TRUE(Check());
+    EXPECT_FALSE(Check());
+    EXPECT_FALSE(Check());
+
+    const auto stats = cache_.GetStats();
+
+    EXPECT_EQ(stats.hits_, 2u);
+    EXPECT_EQ(stats.misses_, 1u);
+    EXPECT_EQ(stats.size_, 1u);
+}
+
+TEST_F(Test_VerificationCache, miss)
+{
+    ASSERT_TRUE(Check());
+
+    // NOTE every input is part of the key
+    EXPECT_TRUE(Check("signed contracT"sv));
+    EXPECT_TRUE(Check("signed contract "sv));
+    EXPECT_TRUE(Check(plaintext_, "public keY"sv));
+    EXPECT_TRUE(Check(plaintext_, pubkey_, "signaturE"sv));
+    EXPECT_TRUE(Check(
+        plaintext_, pubkey_, signature_, ot::crypto::HashType::Sha512));
+
+    const auto stats = cache_.GetStats();
+
+    EXPECT_EQ(stats.hits_, 0u);
+    EXPECT_EQ(stats.misses_, 6u);
+    EXPECT_EQ(stats.size_, limit_);
+}
+
+TEST_F(Test_VerificationCache, failure_is_not_cached)
+{
+    EXPECT_TRUE(Check(plaintext_, pubkey_, signature_, type_, false));
+    EXPECT_TRUE(Check(plaintext_, pubkey_, signature_, type_, false));
+
+    auto stats = cache_.GetStats();
+
+    EXPECT_EQ(stats.hits_, 0u);
+    EXPECT_EQ(stats.misses_, 2u);
+    EXPECT_EQ(stats.size_, 0u);
+
+    // NOTE a later successful verification is cached
+    EXPECT_TRUE(Check());
+    EXPECT_FALSE(Check());
+
+    stats = cache_.GetStats();
+
+    EXPECT_EQ(stats.hits_, 1u);
+    EXPECT_EQ(stats.misses_, 3u);
+    EXPECT_EQ(stats.size_, 1u);
+}
+
+TEST_F(Test_VerificationCache, eviction)
+{
+    const auto plaintext = ot::UnallocatedVector<std::string_view>{
+        "first"sv, "second"sv, "third"sv, "fourth"sv};
+
+    for (auto i = std::size_t{0}; i < limit_; ++i) {
+        EXPECT_TRUE(Check(plaintext.at(i)));
+    }
+
+    EXPECT_EQ(cache_.GetStats().size_, limit_);
+
+    // NOTE a hit moves the entry to the front of the queue so the second
+    // entry is now the least recently used
+    EXPECT_FALSE(Check(plaintext.at(0)));
+    EXPECT_TRUE(Check(plaintext.at(3)));
+    EXPECT_EQ(cache_.GetStats().size_, limit_);
+    EXPECT_FALSE(Check(plaintext.at(0)));
+    EXPECT_FALSE(Check(plaintext.at(2)));
+    EXPECT_FALSE(Check(plaintext.at(3)));
+    EXPECT_TRUE(Check(plaintext.at(1)));
+
+    // NOTE re-adding the second entry evicted the first
+    EXPECT_TRUE(Check(plaintext.at(0)));
+
+    const auto stats = cache_.GetStats();
+
+    EXPECT_EQ(stats.hits_, 4u);
+    EXPECT_EQ(stats.misses_, 6u);
+    EXPECT_EQ(stats.size_, limit_);
+}
+
+TEST_F(Test_VerificationCache, large_plaintext)
+{
+    auto plaintext = ot::UnallocatedCString(1u << 20u, 'x');
+
+    EXPECT_TRUE(Check(plaintext));
+    EXPECT_FALSE(Check(plaintext));
+
+    plaintext.back() = 'y';
+
+    EXPECT_TRUE(Check(plaintext));
+}
+}  // namespace ottest
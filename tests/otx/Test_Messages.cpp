@@ -7,6 +7,9 @@
 #include <memory>
 
 #include "internal/api/session/Client.hpp"
+#include "internal/api/session/FactoryAPI.hpp"
+#include "internal/otx/Types.hpp"
+#include "internal/otx/common/Message.hpp"
 #include "internal/otx/client/obsolete/OTAPI_Exec.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/Mutex.hpp"
@@ -17,6 +20,7 @@
 #include "opentxs/api/session/Notary.hpp"
 #include "opentxs/api/session/OTX.hpp"
 #include "opentxs/api/session/Wallet.hpp"
+#include "opentxs/core/String.hpp"
 #include "opentxs/core/contract/ServerContract.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/core/identifier/Notary.hpp"
@@ -68,6 +72,32 @@ public:
         if (false == init_) { init(); }
     }
 
+    // Checks that a legacy message survives both wire encodings
+    auto check_encodings(
+        const ot::Message& message,
+        const ot::api::Session& api,
+        const ot::identity::Nym& signer) const noexcept -> void
+    {
+        for (const auto binary : {false, true}) {
+            const auto bytes = message.Encode(binary);
+
+            ASSERT_FALSE(bytes.empty());
+
+            auto copy = api.Factory().InternalSession().Message();
+
+            ASSERT_TRUE(copy);
+            ASSERT_TRUE(copy->Decode(bytes, binary));
+            EXPECT_TRUE(copy->VerifySignature(signer));
+            EXPECT_STREQ(
+                copy->m_strCommand->Get(), message.m_strCommand->Get());
+            EXPECT_STREQ(copy->m_strNymID->Get(), message.m_strNymID->Get());
+            EXPECT_STREQ(
+                copy->m_strNotaryID->Get(), message.m_strNotaryID->Get());
+            EXPECT_EQ(copy->m_bBool, message.m_bBool);
+            EXPECT_EQ(copy->Encode(true), message.Encode(true));
+        }
+    }
+
     void import_server_contract(
         const ot::contract::Server& contract,
         const ot::api::session::Client& client)
@@ -201,4 +231,57 @@ TEST_F(Test_Messages, pushReply)
     ASSERT_TRUE(aliceCopy->Push());
     EXPECT_TRUE(aliceCopy->Validate());
 }
+
+TEST_F(Test_Messages, legacyEncodings)
+{
+    const auto alice = client_.Wallet().Nym(alice_nym_id_);
+    const auto server = server_.Wallet().Nym(server_.NymID());
+
+    ASSERT_TRUE(alice);
+    ASSERT_TRUE(server);
+
+    auto request = client_.Factory().InternalSession().Message();
+
+    ASSERT_TRUE(request);
+
+    request->m_strCommand = ot::String::Factory(
+        ot::Message::Command(ot::MessageType::registerNym));
+    request->m_strNymID = ot::String::Factory(Alice_);
+    request->m_strNotaryID = ot::String::Factory(server_id_.str());
+    request->m_strRequestNum = ot::String::Factory("1");
+
+    ASSERT_TRUE(request->SignContract(*alice, reason_c_));
+    ASSERT_TRUE(request->SaveContract());
+    EXPECT_EQ(
+        request->Encode(true).find("binary="), ot::UnallocatedCString::npos);
+
+    check_encodings(*request, server_, *alice);
+
+    request->m_bBool = true;
+
+    ASSERT_TRUE(request->SignContract(*alice, reason_c_));
+    ASSERT_TRUE(request->SaveContract());
+    EXPECT_NE(
+        request->Encode(true).find("binary=\"true\""),
+        ot::UnallocatedCString::npos);
+
+    check_encodings(*request, server_, *alice);
+
+    auto reply = server_.Factory().InternalSession().Message();
+
+    ASSERT_TRUE(reply);
+
+    reply->m_strCommand = ot::String::Factory(
+        ot::Message::ReplyCommand(ot::MessageType::registerNym));
+    reply->m_strNymID = request->m_strNymID;
+    reply->m_strNotaryID = request->m_strNotaryID;
+    reply->m_strRequestNum = request->m_strRequestNum;
+    reply->m_ascInReferenceTo->SetString(ot::String::Factory(*request));
+    reply->m_bBool = true;
+
+    ASSERT_TRUE(reply->SignContract(*server, reason_s_));
+    ASSERT_TRUE(reply->SaveContract());
+
+    check_encodings(*reply, client_, *server);
+}
 }  // namespace ottest
@@ -0,0 +1,154 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <limits>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "opentxs/util/Container.hpp"
+#include "otx/consensus/NumberSet.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using NumberSet = ot::otx::context::NumberSet;
+using Ranges = NumberSet::Map;
+using Numbers = ot::UnallocatedVector<NumberSet::value_type>;
+
+auto numbers(const NumberSet& set) noexcept -> Numbers
+{
+    return {set.begin(), set.end()};
+}
+
+TEST(NumberSet, empty)
+{
+    const auto set = NumberSet{};
+
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(set.size(), 0u);
+    EXPECT_TRUE(set.begin() == set.end());
+    EXPECT_TRUE(set.Ranges().empty());
+    EXPECT_TRUE(set.Set().empty());
+}
+
+TEST(NumberSet, merge_adjacent)
+{
+    auto set = NumberSet{};
+
+    EXPECT_TRUE(set.insert(1));
+    EXPECT_TRUE(set.insert(3));
+    EXPECT_EQ(set.Ranges(), (Ranges{{1, 1}, {3, 3}}));
+    EXPECT_TRUE(set.insert(2));
+    EXPECT_EQ(set.Ranges(), (Ranges{{1, 3}}));
+    EXPECT_FALSE(set.insert(2));
+    EXPECT_EQ(set.size(), 3u);
+    EXPECT_EQ(numbers(set), (Numbers{1, 2, 3}));
+}
+
+TEST(NumberSet, merge_overlapping)
+{
+    auto set = NumberSet{};
+
+    EXPECT_EQ(set.insert(5, 10), 6u);
+    EXPECT_EQ(set.insert(8, 12), 2u);
+    EXPECT_EQ(set.Ranges(), (Ranges{{5, 12}}));
+    EXPECT_EQ(set.insert(20, 25), 6u);
+    EXPECT_EQ(set.insert(1, 3), 3u);
+    EXPECT_EQ(set.Ranges(), (Ranges{{1, 3}, {5, 12}, {20, 25}}));
+
+    // NOTE one range spanning several existing ranges absorbs all of them
+    EXPECT_EQ(set.insert(4, 19), 8u);
+    EXPECT_EQ(set.Ranges(), (Ranges{{1, 25}}));
+    EXPECT_EQ(set.size(), 25u);
+    EXPECT_EQ(set.insert(2, 24), 0u);
+    EXPECT_EQ(set.insert(9, 8), 0u);
+    EXPECT_EQ(set.size(), 25u);
+}
+
+TEST(NumberSet, limits)
+{
+    using Limits = std::numeric_limits<NumberSet::value_type>;
+    auto set = NumberSet{};
+
+    EXPECT_EQ(set.insert(Limits::max() - 1, Limits::max()), 2u);
+    EXPECT_TRUE(set.insert(Limits::min()));
+    EXPECT_EQ(set.size(), 3u);
+    EXPECT_EQ(set.count(Limits::max()), 1u);
+    EXPECT_EQ(set.count(Limits::min()), 1u);
+    EXPECT_EQ(set.count(0), 0u);
+    EXPECT_EQ(set.erase(Limits::max()), 1u);
+    EXPECT_EQ(
+        set.Ranges(),
+        (Ranges{
+            {Limits::min(), Limits::min()},
+            {Limits::max() - 1, Limits::max() - 1}}));
+}
+
+TEST(NumberSet, split_on_erase)
+{
+    auto set = NumberSet{};
+    set.insert(1, 10);
+
+    EXPECT_EQ(set.erase(5), 1u);
+    EXPECT_EQ(set.Ranges(), (Ranges{{1, 4}, {6, 10}}));
+    EXPECT_EQ(set.erase(1), 1u);
+    EXPECT_EQ(set.erase(10), 1u);
+    EXPECT_EQ(set.Ranges(), (Ranges{{2, 4}, {6, 9}}));
+    EXPECT_EQ(set.erase(5), 0u);
+    EXPECT_EQ(set.erase(11), 0u);
+    EXPECT_EQ(set.size(), 7u);
+    EXPECT_EQ(numbers(set), (Numbers{2, 3, 4, 6, 7, 8, 9}));
+    EXPECT_EQ(set.erase(2), 1u);
+    EXPECT_EQ(set.erase(3), 1u);
+    EXPECT_EQ(set.erase(4), 1u);
+    EXPECT_EQ(set.Ranges(), (Ranges{{6, 9}}));
+}
+
+TEST(NumberSet, copy_on_write)
+{
+    auto original = NumberSet{};
+    original.insert(1, 10);
+    auto copy = original;
+
+    EXPECT_EQ(&copy.Ranges(), &original.Ranges());
+
+    copy.erase(5);
+
+    EXPECT_NE(&copy.Ranges(), &original.Ranges());
+    EXPECT_EQ(original.count(5), 1u);
+    EXPECT_EQ(original.size(), 10u);
+    EXPECT_EQ(original.Ranges(), (Ranges{{1, 10}}));
+    EXPECT_EQ(copy.count(5), 0u);
+    EXPECT_EQ(copy.size(), 9u);
+
+    auto other = original;
+    original.insert(20);
+
+    EXPECT_EQ(other.count(20), 0u);
+    EXPECT_EQ(other.size(), 10u);
+    EXPECT_EQ(original.size(), 11u);
+
+    other.clear();
+
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(original.size(), 11u);
+}
+
+TEST(NumberSet, load)
+{
+    // NOTE a trailing unpaired range element is ignored
+    const auto set =
+        NumberSet::Load(Numbers{7, 3, 11}, Numbers{10, 12, 1, 1, 100});
+
+    EXPECT_EQ(set.Ranges(), (Ranges{{1, 1}, {3, 3}, {7, 7}, {10, 12}}));
+    EXPECT_EQ(numbers(set), (Numbers{1, 3, 7, 10, 11, 12}));
+    EXPECT_EQ(
+        set.Set(), (ot::UnallocatedSet<NumberSet::value_type>{
+                       1, 3, 7, 10, 11, 12}));
+    EXPECT_EQ(NumberSet{set.Set()}.Ranges(), set.Ranges());
+}
+}  // namespace ottest
@@ -0,0 +1,302 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "internal/api/session/FactoryAPI.hpp"
+#include "internal/otx/common/trade/OTOffer.hpp"
+#include "internal/otx/common/trade/OrderBook.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/api/session/Factory.hpp"
+#include "opentxs/core/Amount.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_OrderBook : public ::testing::Test
+{
+public:
+    using Book = ot::otx::OrderBook;
+
+    const ot::api::session::Client& api_;
+    ot::UnallocatedVector<std::unique_ptr<ot::OTOffer>> offers_;
+    Book book_;
+
+    auto Ask(
+        const std::int64_t number,
+        const std::int64_t price,
+        const std::int64_t amount = 10) noexcept -> ot::OTOffer&
+    {
+        return Add(true, number, price, amount);
+    }
+    auto Bid(
+        const std::int64_t number,
+        const std::int64_t price,
+        const std::int64_t amount = 10) noexcept -> ot::OTOffer&
+    {
+        return Add(false, number, price, amount);
+    }
+    // Returns the transaction numbers of the offers in matching order
+    auto Order(const bool bids) const noexcept
+        -> ot::UnallocatedVector<std::int64_t>
+    {
+        auto out = ot::UnallocatedVector<std::int64_t>{};
+        book_.Visit(bids, [&](auto& offer) {
+            out.emplace_back(offer.GetTransactionNum());
+
+            return true;
+        });
+
+        return out;
+    }
+
+    Test_OrderBook()
+        : api_(ot::Context().StartClientSession(0))
+        , offers_()
+        , book_()
+    {
+    }
+
+private:
+    auto Add(
+        const bool selling,
+        const std::int64_t number,
+        const std::int64_t price,
+        const std::int64_t amount) noexcept -> ot::OTOffer&
+    {
+        auto& offer =
+            *offers_.emplace_back(api_.Factory().InternalSession().Offer());
+        offer.MakeOffer(selling, price, amount, 1, number);
+
+        EXPECT_TRUE(book_.Add(offer));
+
+        return offer;
+    }
+};
+
+TEST_F(Test_OrderBook, empty)
+{
+    EXPECT_EQ(book_.BestBid(), 0);
+    EXPECT_EQ(book_.BestAsk(), 0);
+    EXPECT_EQ(book_.BidCount(), 0u);
+    EXPECT_EQ(book_.AskCount(), 0u);
+    EXPECT_FALSE(book_.Crosses());
+    EXPECT_TRUE(book_.Depth(true, 10).empty());
+    EXPECT_TRUE(book_.Top(false, 10).empty());
+    EXPECT_EQ(book_.Find(1), nullptr);
+    EXPECT_EQ(book_.Remove(1), nullptr);
+}
+
+TEST_F(Test_OrderBook, price_priority)
+{
+    Bid(1, 100);
+    Bid(2, 105);
+    Bid(3, 95);
+    Ask(4, 110);
+    Ask(5, 108);
+    Ask(6, 120);
+
+    EXPECT_EQ(book_.BestBid(), 105);
+    EXPECT_EQ(book_.BestAsk(), 108);
+    EXPECT_EQ(Order(true), (ot::UnallocatedVector<std::int64_t>{2, 1, 3}));
+    EXPECT_EQ(Order(false), (ot::UnallocatedVector<std::int64_t>{5, 4, 6}));
+    EXPECT_FALSE(book_.Crosses());
+}
+
+TEST_F(Test_OrderBook, time_priority)
+{
+    Bid(1, 100);
+    Bid(2, 100);
+    Bid(3, 101);
+    Bid(4, 100);
+    Ask(5, 200);
+    Ask(6, 200);
+    Ask(7, 199);
+
+    EXPECT_EQ(Order(true), (ot::UnallocatedVector<std::int64_t>{3, 1, 2, 4}));
+    EXPECT_EQ(Order(false), (ot::UnallocatedVector<std::int64_t>{7, 5, 6}));
+}
+
+TEST_F(Test_OrderBook, market_orders)
+{
+    Bid(1, 0);
+    Bid(2, 100);
+    Ask(3, 0);
+    Ask(4, 110);
+
+    EXPECT_EQ(book_.BidCount(), 2u);
+    EXPECT_EQ(book_.AskCount(), 2u);
+    EXPECT_EQ(book_.BestBid(), 100);
+    EXPECT_EQ(book_.BestAsk(), 110);
+    EXPECT_EQ(Order(true), (ot::UnallocatedVector<std::int64_t>{2, 1}));
+    EXPECT_EQ(Order(false), (ot::UnallocatedVector<std::int64_t>{3, 4}));
+
+    const auto bids = book_.Top(true, 10);
+    const auto asks = book_.Top(false, 10);
+
+    ASSERT_EQ(bids.size(), 1u);
+    ASSERT_EQ(asks.size(), 1u);
+    EXPECT_EQ(bids.front()->GetTransactionNum(), 2);
+    EXPECT_EQ(asks.front()->GetTransactionNum(), 4);
+    EXPECT_EQ(book_.Depth(true, 10).size(), 1u);
+    EXPECT_EQ(book_.Depth(false, 10).size(), 1u);
+
+    EXPECT_NE(book_.Remove(2), nullptr);
+    EXPECT_NE(book_.Remove(4), nullptr);
+    EXPECT_EQ(book_.BestBid(), 0);
+    EXPECT_EQ(book_.BestAsk(), 0);
+}
+
+TEST_F(Test_OrderBook, duplicate_number)
+{
+    auto& offer = Bid(1, 100);
+    auto other = api_.Factory().InternalSession().Offer();
+    other->MakeOffer(true, 110, 10, 1, 1);
+
+    EXPECT_FALSE(book_.Add(offer));
+    EXPECT_FALSE(book_.Add(*other));
+    EXPECT_EQ(book_.BidCount(), 1u);
+    EXPECT_EQ(book_.AskCount(), 0u);
+    EXPECT_EQ(book_.Find(1), &offer);
+}
+
+TEST_F(Test_OrderBook, cancel)
+{
+    auto& first = Bid(1, 100);
+    auto& second = Bid(2, 100);
+    Bid(3, 100);
+    Bid(4, 90);
+
+    EXPECT_EQ(book_.Find(2), &second);
+    EXPECT_EQ(book_.Remove(2), &second);
+    EXPECT_EQ(book_.Find(2), nullptr);
+    EXPECT_EQ(book_.Remove(2), nullptr);
+    EXPECT_EQ(book_.BidCount(), 3u);
+    EXPECT_EQ(Order(true), (ot::UnallocatedVector<std::int64_t>{1, 3, 4}));
+
+    EXPECT_EQ(book_.Remove(1), &first);
+    EXPECT_NE(book_.Remove(3), nullptr);
+    EXPECT_EQ(book_.BestBid(), 90);
+    EXPECT_EQ(book_.Depth(true, 10).size(), 1u);
+
+    Bid(5, 100);
+
+    EXPECT_EQ(Order(true), (ot::UnallocatedVector<std::int64_t>{5, 4}));
+}
+
+TEST_F(Test_OrderBook, depth)
+{
+    Ask(1, 110, 5);
+    Ask(2, 110, 7);
+    Ask(3, 120, 3);
+    Ask(4, 130, 1);
+    Bid(5, 100, 2);
+    Bid(6, 90, 4);
+    Bid(7, 90, 6);
+
+    const auto asks = book_.Depth(false, 2);
+    const auto bids = book_.Depth(true, 10);
+
+    ASSERT_EQ(asks.size(), 2u);
+    EXPECT_EQ(asks.at(0).price_, 110);
+    EXPECT_EQ(asks.at(0).volume_, 12);
+    EXPECT_EQ(asks.at(0).offers_, 2u);
+    EXPECT_EQ(asks.at(1).price_, 120);
+    EXPECT_EQ(asks.at(1).volume_, 3);
+    ASSERT_EQ(bids.size(), 2u);
+    EXPECT_EQ(bids.at(0).price_, 100);
+    EXPECT_EQ(bids.at(0).volume_, 2);
+    EXPECT_EQ(bids.at(1).price_, 90);
+    EXPECT_EQ(bids.at(1).volume_, 10);
+    EXPECT_EQ(bids.at(1).offers_, 2u);
+    EXPECT_EQ(book_.AskVolume(), 16);
+    EXPECT_EQ(book_.BidVolume(), 12);
+    EXPECT_EQ(book_.Top(false, 3).size(), 3u);
+    EXPECT_TRUE(book_.Depth(false, 0).empty());
+}
+
+TEST_F(Test_OrderBook, fill)
+{
+    auto& ask = Ask(1, 110, 10);
+    Ask(2, 110, 10);
+    auto& bid = Bid(3, 110, 4);
+
+    EXPECT_TRUE(book_.Crosses());
+
+    ask.IncrementFinishedSoFar(4);
+    book_.Fill(1, 4);
+    bid.IncrementFinishedSoFar(4);
+    book_.Fill(3, 4);
+
+    EXPECT_EQ(book_.AskVolume(), 16);
+    EXPECT_EQ(book_.BidVolume(), 0);
+    EXPECT_EQ(book_.Depth(false, 1).at(0).volume_, 16);
+
+    EXPECT_NE(book_.Remove(1), nullptr);
+    EXPECT_NE(book_.Remove(3), nullptr);
+    EXPECT_EQ(book_.AskVolume(), 10);
+    EXPECT_EQ(book_.BidVolume(), 0);
+    EXPECT_FALSE(book_.Crosses());
+}
+
+TEST_F(Test_OrderBook, crosses)
+{
+    Bid(1, 100);
+    Ask(2, 101);
+
+    EXPECT_FALSE(book_.Crosses());
+
+    Bid(3, 101);
+
+    EXPECT_TRUE(book_.Crosses());
+
+    book_.Remove(3);
+    Ask(4, 99);
+
+    EXPECT_TRUE(book_.Crosses());
+}
+
+TEST_F(Test_OrderBook, visit_stops)
+{
+    for (auto i = std::int64_t{1}; i <= 10; ++i) { Ask(i, 100 + i); }
+
+    auto visited = std::size_t{0};
+    book_.Visit(false, [&](auto& offer) {
+        ++visited;
+
+        return offer.GetPriceLimit() < 103;
+    });
+
+    EXPECT_EQ(visited, 3u);
+}
+
+TEST_F(Test_OrderBook, clear)
+{
+    Bid(1, 100);
+    Bid(2, 0);
+    Ask(3, 110);
+
+    const auto offers = book_.Clear();
+
+    EXPECT_EQ(offers.size(), 3u);
+    EXPECT_EQ(book_.BidCount(), 0u);
+    EXPECT_EQ(book_.AskCount(), 0u);
+    EXPECT_EQ(book_.BidVolume(), 0);
+    EXPECT_EQ(book_.Find(1), nullptr);
+    EXPECT_TRUE(Order(true).empty());
+
+    Bid(1, 100);
+
+    EXPECT_EQ(book_.BestBid(), 100);
+}
+}  // namespace ottest
@@ -0,0 +1,249 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <memory>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "internal/api/Legacy.hpp"
+#include "internal/api/session/Session.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/session/Client.hpp"
+#include "opentxs/util/Container.hpp"
+#include "otx/common/OTStorage.hpp"
+#include "otx/common/lmdb/StorageLMDB.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace ottest
+{
+namespace OTDB = ot::OTDB;
+
+class Test_StorageLMDB : public ::testing::Test
+{
+public:
+    using Storage = std::unique_ptr<OTDB::Storage>;
+
+    const ot::api::session::Client& api_;
+    const fs::path folder_;
+    // NOTE StorageFS appends locations to the data folder without a separator
+    const ot::UnallocatedCString data_folder_;
+    const ot::UnallocatedCString nymbox_;
+    const ot::UnallocatedCString receipt_;
+    Storage filesystem_;
+    Storage lmdb_;
+
+    static auto TempFolder() noexcept -> fs::path
+    {
+        auto path = fs::temp_directory_path() /
+                    fs::unique_path("opentxs-otdb-%%%%-%%%%-%%%%-%%%%");
+        fs::create_directories(path);
+
+        return path;
+    }
+
+    auto Batch() noexcept -> OTDB::StorageLMDB&
+    {
+        return dynamic_cast<OTDB::StorageLMDB&>(*lmdb_);
+    }
+    auto Erase(
+        OTDB::Storage& storage,
+        const ot::UnallocatedCString& zero,
+        const ot::UnallocatedCString& one,
+        const ot::UnallocatedCString& two = "",
+        const ot::UnallocatedCString& three = "") noexcept -> bool
+    {
+        return storage.EraseValueByKey(
+            api_, data_folder_, zero, one, two, three);
+    }
+    auto Exists(
+        OTDB::Storage& storage,
+        const ot::UnallocatedCString& zero,
+        const ot::UnallocatedCString& one,
+        const ot::UnallocatedCString& two = "",
+        const ot::UnallocatedCString& three = "") noexcept -> bool
+    {
+        return storage.Exists(api_, data_folder_, zero, one, two, three);
+    }
+    auto Load(
+        OTDB::Storage& storage,
+        const ot::UnallocatedCString& zero,
+        const ot::UnallocatedCString& one,
+        const ot::UnallocatedCString& two = "",
+        const ot::UnallocatedCString& three = "") noexcept
+        -> ot::UnallocatedCString
+    {
+        return storage.QueryPlainString(
+            api_, data_folder_, zero, one, two, three);
+    }
+    auto Store(
+        OTDB::Storage& storage,
+        const ot::UnallocatedCString& value,
+        const ot::UnallocatedCString& zero,
+        const ot::UnallocatedCString& one,
+        const ot::UnallocatedCString& two = "",
+        const ot::UnallocatedCString& three = "") noexcept -> bool
+    {
+        return storage.StorePlainString(
+            api_, value, data_folder_, zero, one, two, three);
+    }
+
+    Test_StorageLMDB()
+        : api_(ot::Context().StartClientSession(0))
+        , folder_(TempFolder())
+        , data_folder_(folder_.string() + "/")
+        , nymbox_(api_.Internal().Legacy().Nymbox())
+        , receipt_(api_.Internal().Legacy().Receipt())
+        , filesystem_(OTDB::Storage::Create(
+              OTDB::STORE_FILESYSTEM,
+              OTDB_DEFAULT_PACKER))
+        , lmdb_(OTDB::Storage::Create(OTDB::STORE_LMDB, OTDB_DEFAULT_PACKER))
+    {
+    }
+
+    ~Test_StorageLMDB() override
+    {
+        lmdb_.reset();
+        auto ec = boost::system::error_code{};
+        fs::remove_all(folder_, ec);
+    }
+};
+
+TEST_F(Test_StorageLMDB, init)
+{
+    ASSERT_TRUE(filesystem_);
+    ASSERT_TRUE(lmdb_);
+    EXPECT_EQ(lmdb_->GetType(), OTDB::STORE_LMDB);
+}
+
+TEST_F(Test_StorageLMDB, store_load_erase)
+{
+    ASSERT_TRUE(OTDB::MigrateFilesystemStorage(*lmdb_, api_, data_folder_));
+    EXPECT_FALSE(Exists(*lmdb_, nymbox_, "ot2nym", "ot2box"));
+    EXPECT_TRUE(Store(*lmdb_, "first", nymbox_, "ot2nym", "ot2box"));
+    EXPECT_TRUE(Exists(*lmdb_, nymbox_, "ot2nym", "ot2box"));
+    EXPECT_EQ(Load(*lmdb_, nymbox_, "ot2nym", "ot2box"), "first");
+    EXPECT_TRUE(Store(*lmdb_, "second", nymbox_, "ot2nym", "ot2box"));
+    EXPECT_EQ(Load(*lmdb_, nymbox_, "ot2nym", "ot2box"), "second");
+
+    // NOTE the value is not written to the filesystem
+    EXPECT_FALSE(fs::exists(folder_ / nymbox_ / "ot2nym" / "ot2box"));
+    EXPECT_FALSE(Exists(*filesystem_, nymbox_, "ot2nym", "ot2box"));
+
+    EXPECT_TRUE(Erase(*lmdb_, nymbox_, "ot2nym", "ot2box"));
+    EXPECT_FALSE(Exists(*lmdb_, nymbox_, "ot2nym", "ot2box"));
+    EXPECT_TRUE(Load(*lmdb_, nymbox_, "ot2nym", "ot2box").empty());
+
+    // NOTE locations StorageFS would reject are rejected
+    EXPECT_FALSE(Store(*lmdb_, "value", nymbox_, "ab"));
+    EXPECT_FALSE(Store(*lmdb_, "value", nymbox_, "ot2nym", "", "ot2box"));
+}
+
+TEST_F(Test_StorageLMDB, store_object)
+{
+    ASSERT_TRUE(OTDB::MigrateFilesystemStorage(*lmdb_, api_, data_folder_));
+
+    auto input = std::unique_ptr<OTDB::Storable>{
+        lmdb_->CreateObject(OTDB::STORED_OBJ_STRING_MAP)};
+    auto* map = dynamic_cast<OTDB::StringMap*>(input.get());
+
+    ASSERT_NE(map, nullptr);
+
+    map->SetValue("key", "value");
+
+    EXPECT_TRUE(lmdb_->StoreObject(
+        api_, *map, data_folder_, nymbox_, "ot2map", "", ""));
+
+    const auto output = std::unique_ptr<OTDB::Storable>{lmdb_->QueryObject(
+        api_,
+        OTDB::STORED_OBJ_STRING_MAP,
+        data_folder_,
+        nymbox_,
+        "ot2map",
+        "",
+        "")};
+    auto* loaded = dynamic_cast<OTDB::StringMap*>(output.get());
+
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(loaded->GetValue("key"), "value");
+}
+
+TEST_F(Test_StorageLMDB, batch)
+{
+    ASSERT_TRUE(OTDB::MigrateFilesystemStorage(*lmdb_, api_, data_folder_));
+    ASSERT_TRUE(Store(*lmdb_, "old", nymbox_, "ot2nym", "ot2old"));
+
+    Batch().BeginBatch();
+
+    // NOTE readers see writes made during a batch before it is committed
+    EXPECT_TRUE(Store(*lmdb_, "new", nymbox_, "ot2nym", "ot2new"));
+    EXPECT_TRUE(Erase(*lmdb_, nymbox_, "ot2nym", "ot2old"));
+    EXPECT_EQ(Load(*lmdb_, nymbox_, "ot2nym", "ot2new"), "new");
+    EXPECT_FALSE(Exists(*lmdb_, nymbox_, "ot2nym", "ot2old"));
+
+    Batch().EndBatch();
+
+    EXPECT_EQ(Load(*lmdb_, nymbox_, "ot2nym", "ot2new"), "new");
+    EXPECT_FALSE(Exists(*lmdb_, nymbox_, "ot2nym", "ot2old"));
+
+    // NOTE committed values survive a restart
+    lmdb_.reset(OTDB::Storage::Create(OTDB::STORE_LMDB, OTDB_DEFAULT_PACKER));
+
+    ASSERT_TRUE(OTDB::MigrateFilesystemStorage(*lmdb_, api_, data_folder_));
+    EXPECT_EQ(Load(*lmdb_, nymbox_, "ot2nym", "ot2new"), "new");
+    EXPECT_FALSE(Exists(*lmdb_, nymbox_, "ot2nym", "ot2old"));
+}
+
+TEST_F(Test_StorageLMDB, other_data_folders_use_filesystem)
+{
+    // NOTE this data folder was never migrated
+    EXPECT_TRUE(Store(*lmdb_, "value", nymbox_, "ot2nym", "ot2box"));
+    EXPECT_TRUE(fs::exists(folder_ / nymbox_ / "ot2nym" / "ot2box"));
+    EXPECT_EQ(Load(*filesystem_, nymbox_, "ot2nym", "ot2box"), "value");
+    EXPECT_TRUE(Exists(*lmdb_, nymbox_, "ot2nym", "ot2box"));
+    EXPECT_FALSE(fs::exists(folder_ / "otdb"));
+}
+
+TEST_F(Test_StorageLMDB, migrate_round_trip)
+{
+    ASSERT_TRUE(Store(*filesystem_, "top", ".", "ot2top.xml"));
+    ASSERT_TRUE(Store(*filesystem_, "box", nymbox_, "ot2nym", "ot2box"));
+    ASSERT_TRUE(Store(
+        *filesystem_, "receipt", receipt_, "ot2srv", "ot2acct", "ot2rct.rct"));
+    // NOTE files outside of the legacy folders are not imported
+    ASSERT_TRUE(Store(*filesystem_, "other", "unrelated", "ot2file"));
+
+    ASSERT_TRUE(OTDB::MigrateFilesystemStorage(*lmdb_, api_, data_folder_));
+
+    // NOTE remove the legacy files to prove the values come from the database
+    fs::remove(folder_ / "ot2top.xml");
+    fs::remove_all(folder_ / nymbox_);
+    fs::remove_all(folder_ / receipt_);
+
+    EXPECT_EQ(Load(*lmdb_, ".", "ot2top.xml"), "top");
+    EXPECT_EQ(Load(*lmdb_, nymbox_, "ot2nym", "ot2box"), "box");
+    EXPECT_EQ(
+        Load(*lmdb_, receipt_, "ot2srv", "ot2acct", "ot2rct.rct"), "receipt");
+    EXPECT_FALSE(Exists(*lmdb_, "unrelated", "ot2file"));
+
+    // NOTE the import only runs the first time a data folder is migrated
+    ASSERT_TRUE(Store(*filesystem_, "late", nymbox_, "ot2nym", "ot2late"));
+
+    lmdb_.reset(OTDB::Storage::Create(OTDB::STORE_LMDB, OTDB_DEFAULT_PACKER));
+
+    ASSERT_TRUE(OTDB::MigrateFilesystemStorage(*lmdb_, api_, data_folder_));
+    EXPECT_EQ(Load(*lmdb_, nymbox_, "ot2nym", "ot2box"), "box");
+    EXPECT_FALSE(Exists(*lmdb_, nymbox_, "ot2nym", "ot2late"));
+}
+
+TEST_F(Test_StorageLMDB, filesystem_is_not_migrated)
+{
+    EXPECT_FALSE(
+        OTDB::MigrateFilesystemStorage(*filesystem_, api_, data_folder_));
+}
+}  // namespace ottest